@@ -0,0 +1,107 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/daemon/daemon_server.h"
+
+#include "gui/state/logging.h"
+
+namespace loot {
+DaemonServer::DaemonServer(DaemonRequestHandler& handler, QObject* parent) :
+    QObject(parent), handler(handler) {
+  // Only the user that's running the daemon can connect to it.
+  server->setSocketOptions(QLocalServer::UserAccessOption);
+
+  connect(server,
+          &QLocalServer::newConnection,
+          this,
+          &DaemonServer::handleNewConnection);
+}
+
+bool DaemonServer::listen(const QString& socketName) {
+  if (server->listen(socketName)) {
+    return true;
+  }
+
+  if (server->serverError() != QAbstractSocket::AddressInUseError) {
+    return false;
+  }
+
+  // The socket may have been left behind by a daemon that didn't exit
+  // cleanly, so replace it unless a daemon is still listening on it.
+  QLocalSocket socket;
+  socket.connectToServer(socketName);
+  if (socket.waitForConnected(CONNECTION_TIMEOUT_MS)) {
+    return false;
+  }
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Removing the stale daemon socket {}",
+                 socketName.toStdString());
+  }
+
+  QLocalServer::removeServer(socketName);
+
+  return server->listen(socketName);
+}
+
+QString DaemonServer::errorString() const { return server->errorString(); }
+
+void DaemonServer::handleNewConnection() {
+  while (auto socket = server->nextPendingConnection()) {
+    connect(socket,
+            &QLocalSocket::disconnected,
+            socket,
+            &QLocalSocket::deleteLater);
+    connect(socket, &QLocalSocket::readyRead, this, [this, socket]() {
+      handleReadyRead(socket);
+    });
+  }
+}
+
+void DaemonServer::handleReadyRead(QLocalSocket* socket) {
+  while (socket->canReadLine()) {
+    const auto request = socket->readLine().trimmed();
+    if (request.isEmpty()) {
+      continue;
+    }
+
+    socket->write(handler.handleRequest(request) + '\n');
+  }
+
+  // Don't buffer an unbounded amount of data while waiting for a line to end.
+  if (socket->bytesAvailable() > MAX_REQUEST_SIZE) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Disconnecting a daemon client that sent a request "
+                    "larger than {} bytes",
+                    MAX_REQUEST_SIZE);
+    }
+
+    socket->write("{\"error\":\"The request is too large.\"}\n");
+    socket->disconnectFromServer();
+  }
+}
+}
@@ -0,0 +1,64 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_DAEMON_DAEMON_SERVER
+#define LOOT_GUI_DAEMON_DAEMON_SERVER
+
+#include <QtCore/QObject>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+#include "gui/daemon/request_handler.h"
+
+namespace loot {
+// Listens on a local socket for requests, which are JSON objects that are
+// each written on a single line, and writes each request's response on its
+// own line. The socket is a Unix domain socket, or a named pipe on Windows.
+// Requests are handled one at a time on the thread that the server belongs
+// to.
+class DaemonServer : public QObject {
+  Q_OBJECT
+public:
+  explicit DaemonServer(DaemonRequestHandler& handler,
+                        QObject* parent = nullptr);
+
+  // Returns false if the server couldn't listen on the socket, e.g. because
+  // another daemon is already listening on it.
+  bool listen(const QString& socketName);
+  QString errorString() const;
+
+private:
+  static constexpr int CONNECTION_TIMEOUT_MS = 1000;
+  static constexpr qint64 MAX_REQUEST_SIZE = 1024 * 1024;
+
+  DaemonRequestHandler& handler;
+  QLocalServer* server{new QLocalServer(this)};
+
+  void handleNewConnection();
+  void handleReadyRead(QLocalSocket* socket);
+};
+}
+
+#endif
@@ -0,0 +1,326 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/daemon/request_handler.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonValue>
+#include <algorithm>
+
+#include "gui/plugin_item.h"
+#include "gui/state/game/condition_cache.h"
+#include "gui/state/logging.h"
+
+namespace loot {
+std::optional<std::string> getDaemonRequestString(const QJsonObject& request,
+                                                  const QString& key) {
+  const auto value = request.value(key);
+  if (!value.isString()) {
+    return std::nullopt;
+  }
+
+  return value.toString().toStdString();
+}
+
+QString getDaemonMessageType(MessageType type) {
+  switch (type) {
+    case MessageType::say:
+      return "say";
+    case MessageType::warn:
+      return "warn";
+    case MessageType::error:
+      return "error";
+    default:
+      throw std::logic_error("Unrecognised message type");
+  }
+}
+
+QJsonArray toDaemonPluginsArray(const std::vector<std::string>& pluginNames) {
+  QJsonArray array;
+  for (const auto& pluginName : pluginNames) {
+    array.append(QString::fromStdString(pluginName));
+  }
+
+  return array;
+}
+
+QJsonArray toDaemonMessagesArray(const std::vector<SimpleMessage>& messages) {
+  QJsonArray array;
+  for (const auto& message : messages) {
+    array.append(QJsonObject{
+        {"type", getDaemonMessageType(message.type)},
+        {"text", QString::fromStdString(message.text)},
+    });
+  }
+
+  return array;
+}
+
+void appendDaemonDirectoryPaths(std::vector<std::filesystem::path>& paths,
+                                const std::filesystem::path& directoryPath) {
+  paths.push_back(directoryPath);
+
+  std::error_code errorCode;
+  std::filesystem::directory_iterator it(directoryPath, errorCode);
+  if (errorCode) {
+    return;
+  }
+
+  std::vector<std::filesystem::path> entryPaths;
+  for (; it != std::filesystem::directory_iterator();
+       it.increment(errorCode)) {
+    if (errorCode) {
+      break;
+    }
+    entryPaths.push_back(it->path());
+  }
+
+  // The fingerprint depends on the order of its paths, but the order of
+  // directory entries is unspecified.
+  std::sort(entryPaths.begin(), entryPaths.end());
+
+  paths.insert(paths.end(), entryPaths.begin(), entryPaths.end());
+}
+
+DaemonRequestHandler::LoadedGame::LoadedGame(gui::Game&& game) :
+    game(std::move(game)) {}
+
+DaemonRequestHandler::DaemonRequestHandler(
+    std::vector<GameSettings> gamesSettings,
+    std::filesystem::path lootDataPath,
+    std::filesystem::path preludePath,
+    std::string language) :
+    gamesSettings_(std::move(gamesSettings)),
+    lootDataPath_(std::move(lootDataPath)),
+    preludePath_(std::move(preludePath)),
+    language_(std::move(language)) {}
+
+QByteArray DaemonRequestHandler::handleRequest(const QByteArray& request) {
+  auto logger = getLogger();
+
+  QJsonObject response;
+  QJsonValue id;
+  try {
+    QJsonParseError parseError;
+    const auto document = QJsonDocument::fromJson(request, &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+      throw std::runtime_error("The request is not valid JSON: " +
+                               parseError.errorString().toStdString());
+    }
+    if (!document.isObject()) {
+      throw std::runtime_error("The request is not a JSON object.");
+    }
+
+    id = document.object().value("id");
+    response = handleCommand(document.object());
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to handle a daemon request. Details: {}",
+                    e.what());
+    }
+    response = QJsonObject{{"error", QString::fromStdString(e.what())}};
+  }
+
+  if (!id.isUndefined()) {
+    response.insert("id", id);
+  }
+
+  return QJsonDocument(response).toJson(QJsonDocument::Compact);
+}
+
+QJsonObject DaemonRequestHandler::handleCommand(const QJsonObject& request) {
+  const auto command = getDaemonRequestString(request, "command");
+  if (!command.has_value()) {
+    throw std::runtime_error("The request has no \"command\" string.");
+  }
+
+  if (command != "sort" && command != "getLoadOrder" &&
+      command != "getMessages" && command != "refresh") {
+    throw std::runtime_error("Unrecognised command: " + command.value());
+  }
+
+  const auto gameFolder = getDaemonRequestString(request, "game");
+  if (!gameFolder.has_value()) {
+    throw std::runtime_error("The request has no \"game\" string.");
+  }
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->debug("Handling daemon request to {} for game with folder {}",
+                  command.value(),
+                  gameFolder.value());
+  }
+
+  if (command == "refresh") {
+    const auto it = loadedGames_.find(gameFolder.value());
+    if (it == loadedGames_.end()) {
+      getLoadedGame(gameFolder.value());
+    } else {
+      loadGameData(it->second);
+    }
+
+    return QJsonObject();
+  }
+
+  auto& loadedGame = getLoadedGame(gameFolder.value());
+
+  if (command == "sort") {
+    return sort(loadedGame);
+  }
+
+  if (command == "getLoadOrder") {
+    return QJsonObject{
+        {"plugins", toDaemonPluginsArray(loadedGame.game.GetLoadOrder())}};
+  }
+
+  return getMessages(loadedGame, getDaemonRequestString(request, "plugin"));
+}
+
+DaemonRequestHandler::LoadedGame& DaemonRequestHandler::getLoadedGame(
+    const std::string& folderName) {
+  auto it = loadedGames_.find(folderName);
+  if (it != loadedGames_.end()) {
+    if (getFilesFingerprint(it->second.game) != it->second.filesFingerprint) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->info("The files of the game with folder {} have changed.",
+                     folderName);
+      }
+
+      loadGameData(it->second);
+    }
+
+    return it->second;
+  }
+
+  const auto settings = std::find_if(gamesSettings_.begin(),
+                                     gamesSettings_.end(),
+                                     [&](const GameSettings& gameSettings) {
+                                       return gameSettings.FolderName() ==
+                                              folderName;
+                                     });
+  if (settings == gamesSettings_.end()) {
+    throw std::runtime_error("The game with folder \"" + folderName +
+                             "\" is not installed.");
+  }
+
+  gui::Game game(*settings, lootDataPath_, preludePath_);
+  game.Init();
+
+  it = loadedGames_.try_emplace(folderName, std::move(game)).first;
+
+  try {
+    loadGameData(it->second);
+  } catch (...) {
+    // Don't keep a game that has no data loaded.
+    loadedGames_.erase(it);
+    throw;
+  }
+
+  return it->second;
+}
+
+uint64_t DaemonRequestHandler::getFilesFingerprint(
+    const gui::Game& game) const {
+  const auto& settings = game.GetSettings();
+
+  // The game path holds the ini files that some games' load orders are read
+  // from, and the local path holds the other games' load order files.
+  std::vector<std::filesystem::path> paths;
+  appendDaemonDirectoryPaths(paths, settings.GamePath());
+  appendDaemonDirectoryPaths(paths, settings.DataPath());
+  appendDaemonDirectoryPaths(paths, settings.GameLocalPath());
+  paths.push_back(game.MasterlistPath());
+  paths.push_back(game.UserlistPath());
+  paths.push_back(preludePath_);
+
+  return GetPathsFingerprint(paths);
+}
+
+void DaemonRequestHandler::loadGameData(LoadedGame& loadedGame) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Loading the plugins and metadata of the game with folder {}",
+                 loadedGame.game.GetSettings().FolderName());
+  }
+
+  // Get the fingerprint first so that files changed while the game is being
+  // loaded cause it to be loaded again.
+  loadedGame.filesFingerprint = getFilesFingerprint(loadedGame.game);
+  loadedGame.sortedPlugins = std::nullopt;
+
+  loadedGame.game.ClearMessages();
+  loadedGame.game.LoadAllInstalledPlugins(true);
+  loadedGame.game.LoadCreationClubPluginNames();
+  loadedGame.game.LoadMetadata();
+}
+
+QJsonObject DaemonRequestHandler::sort(LoadedGame& loadedGame) {
+  const auto isCached = loadedGame.sortedPlugins.has_value();
+  if (!isCached) {
+    auto sortedPlugins = loadedGame.game.SortPlugins();
+
+    // The sorted load order is empty if sorting failed.
+    if (!sortedPlugins.empty()) {
+      loadedGame.sortedPlugins = std::move(sortedPlugins);
+    }
+  }
+
+  auto response = getMessages(loadedGame, std::nullopt);
+
+  if (loadedGame.sortedPlugins.has_value()) {
+    response.insert("plugins",
+                    toDaemonPluginsArray(loadedGame.sortedPlugins.value()));
+    response.insert("cached", isCached);
+  } else {
+    response.insert("error",
+                    "Failed to sort plugins, the messages may have details.");
+  }
+
+  return response;
+}
+
+QJsonObject DaemonRequestHandler::getMessages(
+    const LoadedGame& loadedGame,
+    const std::optional<std::string>& pluginName) const {
+  if (!pluginName.has_value()) {
+    const auto messages =
+        ToSimpleMessages(loadedGame.game.GetMessages(), language_);
+
+    return QJsonObject{{"messages", toDaemonMessagesArray(messages)}};
+  }
+
+  const auto plugin = loadedGame.game.GetPlugin(pluginName.value());
+  if (!plugin) {
+    throw std::runtime_error("The plugin \"" + pluginName.value() +
+                             "\" is not installed.");
+  }
+
+  const auto item = PluginItem(*plugin, loadedGame.game, language_);
+
+  return QJsonObject{{"messages", toDaemonMessagesArray(item.messages)}};
+}
+}
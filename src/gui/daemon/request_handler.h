@@ -0,0 +1,103 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_DAEMON_REQUEST_HANDLER
+#define LOOT_GUI_DAEMON_REQUEST_HANDLER
+
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonObject>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/state/game/game.h"
+#include "gui/state/game/game_settings.h"
+
+namespace loot {
+// Handles the JSON requests that LOOT's headless daemon receives. Requests
+// are objects with a "command" string and a "game" string that gives the
+// folder name of the installed game to act on. The supported commands are:
+//
+// - "sort" responds with the sorted load order as a "plugins" array and the
+//   game's general messages as a "messages" array. The sorted load order is
+//   not applied. The response's "cached" boolean is true if the result of
+//   an earlier sort was reused because none of the game's files changed.
+// - "getLoadOrder" responds with the current load order as a "plugins" array.
+// - "getMessages" responds with a "messages" array, holding the messages for
+//   the plugin named by the request's "plugin" string if there is one, and
+//   the game's general messages otherwise.
+// - "refresh" reloads the game's plugins and metadata.
+//
+// Any "id" value in a request is copied into its response, and a response
+// has an "error" string if its request couldn't be handled.
+//
+// A game is loaded when it's first requested and then kept loaded. Before
+// each request is handled, the size and modification time of the game's
+// plugins, load order files and metadata lists are checked, and the game is
+// only reloaded if one of them has changed. Files that metadata conditions
+// read from subdirectories aren't checked, so "refresh" should be used after
+// changing them.
+class DaemonRequestHandler {
+public:
+  DaemonRequestHandler(std::vector<GameSettings> gamesSettings,
+                       std::filesystem::path lootDataPath,
+                       std::filesystem::path preludePath,
+                       std::string language);
+
+  QByteArray handleRequest(const QByteArray& request);
+
+private:
+  struct LoadedGame {
+    explicit LoadedGame(gui::Game&& game);
+
+    gui::Game game;
+    uint64_t filesFingerprint{0};
+    // The result of the last successful sort, which stays valid until one of
+    // the game's files changes.
+    std::optional<std::vector<std::string>> sortedPlugins;
+  };
+
+  QJsonObject handleCommand(const QJsonObject& request);
+
+  LoadedGame& getLoadedGame(const std::string& folderName);
+  uint64_t getFilesFingerprint(const gui::Game& game) const;
+  void loadGameData(LoadedGame& loadedGame);
+
+  QJsonObject sort(LoadedGame& loadedGame);
+  QJsonObject getMessages(const LoadedGame& loadedGame,
+                          const std::optional<std::string>& pluginName) const;
+
+  std::vector<GameSettings> gamesSettings_;
+  std::filesystem::path lootDataPath_;
+  std::filesystem::path preludePath_;
+  std::string language_;
+  std::map<std::string, LoadedGame> loadedGames_;
+};
+}
+
+#endif
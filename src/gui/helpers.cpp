@@ -38,10 +38,13 @@
 #include <shlobj.h>
 #include <shlwapi.h>
 #include <windows.h>
+// psapi.h must be included after windows.h.
+#include <psapi.h>
 #else
 #include <mntent.h>
 #include <unicode/uchar.h>
 #include <unicode/unistr.h>
+#include <unistd.h>
 
 #include <cstdio>
 
@@ -52,6 +55,7 @@ using icu::UnicodeString;
 #include <boost/format.hpp>
 #include <boost/locale.hpp>
 #include <fstream>
+#include <random>
 
 #include "gui/state/logging.h"
 
@@ -495,6 +499,33 @@ std::filesystem::path getLocalAppDataPath() {
 #endif
 }
 
+std::optional<size_t> getResidentMemoryUsage() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(
+          GetCurrentProcess(), &counters, sizeof(counters))) {
+    return std::nullopt;
+  }
+
+  return counters.WorkingSetSize;
+#else
+  // The second value in statm is the resident set size in pages.
+  std::ifstream in("/proc/self/statm");
+  size_t totalPages = 0;
+  size_t residentPages = 0;
+  if (!(in >> totalPages >> residentPages)) {
+    return std::nullopt;
+  }
+
+  const auto pageSize = sysconf(_SC_PAGESIZE);
+  if (pageSize <= 0) {
+    return std::nullopt;
+  }
+
+  return residentPages * static_cast<size_t>(pageSize);
+#endif
+}
+
 MessageType mapMessageType(const std::string& type) {
   if (type == "say") {
     return MessageType::say;
@@ -579,4 +610,36 @@ std::string messagesAsMarkdown(const std::vector<SimpleMessage>& messages) {
 
   return content;
 }
+
+void writeFileAtomically(const std::filesystem::path& filePath,
+                         const char* data,
+                         size_t size) {
+  // Give the temporary file a unique name so that concurrent writers of the
+  // same file don't write into each other's temporary files.
+  std::random_device randomDevice;
+  auto tempPath = filePath;
+  tempPath += "." + std::to_string(randomDevice()) + ".tmp";
+
+  std::ofstream out(
+      tempPath,
+      std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(tempPath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  out.write(data, size);
+  out.flush();
+  out.close();
+
+  // Don't replace the existing file if the new data may be incomplete.
+  if (out.fail()) {
+    std::error_code errorCode;
+    std::filesystem::remove(tempPath, errorCode);
+
+    throw std::runtime_error(tempPath.u8string() + " could not be written");
+  }
+
+  std::filesystem::rename(tempPath, filePath);
+}
 }
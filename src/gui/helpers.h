@@ -63,6 +63,16 @@ std::filesystem::path getExecutableDirectory();
 
 std::filesystem::path getLocalAppDataPath();
 
+// Returns the number of bytes of physical memory that the process is using, or
+// nullopt if it could not be determined.
+std::optional<size_t> getResidentMemoryUsage();
+
+// Write the data to a temporary file and then rename it to the given path, so
+// that the file is either replaced completely or not at all.
+void writeFileAtomically(const std::filesystem::path& filePath,
+                         const char* data,
+                         size_t size);
+
 MessageType mapMessageType(const std::string& type);
 
 void CopyToClipboard(const std::string& text);
@@ -27,161 +27,11 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
-#include <boost/locale.hpp>
 #include <variant>
 
 #include "gui/helpers.h"
-#include "gui/state/game/helpers.h"
-#include "gui/state/logging.h"
 
 namespace loot {
-std::optional<PluginMetadata> evaluateMasterlistMetadata(
-    const gui::Game& game,
-    const std::string& pluginName) {
-  try {
-    return game.GetMasterlistMetadata(pluginName, true);
-  } catch (const std::exception& e) {
-    auto logger = getLogger();
-    if (logger) {
-      logger->error(
-          "\"{}\"'s masterlist metadata contains a condition that "
-          "could not be evaluated. Details: {}",
-          pluginName,
-          e.what());
-    }
-
-    PluginMetadata master(pluginName);
-    master.SetMessages({
-        PlainTextMessage(MessageType::error,
-                         (boost::format(boost::locale::translate(
-                              "\"%1%\" contains a condition that could not be "
-                              "evaluated. Details: %2%")) %
-                          pluginName % e.what())
-                             .str()),
-    });
-
-    return master;
-  }
-}
-
-std::optional<PluginMetadata> evaluateUserlistMetadata(
-    const gui::Game& game,
-    const std::string& pluginName) {
-  try {
-    return game.GetUserMetadata(pluginName, true);
-  } catch (const std::exception& e) {
-    auto logger = getLogger();
-    if (logger) {
-      logger->error(
-          "\"{}\"'s user metadata contains a condition that could "
-          "not be evaluated. Details: {}",
-          pluginName,
-          e.what());
-    }
-
-    PluginMetadata user(pluginName);
-    user.SetMessages({
-        PlainTextMessage(MessageType::error,
-                         (boost::format(boost::locale::translate(
-                              "\"%1%\" contains a condition that could not be "
-                              "evaluated. Details: %2%")) %
-                          pluginName % e.what())
-                             .str()),
-    });
-
-    return user;
-  }
-}
-
-std::optional<PluginMetadata> evaluateMetadata(const gui::Game& game,
-                                               const std::string& pluginName) {
-  auto evaluatedMasterlistMetadata =
-      evaluateMasterlistMetadata(game, pluginName);
-  auto evaluatedUserMetadata = evaluateUserlistMetadata(game, pluginName);
-
-  if (!evaluatedMasterlistMetadata.has_value()) {
-    return evaluatedUserMetadata;
-  }
-
-  if (!evaluatedUserMetadata.has_value()) {
-    return evaluatedMasterlistMetadata;
-  }
-
-  evaluatedUserMetadata.value().MergeMetadata(
-      evaluatedMasterlistMetadata.value());
-
-  return evaluatedUserMetadata;
-}
-
-PluginItem::PluginItem(const PluginInterface& plugin,
-                       const gui::Game& game,
-                       std::string language) :
-    name(plugin.GetName()),
-    loadOrderIndex(game.GetActiveLoadOrderIndex(plugin, game.GetLoadOrder())),
-    crc(plugin.GetCRC()),
-    version(plugin.GetVersion()),
-    isActive(game.IsPluginActive(plugin.GetName())),
-    isEmpty(plugin.IsEmpty()),
-    isMaster(plugin.IsMaster()),
-    isLightPlugin(plugin.IsLightPlugin()),
-    loadsArchive(plugin.LoadsArchive()),
-    isCreationClubPlugin(game.IsCreationClubPlugin(plugin)) {
-  auto userMetadata = game.GetUserMetadata(plugin.GetName());
-  if (userMetadata.has_value()) {
-    hasUserMetadata =
-        userMetadata.has_value() && !userMetadata.value().HasNameOnly();
-  }
-
-  auto evaluatedMetadata = evaluateMetadata(game, plugin.GetName())
-                               .value_or(PluginMetadata(plugin.GetName()));
-
-  isDirty = !evaluatedMetadata.GetDirtyInfo().empty();
-  group = evaluatedMetadata.GetGroup();
-
-  auto evaluatedMessages = evaluatedMetadata.GetMessages();
-  auto validityMessages =
-      game.CheckInstallValidity(plugin, evaluatedMetadata, language);
-  evaluatedMessages.insert(
-      end(evaluatedMessages), begin(validityMessages), end(validityMessages));
-  evaluatedMetadata.SetMessages(evaluatedMessages);
-  messages = ToSimpleMessages(evaluatedMetadata.GetMessages(), language);
-
-  if (!evaluatedMetadata.GetCleanInfo().empty()) {
-    cleaningUtility =
-        evaluatedMetadata.GetCleanInfo().begin()->GetCleaningUtility();
-  }
-
-  for (const auto& tag : plugin.GetBashTags()) {
-    currentTags.push_back(tag.GetName());
-  }
-
-  for (const auto& tag : evaluatedMetadata.GetTags()) {
-    if (tag.IsAddition()) {
-      addTags.push_back(tag.GetName());
-    } else {
-      removeTags.push_back(tag.GetName());
-    }
-  }
-
-  locations = evaluatedMetadata.GetLocations();
-
-  // Set numbered names for locations with no existing name so that URLs
-  // don't appear in the UI.
-  if (locations.size() == 1 && locations[0].GetName().empty()) {
-    locations[0] =
-        Location(locations[0].GetURL(), boost::locale::translate("Location"));
-  } else if (locations.size() > 1) {
-    for (size_t i = 0; i < locations.size(); i += 1) {
-      if (locations[i].GetName().empty()) {
-        auto locationName =
-            (boost::format(boost::locale::translate("Location %1%")) % (i + 1))
-                .str();
-        locations[i] = Location(locations[i].GetURL(), locationName);
-      }
-    }
-  }
-}
-
 bool PluginItem::containsText(const std::string& text) const {
   if (boost::icontains(name, text)) {
     return true;
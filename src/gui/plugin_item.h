@@ -30,17 +30,113 @@
 #include <loot/plugin_interface.h>
 #include <loot/struct/simple_message.h>
 
+#include <boost/format.hpp>
+#include <boost/locale.hpp>
+#include <chrono>
 #include <optional>
 #include <regex>
 #include <string>
 
+#include "gui/state/game/evaluation_costs.h"
 #include "gui/state/game/game.h"
+#include "gui/state/game/helpers.h"
+#include "gui/state/logging.h"
 
 namespace loot {
+// The game-related functions below and PluginItem's constructors are templated
+// on the game type so that they can be used with gui::Game or with any other
+// type that provides the same metadata lookup functions, e.g. an in-memory
+// game for testing and benchmarking.
+template<typename G>
+std::optional<PluginMetadata> evaluateMasterlistMetadata(
+    const G& game,
+    const std::string& pluginName) {
+  try {
+    return game.GetMasterlistMetadata(pluginName, true);
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error(
+          "\"{}\"'s masterlist metadata contains a condition that "
+          "could not be evaluated. Details: {}",
+          pluginName,
+          e.what());
+    }
+
+    PluginMetadata master(pluginName);
+    master.SetMessages({
+        PlainTextMessage(MessageType::error,
+                         (boost::format(boost::locale::translate(
+                              "\"%1%\" contains a condition that could not be "
+                              "evaluated. Details: %2%")) %
+                          pluginName % e.what())
+                             .str()),
+    });
+
+    return master;
+  }
+}
+
+template<typename G>
+std::optional<PluginMetadata> evaluateUserlistMetadata(
+    const G& game,
+    const std::string& pluginName) {
+  try {
+    return game.GetUserMetadata(pluginName, true);
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error(
+          "\"{}\"'s user metadata contains a condition that could "
+          "not be evaluated. Details: {}",
+          pluginName,
+          e.what());
+    }
+
+    PluginMetadata user(pluginName);
+    user.SetMessages({
+        PlainTextMessage(MessageType::error,
+                         (boost::format(boost::locale::translate(
+                              "\"%1%\" contains a condition that could not be "
+                              "evaluated. Details: %2%")) %
+                          pluginName % e.what())
+                             .str()),
+    });
+
+    return user;
+  }
+}
+
+template<typename G>
+std::optional<PluginMetadata> evaluateMetadata(const G& game,
+                                               const std::string& pluginName) {
+  auto evaluatedMasterlistMetadata =
+      evaluateMasterlistMetadata(game, pluginName);
+  auto evaluatedUserMetadata = evaluateUserlistMetadata(game, pluginName);
+
+  if (!evaluatedMasterlistMetadata.has_value()) {
+    return evaluatedUserMetadata;
+  }
+
+  if (!evaluatedUserMetadata.has_value()) {
+    return evaluatedMasterlistMetadata;
+  }
+
+  evaluatedUserMetadata.value().MergeMetadata(
+      evaluatedMasterlistMetadata.value());
+
+  return evaluatedUserMetadata;
+}
+
 struct PluginItem {
   PluginItem() = default;
+  // Only gets the data that's cheap to get, the rest must be filled in by
+  // calling evaluateDetails().
+  template<typename G>
+  PluginItem(const PluginInterface& plugin, const G& game);
+  template<typename G>
   PluginItem(const PluginInterface& plugin,
-             const gui::Game& game,
+             const G& game,
              std::string language);
 
   std::string name;
@@ -66,6 +162,15 @@ struct PluginItem {
   std::vector<SimpleMessage> messages;
   std::vector<Location> locations;
 
+  // The dirty state, cleaning utility, tags, messages and locations are only
+  // set once the plugin's metadata has been evaluated.
+  bool detailsEvaluated{false};
+
+  template<typename G>
+  void evaluateDetails(const PluginInterface& plugin,
+                       const G& game,
+                       const std::string& language);
+
   bool containsText(const std::string& text) const;
   bool containsMatchingText(const std::regex& regex) const;
 
@@ -78,6 +183,127 @@ struct PluginItem {
 
   std::string loadOrderIndexText() const;
 };
+
+template<typename G>
+PluginItem::PluginItem(const PluginInterface& plugin, const G& game) :
+    name(plugin.GetName()),
+    loadOrderIndex(game.GetActiveLoadOrderIndex(plugin, game.GetLoadOrder())),
+    crc(plugin.GetCRC()),
+    version(plugin.GetVersion()),
+    isActive(game.IsPluginActive(plugin.GetName())),
+    isEmpty(plugin.IsEmpty()),
+    isMaster(plugin.IsMaster()),
+    isLightPlugin(plugin.IsLightPlugin()),
+    loadsArchive(plugin.LoadsArchive()),
+    isCreationClubPlugin(game.IsCreationClubPlugin(plugin)) {
+  auto userMetadata = game.GetUserMetadata(plugin.GetName());
+  if (userMetadata.has_value()) {
+    hasUserMetadata =
+        userMetadata.has_value() && !userMetadata.value().HasNameOnly();
+    group = userMetadata.value().GetGroup();
+  }
+
+  // Groups can't be conditional, so there's no need to evaluate metadata to
+  // get a plugin's group.
+  if (!group.has_value()) {
+    auto masterlistMetadata = game.GetMasterlistMetadata(plugin.GetName());
+    if (masterlistMetadata.has_value()) {
+      group = masterlistMetadata.value().GetGroup();
+    }
+  }
+}
+
+template<typename G>
+PluginItem::PluginItem(const PluginInterface& plugin,
+                       const G& game,
+                       std::string language) :
+    PluginItem(plugin, game) {
+  evaluateDetails(plugin, game, language);
+}
+
+template<typename G>
+void PluginItem::evaluateDetails(const PluginInterface& plugin,
+                                 const G& game,
+                                 const std::string& language) {
+  if (detailsEvaluated) {
+    return;
+  }
+
+  // Time each stage so that slow refreshes can be attributed to the plugins
+  // responsible for them.
+  PluginEvaluationCost cost;
+  cost.pluginName = plugin.GetName();
+  auto stageStartTime = std::chrono::steady_clock::now();
+  const auto endStage = [&stageStartTime](std::chrono::nanoseconds& duration) {
+    const auto now = std::chrono::steady_clock::now();
+    duration = now - stageStartTime;
+    stageStartTime = now;
+  };
+
+  auto evaluatedMetadata = evaluateMetadata(game, plugin.GetName())
+                               .value_or(PluginMetadata(plugin.GetName()));
+  endStage(cost.metadataEvaluation);
+
+  isDirty = !evaluatedMetadata.GetDirtyInfo().empty();
+  group = evaluatedMetadata.GetGroup();
+
+  auto evaluatedMessages = evaluatedMetadata.GetMessages();
+  auto validityMessages =
+      game.CheckInstallValidity(plugin, evaluatedMetadata, language);
+  endStage(cost.installValidityCheck);
+
+  const auto bashTagsFileMessages =
+      game.CheckBashTagsFile(plugin, evaluatedMetadata);
+  endStage(cost.bashTagsFileCheck);
+
+  evaluatedMessages.insert(
+      end(evaluatedMessages), begin(validityMessages), end(validityMessages));
+  evaluatedMessages.insert(end(evaluatedMessages),
+                           begin(bashTagsFileMessages),
+                           end(bashTagsFileMessages));
+  evaluatedMetadata.SetMessages(evaluatedMessages);
+  messages = ToSimpleMessages(evaluatedMetadata.GetMessages(), language);
+  endStage(cost.messageConversion);
+
+  if (!evaluatedMetadata.GetCleanInfo().empty()) {
+    cleaningUtility =
+        evaluatedMetadata.GetCleanInfo().begin()->GetCleaningUtility();
+  }
+
+  for (const auto& tag : plugin.GetBashTags()) {
+    currentTags.push_back(tag.GetName());
+  }
+
+  for (const auto& tag : evaluatedMetadata.GetTags()) {
+    if (tag.IsAddition()) {
+      addTags.push_back(tag.GetName());
+    } else {
+      removeTags.push_back(tag.GetName());
+    }
+  }
+  endStage(cost.tagCollection);
+  game.GetEvaluationCosts().RecordPlugin(cost);
+
+  locations = evaluatedMetadata.GetLocations();
+
+  // Set numbered names for locations with no existing name so that URLs
+  // don't appear in the UI.
+  if (locations.size() == 1 && locations[0].GetName().empty()) {
+    locations[0] =
+        Location(locations[0].GetURL(), boost::locale::translate("Location"));
+  } else if (locations.size() > 1) {
+    for (size_t i = 0; i < locations.size(); i += 1) {
+      if (locations[i].GetName().empty()) {
+        auto locationName =
+            (boost::format(boost::locale::translate("Location %1%")) % (i + 1))
+                .str();
+        locations[i] = Location(locations[i].GetURL(), locationName);
+      }
+    }
+  }
+
+  detailsEvaluated = true;
+}
 }
 
 #endif
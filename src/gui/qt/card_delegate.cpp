@@ -25,11 +25,27 @@
 
 #include "gui/qt/card_delegate.h"
 
+#include <QtCore/QCryptographicHash>
+#include <QtGui/QGuiApplication>
+#include <QtGui/QScreen>
+
 #include "gui/qt/counters.h"
 #include "gui/qt/plugin_item_model.h"
 #include "gui/state/logging.h"
 
 namespace loot {
+// Cards are measured with these fixed rules instead of the theme stylesheet,
+// so that changing the theme doesn't invalidate measured sizes or repolish
+// the hidden cards that are measured. They're the only theme rules that
+// affect card sizes, and they're the same in all the built-in themes.
+static constexpr const char* SIZING_STYLE_SHEET =
+    "QLabel#card-title { font-size: 10.1pt; }"
+    "QLabel#plugin-crc, QLabel#plugin-version { margin-left: 16px; }";
+
+// Each card usually only gets measured at one or two viewport widths, this
+// just stops the cache growing while the window is being resized.
+static constexpr size_t MAX_HEIGHTS_PER_CARD = 16;
+
 std::vector<std::string> getMessageTexts(
     const std::vector<SimpleMessage>& messages) {
   std::vector<std::string> texts;
@@ -100,19 +116,78 @@ SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
                             true);
   } else {
     auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+    auto strings =
+        index.data(DisplayStringsRole).value<PluginItemDisplayStrings>();
     auto filters =
         index.data(CardContentFiltersRole).value<CardContentFiltersState>();
 
+    if (filters.hideBashTags) {
+      strings.currentTags.clear();
+      strings.addTags.clear();
+      strings.removeTags.clear();
+    }
+
     return SizeHintCacheKey(
-        getTagsText(pluginItem.currentTags, filters.hideBashTags),
-        getTagsText(pluginItem.addTags, filters.hideBashTags),
-        getTagsText(pluginItem.removeTags, filters.hideBashTags),
+        strings.currentTags,
+        strings.addTags,
+        strings.removeTags,
         getMessageTexts(filterMessages(pluginItem.messages, filters)),
         getLocationNames(pluginItem.locations, filters.hideLocations),
         false);
   }
 }
 
+uint64_t getContentHash(const SizeHintCacheKey& key) {
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+
+  // Separate each string with a null byte and each field with a byte that
+  // can't appear in UTF-8 text so that different keys can't serialise to the
+  // same bytes.
+  static constexpr char STRING_SEPARATOR = '\0';
+  static constexpr char FIELD_SEPARATOR = '\xFF';
+
+  const auto addString = [&](const QByteArray& string) {
+    hash.addData(string);
+    hash.addData(&STRING_SEPARATOR, 1);
+  };
+  const auto addStrings = [&](const std::vector<std::string>& strings) {
+    for (const auto& string : strings) {
+      addString(QByteArray::fromStdString(string));
+    }
+    hash.addData(&FIELD_SEPARATOR, 1);
+  };
+
+  addString(std::get<0>(key).toUtf8());
+  addString(std::get<1>(key).toUtf8());
+  addString(std::get<2>(key).toUtf8());
+  addStrings(std::get<3>(key));
+  addStrings(std::get<4>(key));
+  addString(std::get<5>(key) ? "1" : "0");
+
+  const auto digest = hash.result();
+
+  uint64_t contentHash = 0;
+  for (int i = 0; i < static_cast<int>(sizeof contentHash); i += 1) {
+    contentHash = (contentHash << 8) | static_cast<uint8_t>(digest.at(i));
+  }
+
+  return contentHash;
+}
+
+std::string getCardSizingSignature(const std::string& language) {
+  auto signature = QGuiApplication::font().toString();
+
+  const auto screen = QGuiApplication::primaryScreen();
+  if (screen != nullptr) {
+    signature += ";" + QString::number(screen->devicePixelRatio()) + ";" +
+                 QString::number(screen->logicalDotsPerInch());
+  }
+
+  signature += ";" + QString(SIZING_STYLE_SHEET);
+
+  return signature.toStdString() + ";" + language;
+}
+
 void prepareWidget(QWidget* widget) {
   auto sizePolicy = widget->sizePolicy();
   sizePolicy.setRetainSizeWhenHidden(true);
@@ -141,21 +216,20 @@ GeneralInfoCard* setGeneralInfoCardContent(GeneralInfoCard* card,
 
 PluginCard* setPluginCardContent(PluginCard* card, const QModelIndex& index) {
   auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  auto strings =
+      index.data(DisplayStringsRole).value<PluginItemDisplayStrings>();
   auto filters =
       index.data(CardContentFiltersRole).value<CardContentFiltersState>();
-  auto searchResultData =
-      index.data(SearchResultRole).value<SearchResultData>();
-
-  card->setContent(pluginItem, filters);
 
-  card->setSearchResult(searchResultData.isResult,
-                        searchResultData.isCurrentResult);
+  card->setContent(pluginItem, strings, filters);
 
   return card;
 }
 
 static std::map<QWidget*, int> minWidthByCard;
 
+static constexpr int SEARCH_RESULT_MARKER_WIDTH = 4;
+
 QSize calculateSize(const QWidget* card,
                     const QStyleOptionViewItem& option,
                     int largestMinCardWidth) {
@@ -207,8 +281,10 @@ QSize calculateSize(const QWidget* card,
   return QSize(cardWidth, height);
 }
 
-CardSizingCache::CardSizingCache(QWidget* cardParentWidget) :
-    cardParentWidget(cardParentWidget) {}
+CardSizingCache::CardSizingCache() : cardParentWidget(new QWidget()) {
+  cardParentWidget->setStyleSheet(SIZING_STYLE_SHEET);
+  cardParentWidget->setHidden(true);
+}
 
 void CardSizingCache::update(const QAbstractItemModel* model) {
   update(model, 0, model->rowCount());
@@ -245,43 +321,42 @@ QWidget* CardSizingCache::update(const QModelIndex& index) {
     const auto oldCacheKey = keyCacheIt->second;
     if (*oldCacheKey == newCacheKey) {
       // The cache key hasn't changed, no need to make any changes.
-      // Just return the key's card. It should never be null but handle that
-      // for safety.
+      // Just return the key's card. It may be null if the key's size was
+      // loaded.
       return newCardCacheIt == cardCache.end() ? nullptr
-                                               : newCardCacheIt->second.first;
+                                               : newCardCacheIt->second.card;
     } else {
       // The cache key has changed, get the old key's card cache entry and
       // reduce its count by 1.
       const auto oldCardCacheIt = cardCache.find(*oldCacheKey);
       if (oldCardCacheIt != cardCache.end()) {
-        oldCardCacheIt->second.second -= 1;
+        oldCardCacheIt->second.count -= 1;
 
         // If the old key's count is now 0, remove it from the card cache.
-        if (oldCardCacheIt->second.second == 0) {
+        if (oldCardCacheIt->second.count == 0) {
           cardCache.erase(oldCardCacheIt);
         }
       }
     }
   }
 
-  // If there is no entry for the new cache key, create one.
+  // If there is no entry for the new cache key, create one. A card widget
+  // only needs to be created if there is no loaded size for the key's
+  // content.
   if (newCardCacheIt == cardCache.end()) {
-    QWidget* widget = nullptr;
-    if (index.row() == 0) {
-      widget = setGeneralInfoCardContent(new GeneralInfoCard(cardParentWidget),
-                                         index);
-    } else {
-      widget = setPluginCardContent(new PluginCard(cardParentWidget), index);
-    }
+    CardCacheEntry entry;
+    entry.contentHash = getContentHash(newCacheKey);
 
-    prepareWidget(widget);
+    if (cardSizes.count(entry.contentHash) == 0) {
+      entry.card = createCardWidget(index);
+      recordMinWidth(entry);
+    }
 
-    newCardCacheIt =
-        cardCache.emplace(newCacheKey, std::make_pair(widget, 0)).first;
+    newCardCacheIt = cardCache.emplace(newCacheKey, entry).first;
   }
 
   // Increase the new cache key's usage count by 1.
-  newCardCacheIt->second.second += 1;
+  newCardCacheIt->second.count += 1;
 
   if (keyCacheIt == keyCache.end()) {
     // This row has no cached key, add a pointer to the new key.
@@ -292,22 +367,63 @@ QWidget* CardSizingCache::update(const QModelIndex& index) {
   }
 
   // Return the new cache key entry's card.
-  return newCardCacheIt->second.first;
+  return newCardCacheIt->second.card;
 }
 
 QWidget* CardSizingCache::getCard(const SizeHintCacheKey& key) const {
   auto it = cardCache.find(key);
   if (it != cardCache.end()) {
-    return it->second.first;
+    return it->second.card;
   }
 
   return nullptr;
 }
 
+QWidget* CardSizingCache::createCard(const QModelIndex& index) {
+  if (!index.isValid()) {
+    return nullptr;
+  }
+
+  const auto cacheKey = getSizeHintCacheKey(index);
+  auto it = cardCache.find(cacheKey);
+  if (it == cardCache.end()) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->info(
+          "No cached card exists for row {}, card sizes may not be calculated "
+          "correctly",
+          index.row());
+    }
+
+    update(index);
+
+    it = cardCache.find(cacheKey);
+    if (it == cardCache.end()) {
+      return nullptr;
+    }
+  }
+
+  if (it->second.card == nullptr) {
+    it->second.card = createCardWidget(index);
+    recordMinWidth(it->second);
+  }
+
+  return it->second.card;
+}
+
 int CardSizingCache::getLargestMinWidth() const {
   int largest = 0;
-  for (const auto& [key, value] : cardCache) {
-    const auto minWidth = value.first->layout()->minimumSize().width();
+  for (const auto& [key, entry] : cardCache) {
+    int minWidth = 0;
+    if (entry.card != nullptr) {
+      minWidth = entry.card->layout()->minimumSize().width();
+    } else {
+      const auto sizeIt = cardSizes.find(entry.contentHash);
+      if (sizeIt != cardSizes.end()) {
+        minWidth = sizeIt->second.minWidth;
+      }
+    }
+
     if (minWidth > largest) {
       largest = minWidth;
     }
@@ -316,12 +432,122 @@ int CardSizingCache::getLargestMinWidth() const {
   return largest;
 }
 
+std::optional<QSize> CardSizingCache::getCachedSize(
+    const SizeHintCacheKey& key,
+    int availableWidth) const {
+  const auto entryIt = cardCache.find(key);
+  if (entryIt == cardCache.end()) {
+    return std::nullopt;
+  }
+
+  const auto sizeIt = cardSizes.find(entryIt->second.contentHash);
+  if (sizeIt == cardSizes.end()) {
+    return std::nullopt;
+  }
+
+  // This mirrors the width calculations in calculateSize().
+  const auto widthForHeight = std::max(availableWidth, getLargestMinWidth());
+
+  const auto& cardSize = sizeIt->second;
+  const auto heightIt = cardSize.heightsForWidths.find(widthForHeight);
+  if (heightIt == cardSize.heightsForWidths.end()) {
+    return std::nullopt;
+  }
+
+  return QSize(std::max(availableWidth, cardSize.minWidth), heightIt->second);
+}
+
+void CardSizingCache::storeHeight(const SizeHintCacheKey& key,
+                                  int availableWidth,
+                                  int height) {
+  const auto entryIt = cardCache.find(key);
+  if (entryIt == cardCache.end()) {
+    return;
+  }
+
+  auto& heights = cardSizes[entryIt->second.contentHash].heightsForWidths;
+
+  const auto widthForHeight = std::max(availableWidth, getLargestMinWidth());
+  heights.insert_or_assign(widthForHeight, height);
+
+  if (heights.size() > MAX_HEIGHTS_PER_CARD) {
+    // Drop the narrowest width that isn't the one just measured.
+    const auto eraseIt = heights.begin()->first == widthForHeight
+                             ? std::next(heights.begin())
+                             : heights.begin();
+    heights.erase(eraseIt);
+  }
+}
+
+void CardSizingCache::loadSizes(const std::filesystem::path& filePath,
+                                const std::string& signature) {
+  auto loadedSizes = LoadCardSizes(filePath);
+
+  if (loadedSizes.signature != signature) {
+    // The sizes were measured using different fonts or screen metrics.
+    return;
+  }
+
+  for (auto& cardSize : loadedSizes.sizes) {
+    // Sizes measured in this session take precedence.
+    cardSizes.try_emplace(cardSize.contentHash, std::move(cardSize));
+  }
+}
+
+void CardSizingCache::saveSizes(const std::filesystem::path& filePath,
+                                const std::string& signature) const {
+  // Only save the sizes of cards that are currently in use, so that sizes
+  // for content that no longer exists don't accumulate.
+  CardSizes sizesToSave;
+  sizesToSave.signature = signature;
+
+  for (const auto& [key, entry] : cardCache) {
+    const auto sizeIt = cardSizes.find(entry.contentHash);
+    if (sizeIt != cardSizes.end() &&
+        !sizeIt->second.heightsForWidths.empty()) {
+      sizesToSave.sizes.push_back(sizeIt->second);
+    }
+  }
+
+  SaveCardSizes(filePath, sizesToSave);
+}
+
+QWidget* CardSizingCache::createCardWidget(const QModelIndex& index) {
+  QWidget* widget = nullptr;
+  if (index.row() == 0) {
+    widget = setGeneralInfoCardContent(
+        new GeneralInfoCard(cardParentWidget.get()), index);
+  } else {
+    widget =
+        setPluginCardContent(new PluginCard(cardParentWidget.get()), index);
+  }
+
+  prepareWidget(widget);
+
+  return widget;
+}
+
+void CardSizingCache::recordMinWidth(const CardCacheEntry& entry) {
+  auto& cardSize = cardSizes[entry.contentHash];
+  cardSize.contentHash = entry.contentHash;
+
+  const auto minWidth = entry.card->layout()->minimumSize().width();
+  if (cardSize.minWidth != minWidth) {
+    // Any heights that were measured with a different minimum width are
+    // stale.
+    cardSize.minWidth = minWidth;
+    cardSize.heightsForWidths.clear();
+  }
+}
+
 CardDelegate::CardDelegate(QListView* parent,
                            CardSizingCache& cardSizingCache) :
     QStyledItemDelegate(parent),
     generalInfoCard(new GeneralInfoCard(parent->viewport())),
     pluginCard(new PluginCard(parent->viewport())),
-    cardSizingCache(&cardSizingCache) {
+    cardSizingCache(&cardSizingCache),
+    searchResultBrush(parent->palette().highlight()),
+    currentSearchResultBrush(parent->palette().highlight()) {
   prepareWidget(generalInfoCard);
   prepareWidget(pluginCard);
 }
@@ -333,6 +559,12 @@ void CardDelegate::refreshMessages() {
   pluginCard->refreshMessages();
 }
 
+void CardDelegate::setSearchResultColors(const QColor& resultColor,
+                                         const QColor& currentResultColor) {
+  searchResultBrush = QBrush(resultColor);
+  currentSearchResultBrush = QBrush(currentResultColor);
+}
+
 void CardDelegate::paint(QPainter* painter,
                          const QStyleOptionViewItem& option,
                          const QModelIndex& index) const {
@@ -366,6 +598,21 @@ void CardDelegate::paint(QPainter* painter,
 
   widget->render(painter, QPoint(), QRegion(), QWidget::DrawChildren);
 
+  // Search results are highlighted here instead of by styling the card, as
+  // restyling the card would mean repolishing it on almost every paint.
+  if (index.row() != 0) {
+    const auto searchResultData =
+        index.data(SearchResultRole).value<SearchResultData>();
+
+    if (searchResultData.isResult) {
+      const auto& brush = searchResultData.isCurrentResult
+                              ? currentSearchResultBrush
+                              : searchResultBrush;
+      painter->fillRect(
+          QRect(0, 0, SEARCH_RESULT_MARKER_WIDTH, sizeHint.height()), brush);
+    }
+  }
+
   painter->restore();
 }
 
@@ -397,22 +644,24 @@ QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
     it = sizeHintCache.emplace(cacheKey, QSize()).first;
   }
 
-  auto card = cardSizingCache->getCard(cacheKey);
-  if (card == nullptr) {
-    const auto logger = getLogger();
-    logger->info(
-        "No cached card exists for row {}, card sizes may not be calculated "
-        "correctly",
-        index.row());
-    card = cardSizingCache->update(index);
-  }
+  auto sizeHint =
+      cardSizingCache->getCachedSize(cacheKey, styleOption.rect.width());
+  if (!sizeHint.has_value()) {
+    auto card = cardSizingCache->getCard(cacheKey);
+    if (card == nullptr) {
+      card = cardSizingCache->createCard(index);
+    }
 
-  const auto sizeHint =
-      calculateSize(card, styleOption, cardSizingCache->getLargestMinWidth());
+    sizeHint = calculateSize(
+        card, styleOption, cardSizingCache->getLargestMinWidth());
 
-  it->second = sizeHint;
+    cardSizingCache->storeHeight(
+        cacheKey, styleOption.rect.width(), sizeHint.value().height());
+  }
+
+  it->second = sizeHint.value();
 
-  return sizeHint;
+  return sizeHint.value();
 }
 
 QWidget* CardDelegate::createEditor(QWidget* parent,
@@ -438,7 +687,13 @@ void CardDelegate::setEditorData(QWidget* editor,
   if (index.row() == 0) {
     setGeneralInfoCardContent(qobject_cast<GeneralInfoCard*>(editor), index);
   } else {
-    setPluginCardContent(qobject_cast<PluginCard*>(editor), index);
+    auto card = setPluginCardContent(qobject_cast<PluginCard*>(editor), index);
+
+    // Editors aren't painted by the delegate, so they style themselves.
+    const auto searchResultData =
+        index.data(SearchResultRole).value<SearchResultData>();
+    card->setSearchResult(searchResultData.isResult,
+                          searchResultData.isCurrentResult);
   }
 }
 
@@ -30,10 +30,15 @@
 #include <QtWidgets/QListView>
 #include <QtWidgets/QStyledItemDelegate>
 #include <QtWidgets/QWidget>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 
 #include "gui/qt/general_info_card.h"
 #include "gui/qt/plugin_card.h"
 #include "gui/qt/plugin_item_model.h"
+#include "gui/state/game/card_sizes.h"
 
 namespace loot {
 // SizeHintCacheKey contains all the data that the card size could depend on,
@@ -68,15 +73,30 @@ typedef std::tuple<QString,
                    bool>
     SizeHintCacheKey;
 
+uint64_t getContentHash(const SizeHintCacheKey& key);
+
+// Get a string that identifies everything outside of a card's content that
+// its size depends on.
+std::string getCardSizingSignature(const std::string& language);
+
 /**
  * Whenever the model's raw data changes, this cache needs to be updated for the
  * affected indexes. This update needs to happen before the delegate's paint or
  * size hint methods are called so that they are given the correct largest min
  * width value.
+ *
+ * The cached cards are children of a hidden top-level widget that has its own
+ * stylesheet, so they're not affected by theme changes. Their sizes only
+ * change if fonts or screen metrics change.
+ *
+ * Measured sizes can be saved and loaded so that a later session can lay out
+ * cards without first creating and measuring a widget for every distinct
+ * key. Widgets are then only created for keys whose content hash has no
+ * loaded size, or when a size is needed for a width that wasn't measured.
  */
 class CardSizingCache {
 public:
-  explicit CardSizingCache(QWidget* cardParentWidget);
+  CardSizingCache();
 
   void update(const QAbstractItemModel* model);
   void update(const QModelIndex& topLeft, const QModelIndex& bottomRight);
@@ -85,12 +105,37 @@ public:
 
   QWidget* getCard(const SizeHintCacheKey& key) const;
 
+  // Get the card for the given index, creating it if the index's cache entry
+  // was populated from loaded sizes.
+  QWidget* createCard(const QModelIndex& index);
+
   int getLargestMinWidth() const;
 
+  std::optional<QSize> getCachedSize(const SizeHintCacheKey& key,
+                                     int availableWidth) const;
+
+  void storeHeight(const SizeHintCacheKey& key, int availableWidth, int height);
+
+  void loadSizes(const std::filesystem::path& filePath,
+                 const std::string& signature);
+
+  void saveSizes(const std::filesystem::path& filePath,
+                 const std::string& signature) const;
+
 private:
-  QWidget* cardParentWidget{nullptr};
+  struct CardCacheEntry {
+    QWidget* card{nullptr};
+    uint64_t contentHash{0};
+    unsigned int count{0};
+  };
+
+  std::unique_ptr<QWidget> cardParentWidget;
   std::map<int, const SizeHintCacheKey*> keyCache;
-  std::map<SizeHintCacheKey, std::pair<QWidget*, unsigned int>> cardCache;
+  std::map<SizeHintCacheKey, CardCacheEntry> cardCache;
+  std::unordered_map<uint64_t, CardSize> cardSizes;
+
+  QWidget* createCardWidget(const QModelIndex& index);
+  void recordMinWidth(const CardCacheEntry& entry);
 };
 
 class CardDelegate : public QStyledItemDelegate {
@@ -100,6 +145,8 @@ public:
 
   void setIcons();
   void refreshMessages();
+  void setSearchResultColors(const QColor& resultColor,
+                             const QColor& currentResultColor);
 
   void paint(QPainter* painter,
              const QStyleOptionViewItem& option,
@@ -123,6 +170,8 @@ private:
   PluginCard* pluginCard{nullptr};
   CardSizingCache* cardSizingCache;
   mutable std::map<SizeHintCacheKey, QSize> sizeHintCache;
+  QBrush searchResultBrush;
+  QBrush currentSearchResultBrush;
 };
 }
 
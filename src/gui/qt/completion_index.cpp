@@ -0,0 +1,248 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/completion_index.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace loot {
+static constexpr size_t TRIGRAM_LENGTH = 3;
+
+// Text is padded at its start so that its first characters form trigrams of
+// their own, which lets misspelt text still match names that start the same
+// way.
+static constexpr const char* TRIGRAM_PADDING = "  ";
+static constexpr size_t PADDED_TRIGRAM_COUNT = 2;
+
+// A fuzzy match must share at least a third of the text's trigrams.
+static constexpr size_t MIN_SHARED_TRIGRAMS_DIVISOR = 3;
+
+enum class CompletionMatchType { Prefix, Substring, Fuzzy };
+
+struct CompletionMatch {
+  uint32_t nameIndex{0};
+  CompletionMatchType type{CompletionMatchType::Fuzzy};
+  uint32_t sharedCount{0};
+  double similarity{0};
+};
+
+std::string foldCompletionText(const std::string& text) {
+  std::string folded = text;
+  std::transform(folded.begin(), folded.end(), folded.begin(), [](char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+  });
+
+  return folded;
+}
+
+std::vector<uint32_t> getUniqueTrigrams(const std::string& foldedText) {
+  const auto padded = TRIGRAM_PADDING + foldedText;
+
+  std::vector<uint32_t> trigrams;
+  trigrams.reserve(padded.size());
+  for (size_t i = 0; i + TRIGRAM_LENGTH <= padded.size(); i += 1) {
+    uint32_t trigram = 0;
+    for (size_t j = 0; j < TRIGRAM_LENGTH; j += 1) {
+      trigram = trigram << 8 | static_cast<unsigned char>(padded[i + j]);
+    }
+    trigrams.push_back(trigram);
+  }
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()),
+                 trigrams.end());
+
+  return trigrams;
+}
+
+CompletionIndex::CompletionIndex(std::vector<std::string> namesToIndex) :
+    names(std::move(namesToIndex)) {
+  foldedNames.reserve(names.size());
+  nameTrigramCounts.reserve(names.size());
+
+  for (size_t i = 0; i < names.size(); i += 1) {
+    foldedNames.push_back(foldCompletionText(names[i]));
+
+    const auto trigrams = getUniqueTrigrams(foldedNames.back());
+    nameTrigramCounts.push_back(static_cast<uint32_t>(trigrams.size()));
+
+    for (const auto trigram : trigrams) {
+      trigramNames[trigram].push_back(static_cast<uint32_t>(i));
+    }
+  }
+
+  sortedNameIndexes.resize(names.size());
+  std::iota(sortedNameIndexes.begin(), sortedNameIndexes.end(), 0);
+  std::sort(sortedNameIndexes.begin(),
+            sortedNameIndexes.end(),
+            [this](uint32_t lhs, uint32_t rhs) {
+              return foldedNames[lhs] < foldedNames[rhs];
+            });
+}
+
+size_t CompletionIndex::size() const { return names.size(); }
+
+const std::string& CompletionIndex::getName(size_t nameIndex) const {
+  return names.at(nameIndex);
+}
+
+std::vector<size_t> CompletionIndex::find(const std::string& text,
+                                          size_t maxResults) const {
+  if (text.empty() || maxResults == 0) {
+    return {};
+  }
+
+  const auto foldedText = foldCompletionText(text);
+  if (foldedText.size() < TRIGRAM_LENGTH) {
+    return findByPrefix(foldedText, maxResults);
+  }
+
+  const auto textTrigrams = getUniqueTrigrams(foldedText);
+
+  // Count how many of the text's trigrams each name shares, only visiting
+  // the names that share at least one. The counts are kept in a map so that
+  // the cost of a query depends on how many names match, not on how many
+  // names there are.
+  std::vector<const std::vector<uint32_t>*> postingLists;
+  size_t largestPostingListSize = 0;
+  for (const auto trigram : textTrigrams) {
+    const auto it = trigramNames.find(trigram);
+    if (it != trigramNames.end()) {
+      postingLists.push_back(&it->second);
+      largestPostingListSize =
+          std::max(largestPostingListSize, it->second.size());
+    }
+  }
+
+  std::unordered_map<uint32_t, uint32_t> sharedCounts;
+  sharedCounts.reserve(largestPostingListSize);
+  for (const auto postingList : postingLists) {
+    for (const auto nameIndex : *postingList) {
+      sharedCounts[nameIndex] += 1;
+    }
+  }
+
+  const auto textTrigramCount = textTrigrams.size();
+  const auto minSharedCount =
+      (textTrigramCount + MIN_SHARED_TRIGRAMS_DIVISOR - 1) /
+      MIN_SHARED_TRIGRAMS_DIVISOR;
+  // A name that contains the text shares all its trigrams except perhaps the
+  // padded ones, so only those names need to be searched for the text.
+  const auto minSubstringSharedCount =
+      textTrigramCount > PADDED_TRIGRAM_COUNT
+          ? textTrigramCount - PADDED_TRIGRAM_COUNT
+          : 0;
+
+  std::vector<CompletionMatch> matches;
+  for (const auto& [nameIndex, sharedCount] : sharedCounts) {
+    if (sharedCount < minSharedCount) {
+      continue;
+    }
+
+    CompletionMatch match;
+    match.nameIndex = nameIndex;
+    match.sharedCount = sharedCount;
+
+    if (sharedCount >= minSubstringSharedCount) {
+      const auto position = foldedNames[nameIndex].find(foldedText);
+      if (position == 0) {
+        match.type = CompletionMatchType::Prefix;
+      } else if (position != std::string::npos) {
+        match.type = CompletionMatchType::Substring;
+      }
+    }
+
+    // Use the Jaccard index of the two sets of trigrams to rank names that
+    // share the same number of trigrams, so that shorter names rank higher.
+    match.similarity =
+        static_cast<double>(sharedCount) /
+        (textTrigramCount + nameTrigramCounts[nameIndex] - sharedCount);
+
+    matches.push_back(match);
+  }
+
+  const auto isBetterMatch = [this](const CompletionMatch& lhs,
+                                    const CompletionMatch& rhs) {
+    if (lhs.type != rhs.type) {
+      return lhs.type < rhs.type;
+    }
+
+    // Prefer names that share more of the text.
+    if (lhs.sharedCount != rhs.sharedCount) {
+      return lhs.sharedCount > rhs.sharedCount;
+    }
+
+    if (lhs.similarity != rhs.similarity) {
+      return lhs.similarity > rhs.similarity;
+    }
+
+    // Compare indexes last, as the matches aren't collected in any
+    // particular order.
+    const auto& lhsName = foldedNames[lhs.nameIndex];
+    const auto& rhsName = foldedNames[rhs.nameIndex];
+    if (lhsName != rhsName) {
+      return lhsName < rhsName;
+    }
+
+    return lhs.nameIndex < rhs.nameIndex;
+  };
+
+  // Only the best matches need to be sorted.
+  const auto resultsEnd =
+      matches.begin() + std::min(maxResults, matches.size());
+  std::partial_sort(matches.begin(), resultsEnd, matches.end(), isBetterMatch);
+
+  std::vector<size_t> results;
+  results.reserve(std::distance(matches.begin(), resultsEnd));
+  for (auto it = matches.begin(); it != resultsEnd; ++it) {
+    results.push_back(it->nameIndex);
+  }
+
+  return results;
+}
+
+std::vector<size_t> CompletionIndex::findByPrefix(const std::string& foldedText,
+                                                  size_t maxResults) const {
+  auto it = std::lower_bound(
+      sortedNameIndexes.begin(),
+      sortedNameIndexes.end(),
+      foldedText,
+      [this](uint32_t nameIndex, const std::string& text) {
+        return foldedNames[nameIndex] < text;
+      });
+
+  std::vector<size_t> results;
+  for (; it != sortedNameIndexes.end() && results.size() < maxResults; ++it) {
+    if (foldedNames[*it].compare(0, foldedText.size(), foldedText) != 0) {
+      break;
+    }
+
+    results.push_back(*it);
+  }
+
+  return results;
+}
+}
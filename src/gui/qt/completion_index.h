@@ -0,0 +1,67 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_COMPLETION_INDEX
+#define LOOT_GUI_QT_COMPLETION_INDEX
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace loot {
+// Finds the names that best match some typed text, so that completions can
+// be suggested for text that appears anywhere in a name or that contains
+// typos. Names are indexed by their trigrams, and matching is
+// case-insensitive for ASCII characters.
+class CompletionIndex {
+public:
+  CompletionIndex() = default;
+  explicit CompletionIndex(std::vector<std::string> namesToIndex);
+
+  size_t size() const;
+  const std::string& getName(size_t nameIndex) const;
+
+  // Returns the indexes of up to maxResults names, best match first. Names
+  // that start with the text rank above names that contain it elsewhere,
+  // which rank above names that only share enough of its trigrams. Text
+  // that's shorter than a trigram only matches the start of names.
+  std::vector<size_t> find(const std::string& text, size_t maxResults) const;
+
+private:
+  std::vector<std::string> names;
+  std::vector<std::string> foldedNames;
+  // Name indexes sorted by folded name, for finding names by prefix.
+  std::vector<uint32_t> sortedNameIndexes;
+  std::vector<uint32_t> nameTrigramCounts;
+  // The indexes of the names that contain each trigram, in ascending order.
+  std::unordered_map<uint32_t, std::vector<uint32_t>> trigramNames;
+
+  std::vector<size_t> findByPrefix(const std::string& foldedText,
+                                   size_t maxResults) const;
+};
+}
+
+#endif
@@ -0,0 +1,163 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/evaluation_costs_dialog.h"
+
+#include <QtWidgets/QDialogButtonBox>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QVBoxLayout>
+
+#include "gui/qt/helpers.h"
+
+namespace loot {
+static constexpr int PLUGINS_TABLE_COLUMN_COUNT = 7;
+static constexpr int CONDITIONS_TABLE_COLUMN_COUNT = 3;
+
+QTableWidgetItem* createTextItem(const std::string& text) {
+  auto item = new QTableWidgetItem(QString::fromStdString(text));
+  item->setToolTip(item->text());
+  return item;
+}
+
+// Durations are displayed in milliseconds, and stored as numbers so that the
+// tables sort them numerically.
+QTableWidgetItem* createDurationItem(std::chrono::nanoseconds duration) {
+  const auto milliseconds =
+      std::chrono::duration<double, std::milli>(duration).count();
+
+  auto item = new QTableWidgetItem();
+  item->setData(Qt::DisplayRole, milliseconds);
+  return item;
+}
+
+QTableWidgetItem* createCountItem(size_t count) {
+  auto item = new QTableWidgetItem();
+  item->setData(Qt::DisplayRole, static_cast<qulonglong>(count));
+  return item;
+}
+
+void setupCostsTable(QTableWidget* table, int columnCount) {
+  table->setColumnCount(columnCount);
+  table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  table->setSelectionBehavior(QAbstractItemView::SelectRows);
+  table->verticalHeader()->setVisible(false);
+  table->horizontalHeader()->setStretchLastSection(false);
+  table->horizontalHeader()->setSectionResizeMode(
+      0, QHeaderView::ResizeMode::Stretch);
+}
+
+EvaluationCostsDialog::EvaluationCostsDialog(QWidget* parent) :
+    QDialog(parent) {
+  setupUi();
+}
+
+void EvaluationCostsDialog::setReport(const EvaluationCostReport& report) {
+  // Sorting must be disabled while rows are inserted, or they would be moved
+  // part-way through being filled in.
+  pluginsTable->setSortingEnabled(false);
+  pluginsTable->setRowCount(static_cast<int>(report.slowestPlugins.size()));
+
+  for (int row = 0; row < pluginsTable->rowCount(); row += 1) {
+    const auto& cost = report.slowestPlugins.at(row);
+
+    pluginsTable->setItem(row, 0, createTextItem(cost.pluginName));
+    pluginsTable->setItem(row, 1, createDurationItem(cost.GetTotal()));
+    pluginsTable->setItem(row, 2, createDurationItem(cost.metadataEvaluation));
+    pluginsTable->setItem(
+        row, 3, createDurationItem(cost.installValidityCheck));
+    pluginsTable->setItem(row, 4, createDurationItem(cost.bashTagsFileCheck));
+    pluginsTable->setItem(row, 5, createDurationItem(cost.messageConversion));
+    pluginsTable->setItem(row, 6, createDurationItem(cost.tagCollection));
+  }
+
+  pluginsTable->setSortingEnabled(true);
+  pluginsTable->sortByColumn(1, Qt::DescendingOrder);
+
+  conditionsTable->setSortingEnabled(false);
+  conditionsTable->setRowCount(
+      static_cast<int>(report.mostExpensiveConditions.size()));
+
+  for (int row = 0; row < conditionsTable->rowCount(); row += 1) {
+    const auto& cost = report.mostExpensiveConditions.at(row);
+
+    conditionsTable->setItem(row, 0, createTextItem(cost.condition));
+    conditionsTable->setItem(row, 1, createDurationItem(cost.duration));
+    conditionsTable->setItem(row, 2, createCountItem(cost.evaluationCount));
+  }
+
+  conditionsTable->setSortingEnabled(true);
+  conditionsTable->sortByColumn(1, Qt::DescendingOrder);
+}
+
+void EvaluationCostsDialog::setupUi() {
+  setSizeGripEnabled(true);
+  resize(800, 500);
+
+  setupCostsTable(pluginsTable, PLUGINS_TABLE_COLUMN_COUNT);
+  setupCostsTable(conditionsTable, CONDITIONS_TABLE_COLUMN_COUNT);
+
+  tabWidget->addTab(pluginsTable, QString());
+  tabWidget->addTab(conditionsTable, QString());
+
+  auto buttonBox = new QDialogButtonBox(QDialogButtonBox::Close, this);
+  buttonBox->setObjectName("dialogButtons");
+
+  auto dialogLayout = new QVBoxLayout();
+
+  dialogLayout->addWidget(tabWidget);
+  dialogLayout->addWidget(buttonBox);
+
+  setLayout(dialogLayout);
+
+  translateUi();
+
+  QMetaObject::connectSlotsByName(this);
+}
+
+void EvaluationCostsDialog::translateUi() {
+  setWindowTitle(translate("Evaluation Costs"));
+
+  tabWidget->setTabText(0, translate("Slowest Plugins"));
+  tabWidget->setTabText(1, translate("Most Expensive Conditions"));
+
+  pluginsTable->setHorizontalHeaderLabels({
+      translate("Plugin"),
+      translate("Total (ms)"),
+      translate("Metadata (ms)"),
+      translate("Install Validity (ms)"),
+      translate("BashTags File (ms)"),
+      translate("Messages (ms)"),
+      translate("Tags (ms)"),
+  });
+
+  conditionsTable->setHorizontalHeaderLabels({
+      translate("Condition"),
+      translate("Total (ms)"),
+      translate("Evaluations"),
+  });
+}
+
+void EvaluationCostsDialog::on_dialogButtons_rejected() { reject(); }
+}
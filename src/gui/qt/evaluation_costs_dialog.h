@@ -0,0 +1,59 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_EVALUATION_COSTS_DIALOG
+#define LOOT_GUI_QT_EVALUATION_COSTS_DIALOG
+
+#include <QtWidgets/QDialog>
+#include <QtWidgets/QTabWidget>
+#include <QtWidgets/QTableWidget>
+#include <QtWidgets/QWidget>
+
+#include "gui/state/game/evaluation_costs.h"
+
+namespace loot {
+// Displays the slowest plugins and most expensive metadata conditions to
+// evaluate in sortable tables, for debugging slow refreshes.
+class EvaluationCostsDialog : public QDialog {
+  Q_OBJECT
+public:
+  explicit EvaluationCostsDialog(QWidget *parent);
+
+  void setReport(const EvaluationCostReport &report);
+
+private:
+  QTabWidget *tabWidget{new QTabWidget(this)};
+  QTableWidget *pluginsTable{new QTableWidget(tabWidget)};
+  QTableWidget *conditionsTable{new QTableWidget(tabWidget)};
+
+  void setupUi();
+  void translateUi();
+
+private slots:
+  void on_dialogButtons_rejected();
+};
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include "gui/qt/filters_widget.h"
 
 #include <QtCore/QStringBuilder>
+#include <QtWidgets/QCompleter>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QSpacerItem>
 #include <QtWidgets/QVBoxLayout>
@@ -34,14 +35,55 @@
 #include "gui/state/logging.h"
 
 namespace loot {
+void setupPicker(QComboBox* comboBox) {
+  static constexpr int MINIMUM_CONTENTS_LENGTH = 20;
+
+  // Typing filters the items to those that contain the typed text.
+  comboBox->setEditable(true);
+  comboBox->setInsertPolicy(QComboBox::NoInsert);
+
+  // Don't size the combo box to fit its items, as that means measuring every
+  // item whenever they change.
+  comboBox->setSizeAdjustPolicy(
+      QComboBox::AdjustToMinimumContentsLengthWithIcon);
+  comboBox->setMinimumContentsLength(MINIMUM_CONTENTS_LENGTH);
+
+  auto completer = comboBox->completer();
+  completer->setCompletionMode(QCompleter::PopupCompletion);
+  completer->setFilterMode(Qt::MatchContains);
+  completer->setCaseSensitivity(Qt::CaseInsensitive);
+
+  // Don't leave text that doesn't match an item in the line edit.
+  const auto lineEdit = comboBox->lineEdit();
+  QObject::connect(
+      lineEdit, &QLineEdit::editingFinished, comboBox, [comboBox]() {
+        comboBox->setEditText(comboBox->itemText(comboBox->currentIndex()));
+      });
+}
+
 FiltersWidget::FiltersWidget(QWidget* parent) : QFrame(parent) { setupUi(); }
 
-void FiltersWidget::setPlugins(const std::vector<std::string>& pluginNames) {
-  setComboBoxItems(conflictingPluginsFilter, pluginNames);
+void FiltersWidget::setPluginItemModel(PluginItemModel* pluginItemModel) {
+  conflictingPluginsModel->setSourceModel(pluginItemModel);
+  conflictingPluginsFilter->setCurrentIndex(0);
 }
 
 void FiltersWidget::setGroups(const std::vector<std::string>& groupNames) {
-  setComboBoxItems(groupPluginsFilter, groupNames);
+  // If a group is already selected and it's still present in the new list,
+  // preserve the selection.
+  const auto currentGroupName =
+      groupPluginsFilter->itemText(groupPluginsFilter->currentIndex());
+
+  QStringList items{translate("No group selected")};
+  items.reserve(static_cast<int>(groupNames.size()) + 1);
+  for (const auto& groupName : groupNames) {
+    items.append(QString::fromStdString(groupName));
+  }
+
+  groupsModel->setStringList(items);
+
+  const auto index = groupPluginsFilter->findText(currentGroupName);
+  groupPluginsFilter->setCurrentIndex(index > 0 ? index : 0);
 }
 
 void FiltersWidget::setMessageCounts(size_t hidden, size_t total) {
@@ -61,6 +103,39 @@ void FiltersWidget::resetConflictsAndGroupsFilters() {
   emit pluginFilterChanged(getPluginFiltersState());
 }
 
+void FiltersWidget::setConflictsAndGroupsFilters(
+    const std::optional<std::string>& conflictsPluginName,
+    const std::optional<std::string>& groupName) {
+  const auto conflictsIndex =
+      conflictsPluginName.has_value()
+          ? conflictingPluginsFilter->findText(
+                QString::fromStdString(conflictsPluginName.value()),
+                Qt::MatchExactly)
+          : 0;
+  conflictingPluginsFilter->setCurrentIndex(
+      conflictsIndex > 0 ? conflictsIndex : 0);
+
+  const auto groupIndex =
+      groupName.has_value()
+          ? groupPluginsFilter->findText(
+                QString::fromStdString(groupName.value()), Qt::MatchExactly)
+          : 0;
+  groupPluginsFilter->setCurrentIndex(groupIndex > 0 ? groupIndex : 0);
+}
+
+void FiltersWidget::setContentFilter(const std::string& text, bool isRegex) {
+  contentFilter->setText(QString::fromStdString(text));
+  contentRegexCheckbox->setChecked(isRegex);
+}
+
+std::string FiltersWidget::getContentFilterText() const {
+  return contentFilter->text().toStdString();
+}
+
+bool FiltersWidget::isContentFilterRegex() const {
+  return contentRegexCheckbox->isChecked();
+}
+
 void FiltersWidget::setFilterStates(const LootSettings::Filters& filters) {
   bool hasContentFilterChanged{false};
   bool hasPluginFilterChanged{false};
@@ -150,6 +225,7 @@ void FiltersWidget::setupUi() {
 
   conflictingPluginsFilter->setObjectName("conflictingPluginsFilter");
   groupPluginsFilter->setObjectName("groupPluginsFilter");
+  conflictingPluginsModel->setObjectName("conflictingPluginsModel");
   contentFilter->setObjectName("contentFilter");
   contentRegexCheckbox->setObjectName("contentRegexCheckbox");
   versionNumbersFilter->setObjectName("versionNumbersFilter");
@@ -165,6 +241,14 @@ void FiltersWidget::setupUi() {
   showOnlyWarningsAndErrorsFilter->setObjectName(
       "showOnlyWarningsAndErrorsFilter");
 
+  conflictingPluginsFilter->setModel(conflictingPluginsModel);
+  conflictingPluginsFilter->setModelColumn(
+      PluginItemModel::SIDEBAR_NAME_COLUMN);
+  groupPluginsFilter->setModel(groupsModel);
+
+  setupPicker(conflictingPluginsFilter);
+  setupPicker(groupPluginsFilter);
+
   contentFilter->setClearButtonEnabled(true);
 
   auto verticalSpacer = new QSpacerItem(SPACER_WIDTH,
@@ -247,18 +331,13 @@ void FiltersWidget::translateUi() {
   hiddenPluginsLabel->setText(translate("Hidden plugins:"));
   hiddenMessagesLabel->setText(translate("Hidden messages:"));
 
-  auto conflictingPluginsItemText = translate("No plugin selected");
-  if (conflictingPluginsFilter->count() == 0) {
-    conflictingPluginsFilter->addItem(conflictingPluginsItemText);
-  } else {
-    conflictingPluginsFilter->setItemText(0, conflictingPluginsItemText);
-  }
+  conflictingPluginsModel->setPlaceholderText(translate("No plugin selected"));
 
   auto groupsItemText = translate("No group selected");
-  if (groupPluginsFilter->count() == 0) {
-    groupPluginsFilter->addItem(groupsItemText);
+  if (groupsModel->rowCount() == 0) {
+    groupsModel->setStringList({groupsItemText});
   } else {
-    groupPluginsFilter->setItemText(0, groupsItemText);
+    groupsModel->setData(groupsModel->index(0), groupsItemText);
   }
 
   contentFilter->setPlaceholderText(translate("No text specified"));
@@ -281,28 +360,6 @@ bool FiltersWidget::updateWarningsAndErrorsFilterState() {
   return false;
 }
 
-void FiltersWidget::setComboBoxItems(QComboBox* comboBox,
-                                     const std::vector<std::string>& items) {
-  // If an item is already selected and it's still present in the new
-  // list, preserve the selection.
-  auto currentItem = comboBox->currentText();
-
-  while (comboBox->count() > 1) {
-    comboBox->removeItem(1);
-  }
-
-  auto indexSet = false;
-  for (const auto& item : items) {
-    auto qItem = QString::fromStdString(item);
-    comboBox->addItem(qItem);
-
-    if (!indexSet && qItem == currentItem) {
-      comboBox->setCurrentIndex(comboBox->count() - 1);
-      indexSet = true;
-    }
-  }
-}
-
 CardContentFiltersState FiltersWidget::getCardContentFiltersState() const {
   CardContentFiltersState filters;
 
@@ -326,11 +383,15 @@ PluginFiltersState FiltersWidget::getPluginFiltersState() const {
 
   if (conflictingPluginsFilter->currentIndex() > 0) {
     filters.conflictsPluginName =
-        conflictingPluginsFilter->currentText().toStdString();
+        conflictingPluginsFilter
+            ->itemText(conflictingPluginsFilter->currentIndex())
+            .toStdString();
   }
 
   if (groupPluginsFilter->currentIndex() > 0) {
-    filters.groupName = groupPluginsFilter->currentText().toStdString();
+    filters.groupName =
+        groupPluginsFilter->itemText(groupPluginsFilter->currentIndex())
+            .toStdString();
   }
 
   if (!contentFilter->text().isEmpty()) {
@@ -363,10 +424,40 @@ void FiltersWidget::on_conflictingPluginsFilter_activated() {
     emit conflictsFilterChanged(std::nullopt);
   } else {
     emit conflictsFilterChanged(
-        conflictingPluginsFilter->currentText().toStdString());
+        conflictingPluginsFilter
+            ->itemText(conflictingPluginsFilter->currentIndex())
+            .toStdString());
   }
 }
 
+void FiltersWidget::on_conflictingPluginsModel_rowsAboutToBeRemoved(
+    const QModelIndex&,
+    int first,
+    int last) {
+  // The plugin item model removes and then reinserts all its rows when its
+  // plugins are replaced, so remember the selected plugin so that it can be
+  // reselected if it's still present.
+  const auto currentIndex = conflictingPluginsFilter->currentIndex();
+  if (currentIndex > 0 && currentIndex >= first && currentIndex <= last) {
+    pendingConflictingPluginName =
+        conflictingPluginsFilter->itemText(currentIndex);
+  }
+}
+
+void FiltersWidget::on_conflictingPluginsModel_rowsInserted() {
+  if (pendingConflictingPluginName.isEmpty()) {
+    return;
+  }
+
+  const auto index = conflictingPluginsFilter->findText(
+      pendingConflictingPluginName, Qt::MatchExactly);
+  if (index > 0) {
+    conflictingPluginsFilter->setCurrentIndex(index);
+  }
+
+  pendingConflictingPluginName.clear();
+}
+
 void FiltersWidget::on_groupPluginsFilter_activated() {
   emit pluginFilterChanged(getPluginFiltersState());
 }
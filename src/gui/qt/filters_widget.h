@@ -26,6 +26,7 @@
 #ifndef LOOT_GUI_QT_FILTERS_WIDGET
 #define LOOT_GUI_QT_FILTERS_WIDGET
 
+#include <QtCore/QStringListModel>
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QFrame>
@@ -34,6 +35,8 @@
 #include <QtWidgets/QWidget>
 
 #include "gui/qt/filters_states.h"
+#include "gui/qt/plugin_item_model.h"
+#include "gui/qt/plugin_picker_model.h"
 #include "gui/state/loot_settings.h"
 
 namespace loot {
@@ -42,7 +45,7 @@ class FiltersWidget : public QFrame {
 public:
   explicit FiltersWidget(QWidget *parent);
 
-  void setPlugins(const std::vector<std::string> &pluginNames);
+  void setPluginItemModel(PluginItemModel *pluginItemModel);
   void setGroups(const std::vector<std::string> &groupNames);
 
   void setMessageCounts(size_t hidden, size_t total);
@@ -50,6 +53,16 @@ public:
 
   void resetConflictsAndGroupsFilters();
 
+  // Unlike the user changing these filters, setting them programmatically
+  // doesn't emit any signals.
+  void setConflictsAndGroupsFilters(
+      const std::optional<std::string> &conflictsPluginName,
+      const std::optional<std::string> &groupName);
+  void setContentFilter(const std::string &text, bool isRegex);
+
+  std::string getContentFilterText() const;
+  bool isContentFilterRegex() const;
+
   void setFilterStates(const LootSettings::Filters &filters);
   LootSettings::Filters getFilterSettings() const;
 
@@ -84,6 +97,10 @@ private:
   QLabel *hiddenPluginsCountLabel{new QLabel(this)};
   QLabel *hiddenMessagesLabel{new QLabel(this)};
   QLabel *hiddenMessagesCountLabel{new QLabel(this)};
+  PluginPickerModel *conflictingPluginsModel{new PluginPickerModel(this)};
+  QStringListModel *groupsModel{new QStringListModel(this)};
+
+  QString pendingConflictingPluginName;
 
   LootSettings::Filters warningsAndErrorFilterMemory;
 
@@ -93,10 +110,11 @@ private:
 
   bool updateWarningsAndErrorsFilterState();
 
-  static void setComboBoxItems(QComboBox *comboBox,
-                               const std::vector<std::string> &items);
-
 private slots:
+  void on_conflictingPluginsModel_rowsAboutToBeRemoved(const QModelIndex &,
+                                                       int first,
+                                                       int last);
+  void on_conflictingPluginsModel_rowsInserted();
   void on_conflictingPluginsFilter_activated();
   void on_groupPluginsFilter_activated();
   void on_contentFilter_textChanged();
@@ -0,0 +1,91 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/group_plugins_index.h"
+
+#include <algorithm>
+
+namespace loot {
+std::string getIndexedGroupName(const PluginItem& item) {
+  return item.group.value_or(Group::DEFAULT_NAME);
+}
+
+GroupPluginsIndex::GroupPluginsIndex(const std::vector<PluginItem>& items) {
+  itemGroups.reserve(items.size());
+
+  for (size_t i = 0; i < items.size(); i += 1) {
+    auto groupName = getIndexedGroupName(items.at(i));
+
+    // Items are visited in order, so each group's indexes stay sorted.
+    groupItems[groupName].push_back(i);
+    itemGroups.push_back(std::move(groupName));
+  }
+}
+
+void GroupPluginsIndex::update(size_t itemIndex, const PluginItem& item) {
+  auto groupName = getIndexedGroupName(item);
+  auto& oldGroupName = itemGroups.at(itemIndex);
+  if (groupName == oldGroupName) {
+    return;
+  }
+
+  const auto oldIt = groupItems.find(oldGroupName);
+  if (oldIt != groupItems.end()) {
+    auto& oldIndexes = oldIt->second;
+    const auto it =
+        std::lower_bound(oldIndexes.begin(), oldIndexes.end(), itemIndex);
+    if (it != oldIndexes.end() && *it == itemIndex) {
+      oldIndexes.erase(it);
+    }
+
+    if (oldIndexes.empty()) {
+      groupItems.erase(oldIt);
+    }
+  }
+
+  auto& newIndexes = groupItems[groupName];
+  newIndexes.insert(
+      std::lower_bound(newIndexes.begin(), newIndexes.end(), itemIndex),
+      itemIndex);
+
+  oldGroupName = std::move(groupName);
+}
+
+const std::vector<size_t>& GroupPluginsIndex::getPluginIndexes(
+    const std::string& groupName) const {
+  static const std::vector<size_t> NO_INDEXES;
+
+  const auto it = groupItems.find(groupName);
+  if (it == groupItems.end()) {
+    return NO_INDEXES;
+  }
+
+  return it->second;
+}
+
+size_t GroupPluginsIndex::countPlugins(const std::string& groupName) const {
+  return getPluginIndexes(groupName).size();
+}
+}
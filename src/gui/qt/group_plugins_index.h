@@ -0,0 +1,60 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUP_PLUGINS_INDEX
+#define LOOT_GUI_QT_GROUP_PLUGINS_INDEX
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+// Maps each group name to the indexes of the plugin items in that group, so
+// that finding or counting a group's plugins doesn't involve checking every
+// plugin. Plugins with no group are in the default group.
+class GroupPluginsIndex {
+public:
+  GroupPluginsIndex() = default;
+  explicit GroupPluginsIndex(const std::vector<PluginItem>& items);
+
+  // Records the group of the item at the given index, which must already be
+  // in the index.
+  void update(size_t itemIndex, const PluginItem& item);
+
+  // The indexes are in ascending order.
+  const std::vector<size_t>& getPluginIndexes(
+      const std::string& groupName) const;
+
+  size_t countPlugins(const std::string& groupName) const;
+
+private:
+  std::vector<std::string> itemGroups;
+  std::unordered_map<std::string, std::vector<size_t>> groupItems;
+};
+}
+
+#endif
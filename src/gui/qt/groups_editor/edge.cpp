@@ -53,6 +53,29 @@ Node *Edge::destNode() const { return dest; }
 
 bool Edge::isUserMetadata() const { return isUserMetadata_; }
 
+bool Edge::isInCycle() const { return isInCycle_; }
+
+void Edge::setIsInCycle(bool isInCycle) {
+  isInCycle_ = isInCycle;
+  update();
+}
+
+void Edge::remove() {
+  // Remove this edge: remove it from its source and dest nodes, then remove
+  // it from the scene, then delete the object.
+  qobject_cast<GraphView *>(scene()->parent())->handleEdgeRemoved(this);
+
+  source->removeEdge(this);
+  source->update();
+
+  dest->removeEdge(this);
+  dest->update();
+
+  scene()->removeItem(this);
+  delete this;
+  // DO NOT use "this" past this line.
+}
+
 void Edge::adjust() {
   if (!source || !dest) {
     return;
@@ -102,7 +125,8 @@ void Edge::paint(QPainter *painter,
   }
 
   const auto graphView = qobject_cast<GraphView *>(scene()->parent());
-  const auto color = getDefaultColor(*graphView, isUserMetadata_);
+  const auto color = isInCycle_ ? graphView->getCycleColor()
+                                : getDefaultColor(*graphView, isUserMetadata_);
 
   painter->setPen(
       QPen(color, LINE_WIDTH, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
@@ -116,16 +140,7 @@ void Edge::mousePressEvent(QGraphicsSceneMouseEvent *event) {
     return;
   }
 
-  // Remove this edge: remove it from its source and dest nodes, then remove
-  // it from the scene, then delete the object.
-  source->removeEdge(this);
-  source->update();
-
-  dest->removeEdge(this);
-  dest->update();
-
-  scene()->removeItem(this);
-  delete this;
+  remove();
   // DO NOT use "this" past this line.
 }
 
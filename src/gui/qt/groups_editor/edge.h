@@ -44,6 +44,13 @@ public:
   Node *destNode() const;
   bool isUserMetadata() const;
 
+  bool isInCycle() const;
+  void setIsInCycle(bool isInCycle);
+
+  // Removes this edge from its nodes and the scene and deletes it. The edge
+  // must not be used after calling this.
+  void remove();
+
   void adjust();
 
   enum { Type = UserType + 2 };
@@ -65,6 +72,7 @@ private:
   QPointF destPoint;
 
   bool isUserMetadata_{false};
+  bool isInCycle_{false};
 };
 
 QPolygonF createLineWithArrow(QPointF startPos, QPointF endPos);
@@ -28,37 +28,22 @@
 #include <math.h>
 
 #include <QtCore/QRandomGenerator>
+#include <QtCore/QTimer>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QKeyEvent>
 #include <QtWidgets/QStyle>
+#include <algorithm>
+#include <chrono>
 #include <set>
 
 #include "gui/qt/groups_editor/edge.h"
 #include "gui/qt/groups_editor/layout.h"
 #include "gui/qt/groups_editor/node.h"
+#include "gui/qt/tasks/tasks.h"
+#include "gui/query/types/get_redundant_group_edges_query.h"
 #include "gui/state/logging.h"
 
 namespace loot {
-std::map<std::string, Node *>::iterator insertNode(
-    GraphView *graphView,
-    std::map<std::string, Node *> &map,
-    const std::string &name,
-    bool isUserMetadata,
-    bool containsInstalledPlugins) {
-  auto it = map.find(name);
-  if (it != map.end()) {
-    return it;
-  }
-
-  auto node = new Node(graphView,
-                       QString::fromStdString(name),
-                       isUserMetadata,
-                       containsInstalledPlugins);
-  graphView->scene()->addItem(node);
-
-  return map.emplace(name, node).first;
-}
-
 std::map<std::string, QPointF> convertNodePositions(
     const std::vector<GroupNodePosition> &nodePositions) {
   std::map<std::string, QPointF> map;
@@ -85,6 +70,22 @@ void setNodePositions(const std::vector<Node *> &nodes,
   }
 }
 
+// Get a position that is offset by one layer from the furthest of the given
+// nodes in the offset's direction, at their average height.
+QPointF getNeighbouringPosition(const std::vector<const Node *> &neighbours,
+                                qreal layerOffset) {
+  qreal x = neighbours.front()->scenePos().x();
+  qreal ySum = 0;
+
+  for (const auto neighbour : neighbours) {
+    const auto position = neighbour->scenePos();
+    x = layerOffset > 0 ? std::max(x, position.x()) : std::min(x, position.x());
+    ySum += position.y();
+  }
+
+  return QPointF(x + layerOffset, ySum / neighbours.size());
+}
+
 GraphView::GraphView(QWidget *parent) :
     QGraphicsView(parent),
     masterColor(
@@ -92,7 +93,8 @@ GraphView::GraphView(QWidget *parent) :
     userColor(
         QGuiApplication::palette().color(QPalette::Active, QPalette::Text)),
     backgroundColor(
-        QGuiApplication::palette().color(QPalette::Active, QPalette::Base)) {
+        QGuiApplication::palette().color(QPalette::Active, QPalette::Base)),
+    cycleColor(QColor("#D32F2F")) {
   static constexpr qreal INITIAL_SCALING_FACTOR = 0.8;
   static constexpr int MIN_VIEW_SIZE = 400;
 
@@ -110,71 +112,108 @@ GraphView::GraphView(QWidget *parent) :
 
 void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
                           const std::vector<Group> &userGroups,
-                          const std::set<std::string> &installedPluginGroups,
+                          const GroupPluginsIndex &groupPluginsIndex,
                           const std::vector<GroupNodePosition> &nodePositions) {
   // Remove all existing items.
   scene()->clear();
+  nodesByName_.clear();
+  groupGraphOrder_.clear();
+  cyclicEdges_.clear();
   hasUnsavedLayoutChanges_ = false;
 
-  // Now add the given groups.
-  std::map<std::string, Node *> groupNameNodeMap;
+  // Now add the given groups and the edges that represent all the
+  // dependencies between them.
+  const auto groupGraph =
+      buildGroupGraph(masterlistGroups, userGroups, groupPluginsIndex);
+  applyGroupGraphDiff(diffGroupGraphs(GroupGraph(), groupGraph));
 
-  for (const auto &group : masterlistGroups) {
-    auto name = group.GetName();
-    const auto containsInstalledPlugins = installedPluginGroups.count(name) > 0;
-    insertNode(this, groupNameNodeMap, name, false, containsInstalledPlugins);
+  // Now position the new nodes.
+  doLayout(nodePositions);
+}
+
+void GraphView::applyGroups(
+    const std::vector<Group> &masterlistGroups,
+    const std::vector<Group> &userGroups,
+    const GroupPluginsIndex &groupPluginsIndex,
+    const std::vector<GroupNodePosition> &nodePositions) {
+  if (nodesByName_.empty()) {
+    // There's nothing to keep, so lay out the whole graph.
+    setGroups(
+        masterlistGroups, userGroups, groupPluginsIndex, nodePositions);
+    return;
   }
 
-  for (const auto &group : userGroups) {
-    auto name = group.GetName();
-    const auto containsInstalledPlugins = installedPluginGroups.count(name) > 0;
-    insertNode(this, groupNameNodeMap, name, true, containsInstalledPlugins);
+  const auto diff = diffGroupGraphs(
+      getGroupGraph(),
+      buildGroupGraph(masterlistGroups, userGroups, groupPluginsIndex));
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info(
+        "Updating the groups graph by removing {} nodes and {} edges and "
+        "adding {} nodes and {} edges",
+        diff.removedNodes.size(),
+        diff.removedEdges.size(),
+        diff.addedNodes.size(),
+        diff.addedEdges.size());
   }
 
-  // Now add edges to represent all the dependencies between groups.
-  // A group named in a group's "after" metadata may not exist: if
-  // not, add it as a user group.
-  for (const auto &group : masterlistGroups) {
-    for (const auto &groupName : group.GetAfterGroups()) {
-      auto node = groupNameNodeMap.at(group.GetName());
-      const auto containsInstalledPlugins =
-          installedPluginGroups.count(groupName) > 0;
-      const auto it = insertNode(
-          this, groupNameNodeMap, groupName, true, containsInstalledPlugins);
+  // Nodes that get replaced keep their positions.
+  std::map<std::string, QPointF> positions;
+  for (const auto &name : diff.removedNodes) {
+    positions.emplace(name, nodesByName_.at(name)->scenePos());
+  }
 
-      auto edge = new Edge(it->second, node, false);
-      scene()->addItem(edge);
-    }
+  // Saved positions take precedence, as any nodes that were moved since the
+  // layout was last saved should be put back.
+  for (const auto &position : nodePositions) {
+    positions.insert_or_assign(position.groupName,
+                               QPointF(position.x, position.y));
   }
 
-  for (const auto &group : userGroups) {
-    for (const auto &groupName : group.GetAfterGroups()) {
-      auto node = groupNameNodeMap.at(group.GetName());
-      const auto containsInstalledPlugins =
-          installedPluginGroups.count(groupName) > 0;
-      const auto it = insertNode(
-          this, groupNameNodeMap, groupName, true, containsInstalledPlugins);
+  const auto addedNodes = applyGroupGraphDiff(diff);
 
-      auto edge = new Edge(it->second, node, true);
-      scene()->addItem(edge);
+  for (const auto &[name, node] : nodesByName_) {
+    const auto it = positions.find(name);
+    if (it != positions.end() && node->scenePos() != it->second) {
+      node->setPosition(it->second);
     }
   }
 
-  // Now position the new nodes.
-  doLayout(nodePositions);
+  std::vector<Node *> unplacedNodes;
+  for (const auto node : addedNodes) {
+    if (positions.count(node->getName().toStdString()) == 0) {
+      unplacedNodes.push_back(node);
+    }
+  }
+
+  placeNodesNearNeighbours(unplacedNodes);
+
+  hasUnsavedLayoutChanges_ = false;
 }
 
-bool GraphView::addGroup(const std::string &name) {
-  auto qName = QString::fromStdString(name);
+void GraphView::setTransitiveReductionEnabled(bool enabled) {
+  if (enabled == isTransitiveReductionEnabled_) {
+    return;
+  }
 
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (node && node->getName() == qName) {
-      return false;
-    }
+  isTransitiveReductionEnabled_ = enabled;
+
+  if (enabled) {
+    handleGraphChanged();
+  } else {
+    // Also ignore any reduction that is still being calculated.
+    graphRevision_ += 1;
+    showAllEdges();
   }
+}
 
-  auto node = new Node(this, qName, true, false);
+bool GraphView::addGroup(const std::string &name) {
+  if (groupGraphOrder_.containsNode(name)) {
+    return false;
+  }
+
+  auto node = new Node(this, QString::fromStdString(name), true, 0);
 
   auto pos = mapToScene(width() / 2, height() / 2);
   while (scene()->itemAt(pos, QTransform())) {
@@ -183,6 +222,37 @@ bool GraphView::addGroup(const std::string &name) {
   scene()->addItem(node);
   node->setPosition(pos);
 
+  groupGraphOrder_.addNode(name);
+  nodesByName_.emplace(name, node);
+
+  return true;
+}
+
+bool GraphView::addUserEdge(Node *sourceNode, Node *destNode) {
+  const auto sourceName = sourceNode->getName().toStdString();
+  const auto destName = destNode->getName().toStdString();
+
+  auto logger = getLogger();
+
+  if (!groupGraphOrder_.addEdge(sourceName, destName)) {
+    if (logger) {
+      logger->warn(
+          "Not adding edge from {} to {} because it would create a cycle",
+          sourceName,
+          destName);
+    }
+    return false;
+  }
+
+  if (logger) {
+    logger->info("Adding edge from {} to {}", sourceName, destName);
+  }
+
+  auto edge = new Edge(sourceNode, destNode, true);
+  scene()->addItem(edge);
+
+  handleGraphChanged();
+
   return true;
 }
 
@@ -252,12 +322,37 @@ void GraphView::handleGroupSelected(const QString &name) {
   emit groupSelected(name);
 }
 
+void GraphView::handleEdgeRemoved(Edge *edge) {
+  handleGraphChanged();
+
+  if (cyclicEdges_.erase(edge) > 0) {
+    // Cyclic edges aren't part of the group graph order.
+    return;
+  }
+
+  groupGraphOrder_.removeEdge(edge->sourceNode()->getName().toStdString(),
+                              edge->destNode()->getName().toStdString());
+
+  retryCyclicEdges();
+}
+
+void GraphView::handleNodeRemoved(Node *node) {
+  const auto name = node->getName().toStdString();
+
+  groupGraphOrder_.removeNode(name);
+  nodesByName_.erase(name);
+
+  handleGraphChanged();
+}
+
 QColor GraphView::getMasterColor() const { return masterColor; }
 
 QColor GraphView::getUserColor() const { return userColor; }
 
 QColor GraphView::getBackgroundColor() const { return backgroundColor; }
 
+QColor GraphView::getCycleColor() const { return cycleColor; }
+
 #if QT_CONFIG(wheelevent)
 void GraphView::wheelEvent(QWheelEvent *event) {
   static constexpr double ROTATION_SCALING_FACTOR = 30.0 * 8.0;
@@ -284,6 +379,188 @@ void GraphView::wheelEvent(QWheelEvent *event) {
 }
 #endif
 
+GroupGraph GraphView::getGroupGraph() const {
+  GroupGraph graph;
+
+  for (const auto &[name, node] : nodesByName_) {
+    graph.nodes.emplace(
+        name,
+        GroupGraphNode{node->isUserMetadata(), node->installedPluginCount()});
+
+    for (const auto edge : node->outEdges()) {
+      graph.edges.insert(
+          GroupGraphEdge{name,
+                         edge->destNode()->getName().toStdString(),
+                         edge->isUserMetadata()});
+    }
+  }
+
+  return graph;
+}
+
+std::vector<Node *> GraphView::applyGroupGraphDiff(const GroupGraphDiff &diff) {
+  for (const auto &removedEdge : diff.removedEdges) {
+    const auto sourceNode = nodesByName_.at(removedEdge.fromName);
+
+    // outEdges() returns a copy, so it's safe to remove edges while iterating.
+    for (const auto edge : sourceNode->outEdges()) {
+      if (edge->isUserMetadata() == removedEdge.isUserMetadata &&
+          edge->destNode()->getName().toStdString() == removedEdge.toName) {
+        edge->remove();
+      }
+    }
+  }
+
+  for (const auto &name : diff.removedNodes) {
+    // This also removes the node from nodesByName_.
+    nodesByName_.at(name)->remove();
+  }
+
+  std::vector<Node *> addedNodes;
+  addedNodes.reserve(diff.addedNodes.size());
+
+  for (const auto &[name, properties] : diff.addedNodes) {
+    auto node = new Node(this,
+                         QString::fromStdString(name),
+                         properties.isUserMetadata,
+                         properties.installedPluginCount);
+    scene()->addItem(node);
+
+    nodesByName_.emplace(name, node);
+    groupGraphOrder_.addNode(name);
+    addedNodes.push_back(node);
+  }
+
+  for (const auto &edge : diff.addedEdges) {
+    addEdge(nodesByName_.at(edge.fromName),
+            nodesByName_.at(edge.toName),
+            edge.isUserMetadata);
+  }
+
+  handleGraphChanged();
+
+  return addedNodes;
+}
+
+void GraphView::placeNodesNearNeighbours(const std::vector<Node *> &nodes) {
+  if (nodes.empty()) {
+    return;
+  }
+
+  std::set<const Node *> unplacedNodes(nodes.begin(), nodes.end());
+
+  // Work out which way the existing layout's edges point, so that a new node
+  // can be put on the correct side of its neighbours.
+  qreal edgesXExtent = 0;
+  for (const auto &[name, node] : nodesByName_) {
+    for (const auto edge : node->outEdges()) {
+      const auto destNode = edge->destNode();
+      if (unplacedNodes.count(node) == 0 &&
+          unplacedNodes.count(destNode) == 0) {
+        edgesXExtent += destNode->scenePos().x() - node->scenePos().x();
+      }
+    }
+  }
+  const qreal layerDirection = edgesXExtent < 0 ? -1 : 1;
+  const auto layerOffset = layerDirection * NODE_SPACING;
+
+  // Place nodes in topological order so that the groups a node loads after
+  // are placed before it.
+  for (const auto &name : groupGraphOrder_.getOrder()) {
+    const auto node = nodesByName_.at(name);
+    if (unplacedNodes.count(node) == 0) {
+      continue;
+    }
+
+    std::vector<const Node *> placedSources;
+    for (const auto edge : node->inEdges()) {
+      if (unplacedNodes.count(edge->sourceNode()) == 0) {
+        placedSources.push_back(edge->sourceNode());
+      }
+    }
+
+    std::vector<const Node *> placedDests;
+    for (const auto edge : node->outEdges()) {
+      if (unplacedNodes.count(edge->destNode()) == 0) {
+        placedDests.push_back(edge->destNode());
+      }
+    }
+
+    // Put the node in the layer after the groups it loads after, or failing
+    // that in the layer before the groups that load after it.
+    QPointF position;
+    if (!placedSources.empty()) {
+      position = getNeighbouringPosition(placedSources, layerOffset);
+    } else if (!placedDests.empty()) {
+      position = getNeighbouringPosition(placedDests, -layerOffset);
+    } else {
+      position = mapToScene(width() / 2, height() / 2);
+    }
+
+    node->setPosition(getFreePosition(position, node));
+    unplacedNodes.erase(node);
+  }
+}
+
+QPointF GraphView::getFreePosition(QPointF position, const Node *node) const {
+  const auto isOccupied = [&]() {
+    for (const auto item : scene()->items(position)) {
+      const auto otherNode = qgraphicsitem_cast<Node *>(item);
+      if (otherNode && otherNode != node) {
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  while (isOccupied()) {
+    position.setY(position.y() + NODE_SPACING);
+  }
+
+  return position;
+}
+
+void GraphView::addEdge(Node *sourceNode,
+                        Node *destNode,
+                        bool isUserMetadata) {
+  auto edge = new Edge(sourceNode, destNode, isUserMetadata);
+  scene()->addItem(edge);
+
+  const auto sourceName = sourceNode->getName().toStdString();
+  const auto destName = destNode->getName().toStdString();
+
+  if (!groupGraphOrder_.addEdge(sourceName, destName)) {
+    // The metadata is cyclic, but the edge is still shown so that the user
+    // can see and fix the problem.
+    auto logger = getLogger();
+    if (logger) {
+      logger->warn("The edge from {} to {} is part of a cycle",
+                   sourceName,
+                   destName);
+    }
+
+    edge->setIsInCycle(true);
+    cyclicEdges_.insert(edge);
+  }
+}
+
+void GraphView::retryCyclicEdges() {
+  for (auto it = cyclicEdges_.begin(); it != cyclicEdges_.end();) {
+    auto edge = *it;
+    const auto added =
+        groupGraphOrder_.addEdge(edge->sourceNode()->getName().toStdString(),
+                                 edge->destNode()->getName().toStdString());
+
+    if (added) {
+      edge->setIsInCycle(false);
+      it = cyclicEdges_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
   std::vector<Node *> nodes;
   for (const auto item : scene()->items()) {
@@ -318,9 +595,128 @@ void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
     logger->info("Calculating new graph layout");
   }
 
-  const auto calculatedNodePositions = calculateGraphLayout(nodes);
-  for (const auto &[node, position] : calculatedNodePositions) {
-    node->setPosition(position);
+  std::unordered_map<const Node *, size_t> nodeIndexes;
+  std::vector<QSizeF> nodeSizes;
+  for (const auto node : nodes) {
+    nodeIndexes.emplace(node, nodeSizes.size());
+    nodeSizes.push_back(
+        node->boundingRect().marginsRemoved(Node::MARGINS).size());
+  }
+
+  // Hidden edges are redundant, so leaving them out doesn't change the order
+  // of the layers, but does avoid them adding constraints.
+  std::vector<std::pair<size_t, size_t>> edges;
+  for (const auto node : nodes) {
+    for (const auto edge : node->outEdges()) {
+      if (edge->isVisible()) {
+        edges.emplace_back(nodeIndexes.at(node),
+                           nodeIndexes.at(edge->destNode()));
+      }
+    }
+  }
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  const auto calculatedNodePositions = calculateGraphLayout(nodeSizes, edges);
+  for (size_t i = 0; i < nodes.size(); i += 1) {
+    nodes.at(i)->setPosition(calculatedNodePositions.at(i));
+  }
+
+  if (logger) {
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    logger->info("Laid out {} nodes and {} edges in {} ms",
+                 nodeSizes.size(),
+                 edges.size(),
+                 duration.count());
+  }
+}
+
+void GraphView::handleGraphChanged() {
+  graphRevision_ += 1;
+
+  if (!isTransitiveReductionEnabled_ || isTransitiveReductionQueued_) {
+    return;
+  }
+
+  // Wait for control to return to the event loop, so that a batch of changes
+  // (e.g. removing a node and all its edges) only starts one reduction.
+  isTransitiveReductionQueued_ = true;
+  QTimer::singleShot(0, this, &GraphView::startTransitiveReduction);
+}
+
+void GraphView::startTransitiveReduction() {
+  isTransitiveReductionQueued_ = false;
+
+  if (!isTransitiveReductionEnabled_) {
+    return;
+  }
+
+  // Cyclic edges are always shown, and leaving them out means that the graph
+  // to reduce is acyclic.
+  auto graph = getGroupGraph();
+  for (const auto edge : cyclicEdges_) {
+    graph.edges.erase(
+        GroupGraphEdge{edge->sourceNode()->getName().toStdString(),
+                       edge->destNode()->getName().toStdString(),
+                       edge->isUserMetadata()});
+  }
+
+  const auto revision = graphRevision_;
+  auto task = new QueryTask(
+      std::make_unique<GetRedundantGroupEdgesQuery>(std::move(graph)));
+
+  connect(task, &Task::finished, this, [this, revision](QueryResult result) {
+    if (isTransitiveReductionEnabled_ && revision == graphRevision_) {
+      hideRedundantEdges(std::get<GroupEdgeNames>(result));
+    }
+  });
+  connect(task, &QueryTask::timed, this, [](QueryTiming timing) {
+    const auto logger = getLogger();
+    if (logger) {
+      const auto duration =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              timing.duration);
+      logger->debug("Found redundant groups graph edges in {} ms",
+                    duration.count());
+    }
+  });
+
+  auto executor = new TaskExecutor(this, {task});
+  connect(executor, &TaskExecutor::finished, executor, &QObject::deleteLater);
+
+  executor->start();
+}
+
+void GraphView::hideRedundantEdges(
+    const std::set<std::pair<std::string, std::string>> &redundantEdges) {
+  size_t hiddenEdgeCount = 0;
+  for (const auto &[name, node] : nodesByName_) {
+    for (const auto edge : node->outEdges()) {
+      const auto isRedundant =
+          !edge->isInCycle() &&
+          redundantEdges.count(
+              {name, edge->destNode()->getName().toStdString()}) > 0;
+
+      edge->setVisible(!isRedundant);
+      if (isRedundant) {
+        hiddenEdgeCount += 1;
+      }
+    }
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info("Hiding {} redundant edges in the groups graph",
+                 hiddenEdgeCount);
+  }
+}
+
+void GraphView::showAllEdges() {
+  for (const auto &[name, node] : nodesByName_) {
+    for (const auto edge : node->outEdges()) {
+      edge->setVisible(true);
+    }
   }
 }
 }
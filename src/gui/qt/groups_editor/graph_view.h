@@ -30,10 +30,15 @@
 
 #include <QtWidgets/QGraphicsView>
 #include <set>
+#include <unordered_map>
+#include <utility>
 
+#include "gui/qt/groups_editor/group_graph_diff.h"
+#include "gui/qt/groups_editor/group_graph_order.h"
 #include "gui/state/game/group_node_positions.h"
 
 namespace loot {
+class Edge;
 class Node;
 
 class GraphView : public QGraphicsView {
@@ -42,16 +47,32 @@ class GraphView : public QGraphicsView {
   Q_PROPERTY(QColor userColor MEMBER userColor READ getUserColor)
   Q_PROPERTY(
       QColor backgroundColor MEMBER backgroundColor READ getBackgroundColor)
+  Q_PROPERTY(QColor cycleColor MEMBER cycleColor READ getCycleColor)
 
 public:
   explicit GraphView(QWidget *parent = nullptr);
 
   void setGroups(const std::vector<Group> &masterlistGroups,
                  const std::vector<Group> &userGroups,
-                 const std::set<std::string> &installedPluginGroups,
+                 const GroupPluginsIndex &groupPluginsIndex,
                  const std::vector<GroupNodePosition> &nodePositions);
 
+  // Like setGroups(), but only adds and removes the nodes and edges that
+  // differ from those already displayed, and places new nodes next to their
+  // neighbours instead of laying out the whole graph again.
+  void applyGroups(const std::vector<Group> &masterlistGroups,
+                   const std::vector<Group> &userGroups,
+                   const GroupPluginsIndex &groupPluginsIndex,
+                   const std::vector<GroupNodePosition> &nodePositions);
+
+  // While enabled, edges that aren't part of the transitive reduction of the
+  // group graph are hidden and left out of automatic layouts, but are still
+  // included in the user groups. The reduction is calculated in the
+  // background whenever the graph changes.
+  void setTransitiveReductionEnabled(bool enabled);
+
   bool addGroup(const std::string &name);
+  bool addUserEdge(Node *sourceNode, Node *destNode);
   void autoLayout();
   void registerUserLayoutChange();
 
@@ -60,10 +81,13 @@ public:
   bool hasUnsavedLayoutChanges() const;
 
   void handleGroupSelected(const QString &name);
+  void handleEdgeRemoved(Edge *edge);
+  void handleNodeRemoved(Node *node);
 
   QColor getMasterColor() const;
   QColor getUserColor() const;
   QColor getBackgroundColor() const;
+  QColor getCycleColor() const;
 
 signals:
   void groupSelected(const QString &name);
@@ -79,9 +103,34 @@ private:
   QColor masterColor;
   QColor userColor;
   QColor backgroundColor;
+  QColor cycleColor;
   bool hasUnsavedLayoutChanges_{false};
 
+  // Tracks the order of groups implied by all edges except those in
+  // cyclicEdges_, which are edges loaded from metadata that would create a
+  // cycle, and which are highlighted until they no longer do.
+  GroupGraphOrder groupGraphOrder_;
+  std::set<Edge *> cyclicEdges_;
+  std::unordered_map<std::string, Node *> nodesByName_;
+
+  bool isTransitiveReductionEnabled_{false};
+  bool isTransitiveReductionQueued_{false};
+  // Incremented whenever the graph changes, so that the result of a
+  // transitive reduction of an older graph can be ignored.
+  size_t graphRevision_{0};
+
+  GroupGraph getGroupGraph() const;
+  std::vector<Node *> applyGroupGraphDiff(const GroupGraphDiff &diff);
+  void placeNodesNearNeighbours(const std::vector<Node *> &nodes);
+  QPointF getFreePosition(QPointF position, const Node *node) const;
+  void addEdge(Node *sourceNode, Node *destNode, bool isUserMetadata);
+  void retryCyclicEdges();
   void doLayout(const std::vector<GroupNodePosition> &nodePositions);
+  void handleGraphChanged();
+  void startTransitiveReduction();
+  void hideRedundantEdges(
+      const std::set<std::pair<std::string, std::string>> &redundantEdges);
+  void showAllEdges();
 };
 }
 
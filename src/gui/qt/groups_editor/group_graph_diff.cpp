@@ -0,0 +1,139 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/group_graph_diff.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace loot {
+void insertGroupGraphNode(GroupGraph& graph,
+                          const std::string& name,
+                          bool isUserMetadata,
+                          const GroupPluginsIndex& groupPluginsIndex) {
+  graph.nodes.emplace(
+      name,
+      GroupGraphNode{isUserMetadata, groupPluginsIndex.countPlugins(name)});
+}
+
+bool operator==(const GroupGraphNode& lhs, const GroupGraphNode& rhs) {
+  return lhs.isUserMetadata == rhs.isUserMetadata &&
+         lhs.installedPluginCount == rhs.installedPluginCount;
+}
+
+bool operator!=(const GroupGraphNode& lhs, const GroupGraphNode& rhs) {
+  return !(lhs == rhs);
+}
+
+bool operator<(const GroupGraphEdge& lhs, const GroupGraphEdge& rhs) {
+  return std::tie(lhs.fromName, lhs.toName, lhs.isUserMetadata) <
+         std::tie(rhs.fromName, rhs.toName, rhs.isUserMetadata);
+}
+
+GroupGraph buildGroupGraph(const std::vector<Group>& masterlistGroups,
+                           const std::vector<Group>& userGroups,
+                           const GroupPluginsIndex& groupPluginsIndex) {
+  GroupGraph graph;
+
+  for (const auto& group : masterlistGroups) {
+    insertGroupGraphNode(graph, group.GetName(), false, groupPluginsIndex);
+  }
+
+  for (const auto& group : userGroups) {
+    insertGroupGraphNode(graph, group.GetName(), true, groupPluginsIndex);
+  }
+
+  // A group named in a group's "after" metadata may not exist: if not, add it
+  // as a user group.
+  const auto addEdges = [&](const std::vector<Group>& groups,
+                            bool isUserMetadata) {
+    for (const auto& group : groups) {
+      for (const auto& afterGroupName : group.GetAfterGroups()) {
+        insertGroupGraphNode(graph, afterGroupName, true, groupPluginsIndex);
+
+        graph.edges.insert(
+            GroupGraphEdge{afterGroupName, group.GetName(), isUserMetadata});
+      }
+    }
+  };
+
+  addEdges(masterlistGroups, false);
+  addEdges(userGroups, true);
+
+  return graph;
+}
+
+bool GroupGraphDiff::empty() const {
+  return removedNodes.empty() && addedNodes.empty() && removedEdges.empty() &&
+         addedEdges.empty();
+}
+
+GroupGraphDiff diffGroupGraphs(const GroupGraph& current,
+                               const GroupGraph& target) {
+  GroupGraphDiff diff;
+
+  std::set<std::string> replacedNodes;
+  for (const auto& [name, node] : current.nodes) {
+    const auto it = target.nodes.find(name);
+    if (it == target.nodes.end()) {
+      diff.removedNodes.push_back(name);
+    } else if (it->second != node) {
+      diff.removedNodes.push_back(name);
+      replacedNodes.insert(name);
+    }
+  }
+
+  for (const auto& [name, node] : target.nodes) {
+    const auto it = current.nodes.find(name);
+    if (it == current.nodes.end() || it->second != node) {
+      diff.addedNodes.emplace_back(name, node);
+    }
+  }
+
+  const auto touchesReplacedNode = [&](const GroupGraphEdge& edge) {
+    return replacedNodes.count(edge.fromName) > 0 ||
+           replacedNodes.count(edge.toName) > 0;
+  };
+
+  for (const auto& edge : current.edges) {
+    if (target.edges.count(edge) == 0 || touchesReplacedNode(edge)) {
+      diff.removedEdges.push_back(edge);
+    }
+  }
+
+  for (const auto& edge : target.edges) {
+    if (current.edges.count(edge) == 0 || touchesReplacedNode(edge)) {
+      diff.addedEdges.push_back(edge);
+    }
+  }
+
+  std::stable_partition(
+      diff.addedEdges.begin(),
+      diff.addedEdges.end(),
+      [](const GroupGraphEdge& edge) { return !edge.isUserMetadata; });
+
+  return diff;
+}
+}
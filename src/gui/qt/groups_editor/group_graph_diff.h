@@ -0,0 +1,87 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_DIFF
+#define LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_DIFF
+
+#include <loot/metadata/group.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gui/qt/group_plugins_index.h"
+
+namespace loot {
+struct GroupGraphNode {
+  bool isUserMetadata{false};
+  size_t installedPluginCount{0};
+};
+
+bool operator==(const GroupGraphNode& lhs, const GroupGraphNode& rhs);
+bool operator!=(const GroupGraphNode& lhs, const GroupGraphNode& rhs);
+
+// An edge goes from a group to a group that loads after it.
+struct GroupGraphEdge {
+  std::string fromName;
+  std::string toName;
+  bool isUserMetadata{false};
+};
+
+bool operator<(const GroupGraphEdge& lhs, const GroupGraphEdge& rhs);
+
+// The nodes and edges that the groups editor displays for a set of groups.
+struct GroupGraph {
+  std::map<std::string, GroupGraphNode> nodes;
+  std::set<GroupGraphEdge> edges;
+};
+
+// A group that appears in both masterlist and user metadata is a masterlist
+// node, and a group that is only named in another group's load after
+// metadata is a user node.
+GroupGraph buildGroupGraph(const std::vector<Group>& masterlistGroups,
+                           const std::vector<Group>& userGroups,
+                           const GroupPluginsIndex& groupPluginsIndex);
+
+// The changes needed to turn one group graph into another. A node that is in
+// both graphs but with different properties is replaced, which means it's
+// listed as both removed and added, as are all of its edges.
+struct GroupGraphDiff {
+  std::vector<std::string> removedNodes;
+  std::vector<std::pair<std::string, GroupGraphNode>> addedNodes;
+  std::vector<GroupGraphEdge> removedEdges;
+  // Masterlist edges are listed before user edges, so that if adding them
+  // would create a cycle, it's a user edge that is found to be cyclic.
+  std::vector<GroupGraphEdge> addedEdges;
+
+  bool empty() const;
+};
+
+GroupGraphDiff diffGroupGraphs(const GroupGraph& current,
+                               const GroupGraph& target);
+}
+
+#endif
@@ -0,0 +1,250 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/group_graph_order.h"
+
+#include <algorithm>
+
+namespace loot {
+void removeOne(std::vector<size_t>& ids, size_t id) {
+  const auto it = std::find(ids.begin(), ids.end(), id);
+  if (it != ids.end()) {
+    ids.erase(it);
+  }
+}
+
+void GroupGraphOrder::clear() {
+  nodeIds_.clear();
+  nodeNames_.clear();
+  nodeRemoved_.clear();
+  successors_.clear();
+  predecessors_.clear();
+  nodePositions_.clear();
+  positionNodes_.clear();
+  visitMarks_.clear();
+  currentVisitMark_ = 0;
+}
+
+void GroupGraphOrder::addNode(const std::string& name) {
+  getOrAddNodeId(name);
+}
+
+void GroupGraphOrder::removeNode(const std::string& name) {
+  const auto it = nodeIds_.find(name);
+  if (it == nodeIds_.end()) {
+    return;
+  }
+
+  // The removed node's ID and position are left in place so that no other
+  // node's ID or position needs to change: without any edges, the node
+  // cannot affect the validity of the order.
+  const auto id = it->second;
+  for (const auto successorId : successors_[id]) {
+    removeOne(predecessors_[successorId], id);
+  }
+  for (const auto predecessorId : predecessors_[id]) {
+    removeOne(successors_[predecessorId], id);
+  }
+
+  successors_[id].clear();
+  predecessors_[id].clear();
+  nodeRemoved_[id] = true;
+  nodeIds_.erase(it);
+}
+
+bool GroupGraphOrder::containsNode(const std::string& name) const {
+  return nodeIds_.count(name) > 0;
+}
+
+bool GroupGraphOrder::addEdge(const std::string& fromName,
+                              const std::string& toName) {
+  if (fromName == toName) {
+    return false;
+  }
+
+  // A new node has no edges, so an edge can only create a cycle if both of
+  // its nodes already exist, and so missing nodes are never added for an
+  // edge that then gets rejected.
+  const auto fromId = getOrAddNodeId(fromName);
+  const auto toId = getOrAddNodeId(toName);
+
+  const auto lowerBound = nodePositions_[toId];
+  const auto upperBound = nodePositions_[fromId];
+
+  if (lowerBound < upperBound) {
+    // The new edge goes against the current order. Any nodes reachable from
+    // the destination that currently come no later than the source need to
+    // be moved after all the nodes that can reach the source and which
+    // currently come after the destination. If the source is one of the
+    // reachable nodes, the edge would create a cycle.
+    std::vector<size_t> forwardVisited;
+    if (searchForward(toId, fromId, upperBound, forwardVisited)) {
+      return false;
+    }
+
+    std::vector<size_t> backwardVisited;
+    searchBackward(fromId, lowerBound, backwardVisited);
+
+    reorder(forwardVisited, backwardVisited);
+  }
+
+  successors_[fromId].push_back(toId);
+  predecessors_[toId].push_back(fromId);
+
+  return true;
+}
+
+void GroupGraphOrder::removeEdge(const std::string& fromName,
+                                 const std::string& toName) {
+  const auto fromIt = nodeIds_.find(fromName);
+  const auto toIt = nodeIds_.find(toName);
+  if (fromIt == nodeIds_.end() || toIt == nodeIds_.end()) {
+    return;
+  }
+
+  // Removing an edge can't invalidate the order, so it doesn't need to be
+  // updated.
+  removeOne(successors_[fromIt->second], toIt->second);
+  removeOne(predecessors_[toIt->second], fromIt->second);
+}
+
+std::vector<std::string> GroupGraphOrder::getOrder() const {
+  std::vector<std::string> order;
+  order.reserve(nodeIds_.size());
+
+  for (const auto id : positionNodes_) {
+    if (!nodeRemoved_[id]) {
+      order.push_back(nodeNames_[id]);
+    }
+  }
+
+  return order;
+}
+
+size_t GroupGraphOrder::getOrAddNodeId(const std::string& name) {
+  const auto it = nodeIds_.find(name);
+  if (it != nodeIds_.end()) {
+    return it->second;
+  }
+
+  // New nodes have no edges, so they can be put anywhere in the order: put
+  // them at the end.
+  const auto id = nodeNames_.size();
+  nodeNames_.push_back(name);
+  nodeRemoved_.push_back(false);
+  successors_.emplace_back();
+  predecessors_.emplace_back();
+  nodePositions_.push_back(positionNodes_.size());
+  positionNodes_.push_back(id);
+  visitMarks_.push_back(0);
+
+  nodeIds_.emplace(name, id);
+
+  return id;
+}
+
+bool GroupGraphOrder::searchForward(size_t startId,
+                                    size_t targetId,
+                                    size_t upperBound,
+                                    std::vector<size_t>& visited) {
+  currentVisitMark_ += 1;
+
+  std::vector<size_t> stack{startId};
+  visitMarks_[startId] = currentVisitMark_;
+
+  while (!stack.empty()) {
+    const auto id = stack.back();
+    stack.pop_back();
+    visited.push_back(id);
+
+    for (const auto successorId : successors_[id]) {
+      if (successorId == targetId) {
+        return true;
+      }
+
+      if (visitMarks_[successorId] != currentVisitMark_ &&
+          nodePositions_[successorId] < upperBound) {
+        visitMarks_[successorId] = currentVisitMark_;
+        stack.push_back(successorId);
+      }
+    }
+  }
+
+  return false;
+}
+
+void GroupGraphOrder::searchBackward(size_t startId,
+                                     size_t lowerBound,
+                                     std::vector<size_t>& visited) {
+  currentVisitMark_ += 1;
+
+  std::vector<size_t> stack{startId};
+  visitMarks_[startId] = currentVisitMark_;
+
+  while (!stack.empty()) {
+    const auto id = stack.back();
+    stack.pop_back();
+    visited.push_back(id);
+
+    for (const auto predecessorId : predecessors_[id]) {
+      if (visitMarks_[predecessorId] != currentVisitMark_ &&
+          nodePositions_[predecessorId] > lowerBound) {
+        visitMarks_[predecessorId] = currentVisitMark_;
+        stack.push_back(predecessorId);
+      }
+    }
+  }
+}
+
+void GroupGraphOrder::reorder(std::vector<size_t>& forwardVisited,
+                              std::vector<size_t>& backwardVisited) {
+  const auto comparePositions = [&](size_t lhs, size_t rhs) {
+    return nodePositions_[lhs] < nodePositions_[rhs];
+  };
+
+  std::sort(forwardVisited.begin(), forwardVisited.end(), comparePositions);
+  std::sort(backwardVisited.begin(), backwardVisited.end(), comparePositions);
+
+  // The nodes that can reach the source go first, followed by the nodes
+  // reachable from the destination, each keeping their relative order. They
+  // reuse the positions that they collectively occupied before.
+  std::vector<size_t> nodes;
+  nodes.reserve(backwardVisited.size() + forwardVisited.size());
+  nodes.insert(nodes.end(), backwardVisited.begin(), backwardVisited.end());
+  nodes.insert(nodes.end(), forwardVisited.begin(), forwardVisited.end());
+
+  std::vector<size_t> positions;
+  positions.reserve(nodes.size());
+  for (const auto id : nodes) {
+    positions.push_back(nodePositions_[id]);
+  }
+  std::sort(positions.begin(), positions.end());
+
+  for (size_t i = 0; i < nodes.size(); i += 1) {
+    nodePositions_[nodes[i]] = positions[i];
+    positionNodes_[positions[i]] = nodes[i];
+  }
+}
+}
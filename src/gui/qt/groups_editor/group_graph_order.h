@@ -0,0 +1,90 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_ORDER
+#define LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_ORDER
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace loot {
+// Maintains a topological order of the group graph as edges are added and
+// removed, so that an edge that would introduce a cycle can be detected when
+// it is added instead of when the graph is next used to sort plugins.
+//
+// This uses the dynamic topological sort algorithm described by Pearce and
+// Kelly, which only reorders (and only visits) the nodes that lie between the
+// two ends of a new edge in the current order, so that most edge insertions
+// don't need to walk the whole graph.
+//
+// Edges go from a group to a group that loads after it. Parallel edges are
+// allowed, as a group may load after another group in both masterlist and
+// user metadata.
+class GroupGraphOrder {
+public:
+  void clear();
+
+  void addNode(const std::string& name);
+  void removeNode(const std::string& name);
+  bool containsNode(const std::string& name) const;
+
+  // Returns false and leaves the graph unchanged if adding the edge would
+  // create a cycle. Missing nodes are added.
+  bool addEdge(const std::string& fromName, const std::string& toName);
+  void removeEdge(const std::string& fromName, const std::string& toName);
+
+  // Returns the names of all nodes, in topological order.
+  std::vector<std::string> getOrder() const;
+
+private:
+  std::unordered_map<std::string, size_t> nodeIds_;
+  std::vector<std::string> nodeNames_;
+  std::vector<bool> nodeRemoved_;
+  std::vector<std::vector<size_t>> successors_;
+  std::vector<std::vector<size_t>> predecessors_;
+
+  // nodePositions_ maps node IDs to positions in the order, and
+  // positionNodes_ maps positions back to node IDs.
+  std::vector<size_t> nodePositions_;
+  std::vector<size_t> positionNodes_;
+
+  std::vector<size_t> visitMarks_;
+  size_t currentVisitMark_{0};
+
+  size_t getOrAddNodeId(const std::string& name);
+  bool searchForward(size_t startId,
+                     size_t targetId,
+                     size_t upperBound,
+                     std::vector<size_t>& visited);
+  void searchBackward(size_t startId,
+                      size_t lowerBound,
+                      std::vector<size_t>& visited);
+  void reorder(std::vector<size_t>& forwardVisited,
+               std::vector<size_t>& backwardVisited);
+};
+}
+
+#endif
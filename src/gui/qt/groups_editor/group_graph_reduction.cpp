@@ -0,0 +1,157 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/group_graph_reduction.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace loot {
+// A set of node IDs, with one bit per node.
+class NodeIdBitset {
+public:
+  explicit NodeIdBitset(size_t size) :
+      words_((size + WORD_BITS - 1) / WORD_BITS) {}
+
+  void set(size_t id) { words_.at(id / WORD_BITS) |= getMask(id); }
+
+  bool test(size_t id) const {
+    return (words_.at(id / WORD_BITS) & getMask(id)) != 0;
+  }
+
+  NodeIdBitset& operator|=(const NodeIdBitset& other) {
+    for (size_t i = 0; i < words_.size(); i += 1) {
+      words_[i] |= other.words_[i];
+    }
+
+    return *this;
+  }
+
+private:
+  static constexpr size_t WORD_BITS = 64;
+
+  std::vector<uint64_t> words_;
+
+  static uint64_t getMask(size_t id) {
+    return uint64_t{1} << (id % WORD_BITS);
+  }
+};
+
+std::vector<size_t> getGroupGraphTopologicalOrder(
+    const std::vector<std::vector<size_t>>& successors) {
+  std::vector<size_t> inDegrees(successors.size(), 0);
+  for (const auto& nodeSuccessors : successors) {
+    for (const auto successor : nodeSuccessors) {
+      inDegrees.at(successor) += 1;
+    }
+  }
+
+  std::vector<size_t> order;
+  order.reserve(successors.size());
+  for (size_t id = 0; id < successors.size(); id += 1) {
+    if (inDegrees.at(id) == 0) {
+      order.push_back(id);
+    }
+  }
+
+  // The order vector doubles as the queue of nodes with no unvisited
+  // predecessors.
+  for (size_t i = 0; i < order.size(); i += 1) {
+    for (const auto successor : successors.at(order.at(i))) {
+      inDegrees.at(successor) -= 1;
+      if (inDegrees.at(successor) == 0) {
+        order.push_back(successor);
+      }
+    }
+  }
+
+  if (order.size() != successors.size()) {
+    throw std::invalid_argument("The group graph contains a cycle");
+  }
+
+  return order;
+}
+
+std::set<std::pair<std::string, std::string>> getRedundantGroupEdges(
+    const GroupGraph& graph) {
+  std::unordered_map<std::string, size_t> nodeIds;
+  std::vector<const std::string*> nodeNames;
+  const auto getNodeId = [&](const std::string& name) {
+    const auto [it, inserted] = nodeIds.emplace(name, nodeNames.size());
+    if (inserted) {
+      nodeNames.push_back(&it->first);
+    }
+    return it->second;
+  };
+
+  for (const auto& [name, node] : graph.nodes) {
+    getNodeId(name);
+  }
+
+  std::vector<std::vector<size_t>> successors(nodeNames.size());
+  for (const auto& edge : graph.edges) {
+    const auto fromId = getNodeId(edge.fromName);
+    const auto toId = getNodeId(edge.toName);
+    successors.resize(nodeNames.size());
+    successors.at(fromId).push_back(toId);
+  }
+
+  for (auto& nodeSuccessors : successors) {
+    std::sort(nodeSuccessors.begin(), nodeSuccessors.end());
+    nodeSuccessors.erase(
+        std::unique(nodeSuccessors.begin(), nodeSuccessors.end()),
+        nodeSuccessors.end());
+  }
+
+  const auto order = getGroupGraphTopologicalOrder(successors);
+
+  // Visit nodes in reverse topological order so that each node's successors
+  // already know which nodes they can reach. An edge is redundant if its
+  // destination can be reached from one of its source's other successors.
+  std::vector<NodeIdBitset> reachableNodes(nodeNames.size(),
+                                           NodeIdBitset(nodeNames.size()));
+  std::set<std::pair<std::string, std::string>> redundantEdges;
+  for (auto it = order.rbegin(); it != order.rend(); ++it) {
+    const auto id = *it;
+    auto& reachable = reachableNodes.at(id);
+
+    for (const auto successor : successors.at(id)) {
+      reachable |= reachableNodes.at(successor);
+    }
+
+    for (const auto successor : successors.at(id)) {
+      if (reachable.test(successor)) {
+        redundantEdges.emplace(*nodeNames.at(id), *nodeNames.at(successor));
+      } else {
+        reachable.set(successor);
+      }
+    }
+  }
+
+  return redundantEdges;
+}
+}
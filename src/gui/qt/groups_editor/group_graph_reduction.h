@@ -0,0 +1,47 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_REDUCTION
+#define LOOT_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_REDUCTION
+
+#include <set>
+#include <string>
+#include <utility>
+
+#include "gui/qt/groups_editor/group_graph_diff.h"
+
+namespace loot {
+// Returns the names of the groups at each end of the edges that are not in
+// the transitive reduction of the given graph, i.e. the edges from a group
+// to a group that it can also reach through other groups. Parallel edges are
+// treated as one edge, so either all edges between two groups are redundant
+// or none of them are.
+//
+// Throws if the graph contains a cycle.
+std::set<std::pair<std::string, std::string>> getRedundantGroupEdges(
+    const GroupGraph& graph);
+}
+
+#endif
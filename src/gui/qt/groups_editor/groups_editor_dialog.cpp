@@ -73,10 +73,11 @@ GroupsEditorDialog::GroupsEditorDialog(QWidget* parent,
 void GroupsEditorDialog::setGroups(
     const std::vector<Group>& masterlistGroups,
     const std::vector<Group>& userGroups,
-    const std::set<std::string>& installedPluginGroups,
     const std::vector<GroupNodePosition>& nodePositions) {
-  graphView->setGroups(
-      masterlistGroups, userGroups, installedPluginGroups, nodePositions);
+  graphView->applyGroups(masterlistGroups,
+                         userGroups,
+                         pluginItemModel->getGroupPluginsIndex(),
+                         nodePositions);
   groupPluginsTitle->setVisible(false);
   groupPluginsList->setVisible(false);
 
@@ -111,6 +112,8 @@ void GroupsEditorDialog::setupUi() {
   addGroupButton->setObjectName("addGroupButton");
   addGroupButton->setDisabled(true);
 
+  hideRedundantEdgesCheckbox->setObjectName("hideRedundantEdgesCheckbox");
+
   autoArrangeButton->setObjectName("autoArrangeButton");
 
   auto buttonBox = new QDialogButtonBox(
@@ -128,6 +131,7 @@ void GroupsEditorDialog::setupUi() {
   sidebarLayout->addWidget(groupPluginsTitle);
   sidebarLayout->addWidget(groupPluginsList, 1);
   sidebarLayout->addSpacerItem(verticalSpacer);
+  sidebarLayout->addWidget(hideRedundantEdgesCheckbox);
   sidebarLayout->addWidget(autoArrangeButton);
   sidebarLayout->addLayout(formLayout);
 
@@ -149,6 +153,10 @@ void GroupsEditorDialog::translateUi() {
 
   groupNameInputLabel->setText(translate("Group name"));
   addGroupButton->setText(translate("Add a new group"));
+  hideRedundantEdgesCheckbox->setText(translate("Hide redundant edges"));
+  hideRedundantEdgesCheckbox->setToolTip(
+      translate("Hide edges from a group to groups that already load after it "
+                "through other groups. Hidden edges are still saved."));
   autoArrangeButton->setText(translate("Auto arrange groups"));
 }
 
@@ -215,12 +223,10 @@ void GroupsEditorDialog::on_graphView_groupSelected(const QString& name) {
 
   auto groupName = name.toStdString();
 
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    auto pluginGroup = plugin.group.value_or(Group::DEFAULT_NAME);
-
-    if (pluginGroup == groupName) {
-      groupPluginsList->addItem(QString::fromStdString(plugin.name));
-    }
+  const auto& plugins = pluginItemModel->getPluginItems();
+  for (const auto index :
+       pluginItemModel->getGroupPluginsIndex().getPluginIndexes(groupName)) {
+    groupPluginsList->addItem(QString::fromStdString(plugins.at(index).name));
   }
 
   if (groupPluginsList->count() == 0) {
@@ -265,6 +271,10 @@ void GroupsEditorDialog::on_addGroupButton_clicked() {
   groupNameInput->clear();
 }
 
+void GroupsEditorDialog::on_hideRedundantEdgesCheckbox_toggled(bool checked) {
+  graphView->setTransitiveReductionEnabled(checked);
+}
+
 void GroupsEditorDialog::on_autoArrangeButton_clicked() {
   graphView->autoLayout();
 }
@@ -27,6 +27,7 @@
 #define LOOT_GUI_QT_GROUPS_EDITOR_GROUPS_EDITOR_DIALOG
 
 #include <QtGui/QCloseEvent>
+#include <QtWidgets/QCheckBox>
 #include <QtWidgets/QDialog>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
@@ -46,7 +47,6 @@ public:
 
   void setGroups(const std::vector<Group> &masterlistGroups,
                  const std::vector<Group> &userGroups,
-                 const std::set<std::string> &installedPluginGroups,
                  const std::vector<GroupNodePosition> &nodePositions);
 
   std::vector<Group> getUserGroups() const;
@@ -56,6 +56,7 @@ private:
   GraphView *graphView{new GraphView(this)};
   QLabel *groupPluginsTitle{new QLabel(this)};
   QListWidget *groupPluginsList{new QListWidget(this)};
+  QCheckBox *hideRedundantEdgesCheckbox{new QCheckBox(this)};
   QPushButton *autoArrangeButton{new QPushButton(this)};
   QLabel *groupNameInputLabel{new QLabel(this)};
   QLineEdit *groupNameInput{new QLineEdit(this)};
@@ -78,6 +79,7 @@ private slots:
   void on_graphView_groupSelected(const QString &name);
   void on_groupNameInput_textChanged(const QString &text);
   void on_addGroupButton_clicked();
+  void on_hideRedundantEdgesCheckbox_toggled(bool checked);
   void on_autoArrangeButton_clicked();
   void on_dialogButtons_accepted();
   void on_dialogButtons_rejected();
@@ -31,13 +31,12 @@
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/SugiyamaLayout.h>
 
-#include "gui/qt/groups_editor/edge.h"
-
 namespace loot {
 constexpr double LAYER_SPACING = 30.0;
 
-std::map<Node *, QPointF> calculateGraphLayout(
-    const std::vector<Node *> &nodes) {
+std::vector<QPointF> calculateGraphLayout(
+    const std::vector<QSizeF> &nodeSizes,
+    const std::vector<std::pair<size_t, size_t>> &edges) {
   ogdf::Graph graph;
   ogdf::GraphAttributes graphAttributes(
       graph,
@@ -50,39 +49,27 @@ std::map<Node *, QPointF> calculateGraphLayout(
   graphAttributes.directed() = true;
 
   // Add all nodes to the graph.
-  std::map<Node *, ogdf::node> graphNodes;
-  std::map<ogdf::node, Node *> sceneNodes;
-  for (const auto node : nodes) {
+  std::vector<ogdf::node> graphNodes;
+  graphNodes.reserve(nodeSizes.size());
+  for (const auto &size : nodeSizes) {
     const auto graphNode = graph.newNode();
-    const auto boundingRect =
-        node->boundingRect().marginsRemoved(Node::MARGINS);
 
     // The height and width are transposed because the layout algorithm
     // arranges layers vertically, and the result is then rotated to get a
     // horizonal layout.
-    graphAttributes.width(graphNode) = boundingRect.height();
-    graphAttributes.height(graphNode) = boundingRect.width();
+    graphAttributes.width(graphNode) = size.height();
+    graphAttributes.height(graphNode) = size.width();
 
-    graphNodes.emplace(node, graphNode);
-    sceneNodes.emplace(graphNode, node);
+    graphNodes.push_back(graphNode);
   }
 
-  // Now add all edges to the graph, without having to worry if the nodes
-  // already exist or not.
-  for (const auto node : nodes) {
-    const auto fromGraphNode = graphNodes.find(node);
-    if (fromGraphNode == graphNodes.end()) {
+  // Now add all edges to the graph.
+  for (const auto &[fromIndex, toIndex] : edges) {
+    if (fromIndex >= graphNodes.size() || toIndex >= graphNodes.size()) {
       throw std::logic_error("Node is not in graph");
     }
 
-    for (const auto outEdge : node->outEdges()) {
-      const auto toGraphNode = graphNodes.find(outEdge->destNode());
-      if (toGraphNode == graphNodes.end()) {
-        throw std::logic_error("Node is not in graph");
-      }
-
-      graph.newEdge(fromGraphNode->second, toGraphNode->second);
-    }
+    graph.newEdge(graphNodes.at(fromIndex), graphNodes.at(toIndex));
   }
 
   ogdf::SugiyamaLayout SL;
@@ -99,17 +86,12 @@ std::map<Node *, QPointF> calculateGraphLayout(
   // Now rotate the layout to get a layers arranged horizontally.
   graphAttributes.rotateLeft90();
 
-  std::map<Node *, QPointF> nodePositions;
-
-  for (const auto node : graph.nodes) {
-    QPointF position(graphAttributes.x(node), graphAttributes.y(node));
-
-    const auto sceneNode = sceneNodes.find(node);
-    if (sceneNode == sceneNodes.end()) {
-      throw std::logic_error("Node is not in scene");
-    }
+  std::vector<QPointF> nodePositions;
+  nodePositions.reserve(graphNodes.size());
 
-    nodePositions.emplace(sceneNode->second, position);
+  for (const auto node : graphNodes) {
+    nodePositions.push_back(
+        QPointF(graphAttributes.x(node), graphAttributes.y(node)));
   }
 
   return nodePositions;
@@ -27,15 +27,19 @@
 #define LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT
 
 #include <QtCore/QPoint>
-#include <map>
+#include <QtCore/QSize>
+#include <cstddef>
+#include <utility>
 #include <vector>
 
-#include "gui/qt/groups_editor/node.h"
-
 namespace loot {
 constexpr qreal NODE_SPACING = 70;
 
-std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes);
+// Edges are given as pairs of indexes into nodeSizes, and the returned
+// positions are in the same order as nodeSizes.
+std::vector<QPointF> calculateGraphLayout(
+    const std::vector<QSizeF>& nodeSizes,
+    const std::vector<std::pair<size_t, size_t>>& edges);
 }
 
 #endif
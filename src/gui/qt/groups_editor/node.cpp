@@ -30,6 +30,8 @@
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtWidgets/QStyleOption>
+#include <boost/format.hpp>
+#include <boost/locale.hpp>
 
 #include "gui/qt/groups_editor/edge.h"
 #include "gui/qt/groups_editor/graph_view.h"
@@ -64,16 +66,25 @@ void NodeLabel::paint(QPainter *painter,
 Node::Node(GraphView *graphView,
            const QString &name,
            bool isUserMetadata,
-           bool containsInstalledPlugins) :
+           size_t installedPluginCount) :
     textItem(new NodeLabel(*graphView, name, isUserMetadata)),
     isUserMetadata_(isUserMetadata),
-    containsInstalledPlugins(containsInstalledPlugins) {
+    installedPluginCount_(installedPluginCount) {
   setFlag(ItemIsMovable);
   setFlag(ItemSendsGeometryChanges);
   setCacheMode(DeviceCoordinateCache);
   setZValue(1);
 
   graphView->scene()->addItem(textItem);
+
+  const auto toolTip =
+      (boost::format(boost::locale::translate(
+           "%1% installed plugin",
+           "%1% installed plugins",
+           static_cast<int>(installedPluginCount))) %
+       installedPluginCount)
+          .str();
+  setToolTip(QString::fromStdString(toolTip));
 }
 
 Node::~Node() { removeEdgeToCursor(); }
@@ -82,6 +93,42 @@ QString Node::getName() const { return textItem->text(); }
 
 bool Node::isUserMetadata() const { return isUserMetadata_; }
 
+bool Node::containsInstalledPlugins() const {
+  return installedPluginCount_ > 0;
+}
+
+size_t Node::installedPluginCount() const { return installedPluginCount_; }
+
+void Node::remove() {
+  // Remove the node. This will involve remove the item from the
+  // scene and also removing any edges that hold this node's pointer.
+  // The removed edges will also need to be removed from their other
+  // nodes' edge lists.
+  // The removed edges and this node should also be freed from memory.
+  // They can all be deleted from here, so long as "delete this" is
+  // not followed by any further use of "this".
+  auto graphView = qobject_cast<GraphView *>(scene()->parent());
+  while (!edgeList.isEmpty()) {
+    auto edge = edgeList[0];
+    auto otherNode =
+        edge->sourceNode() == this ? edge->destNode() : edge->sourceNode();
+
+    graphView->handleEdgeRemoved(edge);
+    removeEdge(edge);
+    otherNode->removeEdge(edge);
+    scene()->removeItem(edge);
+    delete edge;
+  }
+
+  graphView->handleNodeRemoved(this);
+
+  scene()->removeItem(this->textItem);
+  scene()->removeItem(this);
+  delete this->textItem;
+  delete this;
+  // DO NOT use "this" past this line.
+}
+
 void Node::addEdge(Edge *edge) {
   edgeList.append(edge);
   edge->adjust();
@@ -189,7 +236,7 @@ void Node::mousePressEvent(QGraphicsSceneMouseEvent *event) {
   update();
   QGraphicsItem::mousePressEvent(event);
 
-  if (isUserMetadata_ && !containsInstalledPlugins &&
+  if (isUserMetadata_ && !containsInstalledPlugins() &&
       event->button() == Qt::RightButton) {
     auto logger = getLogger();
     if (logger) {
@@ -197,28 +244,7 @@ void Node::mousePressEvent(QGraphicsSceneMouseEvent *event) {
                    textItem->text().toStdString());
     }
 
-    // Remove the node. This will involve remove the item from the
-    // scene and also removing any edges that hold this node's pointer.
-    // The removed edges will also need to be removed from their other
-    // nodes' edge lists.
-    // The removed edges and this node should also be freed from memory.
-    // They can all be deleted from here, so long as "delete this" is
-    // not followed by any further use of "this".
-    while (!edgeList.isEmpty()) {
-      auto edge = edgeList[0];
-      auto otherNode =
-          edge->sourceNode() == this ? edge->destNode() : edge->sourceNode();
-
-      removeEdge(edge);
-      otherNode->removeEdge(edge);
-      scene()->removeItem(edge);
-      delete edge;
-    }
-
-    scene()->removeItem(this->textItem);
-    scene()->removeItem(this);
-    delete this->textItem;
-    delete this;
+    remove();
     // DO NOT use "this" past this line, except in the "else" block below.
   } else if (event->button() == Qt::RightButton) {
     // Not user metadata, ignore the event.
@@ -240,21 +266,15 @@ void Node::mouseReleaseEvent(QGraphicsSceneMouseEvent *event) {
   const auto mousePos = event->scenePos();
   auto itemsUnderMouse = scene()->items(mousePos);
 
-  auto logger = getLogger();
+  auto graphView = qobject_cast<GraphView *>(scene()->parent());
   for (const auto item : itemsUnderMouse) {
     auto node = qgraphicsitem_cast<Node *>(item);
     if (!node || node == this) {
       continue;
     }
 
-    if (logger) {
-      logger->info("Adding edge from {} to {}",
-                   textItem->text().toStdString(),
-                   node->textItem->text().toStdString());
-    }
-
-    auto edge = new Edge(this, node, true);
-    scene()->addItem(edge);
+    // Edges that would create a cycle are rejected by the graph view.
+    graphView->addUserEdge(this, node);
   }
 
   drawEdgeToCursor = false;
@@ -52,7 +52,7 @@ public:
   Node(GraphView *graphView,
        const QString &name,
        bool isUserMetadata,
-       bool containsInstalledPlugins);
+       size_t installedPluginCount);
   Node(const Node &) = delete;
   Node(Node &&) = delete;
   ~Node();
@@ -62,6 +62,12 @@ public:
 
   QString getName() const;
   bool isUserMetadata() const;
+  bool containsInstalledPlugins() const;
+  size_t installedPluginCount() const;
+
+  // Removes this node and its edges from the scene and deletes them. The node
+  // must not be used after calling this.
+  void remove();
 
   void addEdge(Edge *edge);
   void removeEdge(Edge *edge);
@@ -102,7 +108,7 @@ private:
   QGraphicsItem *edgeToCursor{nullptr};
   NodeLabel *textItem{nullptr};
   bool isUserMetadata_{false};
-  bool containsInstalledPlugins{false};
+  size_t installedPluginCount_{0};
   bool drawEdgeToCursor{false};
 
   QColor getNodeColor() const;
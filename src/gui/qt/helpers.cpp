@@ -36,6 +36,7 @@
 #include <QtWidgets/QToolTip>
 #include <QtWidgets/QWidget>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <boost/locale.hpp>
 #include <fstream>
 
@@ -265,9 +266,14 @@ bool isFileUpToDate(const std::filesystem::path& filePath,
 
 bool updateFileWithData(const std::filesystem::path& filePath,
                         const QByteArray& data) {
+  return updateFileWithData(filePath, data, calculateGitBlobHash(data));
+}
+
+bool updateFileWithData(const std::filesystem::path& filePath,
+                        const QByteArray& data,
+                        const std::string& newHash) {
   auto logger = getLogger();
 
-  auto newHash = calculateGitBlobHash(data);
   auto hasChanged = !isFileUpToDate(filePath, newHash);
 
   if (hasChanged) {
@@ -367,4 +373,40 @@ void showInvalidRegexTooltip(QWidget& widget, const std::string& details) {
                      QString::fromStdString(message),
                      &widget);
 }
+
+std::vector<int> getRowsInPriorityOrder(int rowCount,
+                                        int firstVisibleRow,
+                                        int lastVisibleRow) {
+  std::vector<int> rows;
+  if (rowCount <= 0) {
+    return rows;
+  }
+
+  firstVisibleRow = std::clamp(firstVisibleRow, 0, rowCount - 1);
+  lastVisibleRow = std::clamp(lastVisibleRow, firstVisibleRow, rowCount - 1);
+
+  rows.reserve(rowCount);
+
+  for (int row = firstVisibleRow; row <= lastVisibleRow; row += 1) {
+    rows.push_back(row);
+  }
+
+  // Alternate between the rows below and above the visible rows, as the
+  // view is more likely to scroll down than up.
+  int below = lastVisibleRow + 1;
+  int above = firstVisibleRow - 1;
+  while (below < rowCount || above >= 0) {
+    if (below < rowCount) {
+      rows.push_back(below);
+      below += 1;
+    }
+
+    if (above >= 0) {
+      rows.push_back(above);
+      above -= 1;
+    }
+  }
+
+  return rows;
+}
 }
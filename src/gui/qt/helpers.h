@@ -73,6 +73,11 @@ FileRevisionSummary getFileRevisionSummary(
 bool updateFileWithData(const std::filesystem::path& filePath,
                         const QByteArray& data);
 
+// As above, but with the data's Git blob hash already known.
+bool updateFileWithData(const std::filesystem::path& filePath,
+                        const QByteArray& data,
+                        const std::string& dataHash);
+
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination);
 
@@ -81,6 +86,12 @@ bool isValidUrl(const std::string& location);
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply);
 
 void showInvalidRegexTooltip(QWidget& widget, const std::string& details);
+
+// Returns the rows from firstVisibleRow to lastVisibleRow (inclusive), followed
+// by the other rows in order of their distance from the visible rows.
+std::vector<int> getRowsInPriorityOrder(int rowCount,
+                                        int firstVisibleRow,
+                                        int lastVisibleRow);
 }
 
 Q_DECLARE_METATYPE(loot::MessageContent);
@@ -26,159 +26,278 @@
 #include "gui/qt/icon_factory.h"
 
 #include <QtGui/QGuiApplication>
+#include <QtGui/QImageReader>
+#include <QtGui/QPainter>
 #include <QtGui/QPalette>
 #include <QtGui/QScreen>
 #include <QtWidgets/QStyle>
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 
 namespace loot {
-QPixmap changeColor(QPixmap pixmap, QColor color) {
-  QImage image = pixmap.toImage();
-
-  for (int y = 0; y < image.height(); y++) {
-    for (int x = 0; x < image.width(); x++) {
-      color.setAlpha(image.pixelColor(x, y).alpha());
-      image.setPixelColor(x, y, color);
+static constexpr const char* CHECK_ICON_PATH =
+    ":/icons/material-icons/check_black_48dp.svg";
+static constexpr const char* CROWN_ICON_PATH = ":/icons/crown.svg";
+static constexpr const char* FLARE_ICON_PATH =
+    ":/icons/material-icons/flare_black_48dp.svg";
+static constexpr const char* VISIBILITY_OFF_ICON_PATH =
+    ":/icons/material-icons/visibility_off_black_48dp.svg";
+static constexpr const char* ATTACHMENT_ICON_PATH =
+    ":/icons/material-icons/attachment_black_48dp.svg";
+static constexpr const char* DROPLET_ICON_PATH = ":/icons/droplet.svg";
+static constexpr const char* ACCOUNT_CIRCLE_ICON_PATH =
+    ":/icons/material-icons/account_circle_black_48dp.svg";
+static constexpr const char* CREATE_ICON_PATH =
+    ":/icons/material-icons/create_black_48dp.svg";
+static constexpr const char* SORT_ICON_PATH =
+    ":/icons/material-icons/sort_black_48dp.svg";
+static constexpr const char* CLOSE_ICON_PATH =
+    ":/icons/material-icons/close_black_48dp.svg";
+static constexpr const char* FILE_DOWNLOAD_ICON_PATH =
+    ":/icons/material-icons/file_download_black_48dp.svg";
+static constexpr const char* SETTINGS_ICON_PATH =
+    ":/icons/material-icons/settings_black_48dp.svg";
+static constexpr const char* ARCHIVE_ICON_PATH =
+    ":/icons/material-icons/archive_black_48dp.svg";
+static constexpr const char* GROUP_WORK_ICON_PATH =
+    ":/icons/material-icons/group_work_black_48dp.svg";
+static constexpr const char* SEARCH_ICON_PATH =
+    ":/icons/material-icons/search_black_48dp.svg";
+static constexpr const char* RECEIPT_ICON_PATH =
+    ":/icons/material-icons/receipt_black_48dp.svg";
+static constexpr const char* CONTENT_COPY_ICON_PATH =
+    ":/icons/material-icons/content_copy_black_48dp.svg";
+static constexpr const char* DATA_OBJECT_ICON_PATH =
+    ":/icons/material-icons/data_object_black_48dp.svg";
+static constexpr const char* REFRESH_ICON_PATH =
+    ":/icons/material-icons/refresh_black_48dp.svg";
+static constexpr const char* TODAY_ICON_PATH =
+    ":/icons/material-icons/today_black_48dp.svg";
+static constexpr const char* BUILD_ICON_PATH =
+    ":/icons/material-icons/build_black_48dp.svg";
+static constexpr const char* DELETE_ICON_PATH =
+    ":/icons/material-icons/delete_black_48dp.svg";
+static constexpr const char* BOOK_ICON_PATH =
+    ":/icons/material-icons/book_black_48dp.svg";
+static constexpr const char* FOLDER_ICON_PATH =
+    ":/icons/material-icons/folder_black_48dp.svg";
+static constexpr const char* FORUM_ICON_PATH =
+    ":/icons/material-icons/forum_black_48dp.svg";
+static constexpr const char* HELP_ICON_PATH =
+    ":/icons/material-icons/help_black_48dp.svg";
+
+// All icons are rendered into the atlas together, so they all need to be
+// listed here.
+static constexpr std::array<const char*, 26> ICON_PATHS = {
+    CHECK_ICON_PATH,
+    CROWN_ICON_PATH,
+    FLARE_ICON_PATH,
+    VISIBILITY_OFF_ICON_PATH,
+    ATTACHMENT_ICON_PATH,
+    DROPLET_ICON_PATH,
+    ACCOUNT_CIRCLE_ICON_PATH,
+    CREATE_ICON_PATH,
+    SORT_ICON_PATH,
+    CLOSE_ICON_PATH,
+    FILE_DOWNLOAD_ICON_PATH,
+    SETTINGS_ICON_PATH,
+    ARCHIVE_ICON_PATH,
+    GROUP_WORK_ICON_PATH,
+    SEARCH_ICON_PATH,
+    RECEIPT_ICON_PATH,
+    CONTENT_COPY_ICON_PATH,
+    DATA_OBJECT_ICON_PATH,
+    REFRESH_ICON_PATH,
+    TODAY_ICON_PATH,
+    BUILD_ICON_PATH,
+    DELETE_ICON_PATH,
+    BOOK_ICON_PATH,
+    FOLDER_ICON_PATH,
+    FORUM_ICON_PATH,
+    HELP_ICON_PATH};
+
+// Icons are rendered at this extent in device-independent pixels, which is
+// the size that the SVGs are designed for.
+static constexpr int ATLAS_CELL_EXTENT = 48;
+
+QImage recolour(const QImage& mask, const QColor& color) {
+  QImage image(mask.size(), QImage::Format_ARGB32_Premultiplied);
+  image.setDevicePixelRatio(mask.devicePixelRatio());
+
+  const uint32_t red = color.red();
+  const uint32_t green = color.green();
+  const uint32_t blue = color.blue();
+
+  // Only the mask's alpha channel is used, so each output pixel is the colour
+  // premultiplied by that alpha. The loop body is branchless integer
+  // arithmetic on contiguous scanlines so that the compiler can vectorise it.
+  const auto width = mask.width();
+  for (int y = 0; y < mask.height(); y += 1) {
+    const auto in = reinterpret_cast<const uint32_t*>(mask.constScanLine(y));
+    const auto out = reinterpret_cast<uint32_t*>(image.scanLine(y));
+
+    for (int x = 0; x < width; x += 1) {
+      const uint32_t alpha = in[x] >> 24;
+
+      out[x] = (alpha << 24) | (((red * alpha + 127) / 255) << 16) |
+               (((green * alpha + 127) / 255) << 8) |
+               ((blue * alpha + 127) / 255);
     }
   }
 
-  return QPixmap::fromImage(image);
+  return image;
 }
 
-QIcon IconFactory::getIsActiveIcon() {
-  return getIcon(":/icons/material-icons/check_black_48dp.svg");
-}
+QImage renderAtlasMask(qreal pixelRatio) {
+  const int cellPixels = qRound(ATLAS_CELL_EXTENT * pixelRatio);
+
+  QImage mask(cellPixels * static_cast<int>(ICON_PATHS.size()),
+              cellPixels,
+              QImage::Format_ARGB32_Premultiplied);
+  mask.fill(Qt::transparent);
+
+  QPainter painter(&mask);
+  for (size_t i = 0; i < ICON_PATHS.size(); i += 1) {
+    QImageReader reader(ICON_PATHS.at(i));
 
-QIcon IconFactory::getMasterFileIcon() { return getIcon(":/icons/crown.svg"); }
+    // Not all the icons are square, so fit them into their cells.
+    const auto size = reader.size().isValid() ? reader.size()
+                                              : QSize(cellPixels, cellPixels);
+    reader.setScaledSize(
+        size.scaled(cellPixels, cellPixels, Qt::KeepAspectRatio));
 
-QIcon IconFactory::getLightPluginIcon() {
-  return getIcon(":/icons/material-icons/flare_black_48dp.svg");
+    const auto iconImage = reader.read();
+
+    const auto x = static_cast<int>(i) * cellPixels +
+                   (cellPixels - iconImage.width()) / 2;
+    const auto y = (cellPixels - iconImage.height()) / 2;
+
+    painter.drawImage(x, y, iconImage);
+  }
+  painter.end();
+
+  mask.setDevicePixelRatio(pixelRatio);
+
+  return mask;
+}
+
+qreal getApplicationPixelRatio() {
+  return dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
+      ->devicePixelRatio();
 }
 
+QIcon IconFactory::getIsActiveIcon() { return getIcon(CHECK_ICON_PATH); }
+
+QIcon IconFactory::getMasterFileIcon() { return getIcon(CROWN_ICON_PATH); }
+
+QIcon IconFactory::getLightPluginIcon() { return getIcon(FLARE_ICON_PATH); }
+
 QIcon IconFactory::getEmptyPluginIcon() {
-  return getIcon(":/icons/material-icons/visibility_off_black_48dp.svg");
+  return getIcon(VISIBILITY_OFF_ICON_PATH);
 }
 
 QIcon IconFactory::getLoadsArchiveIcon() {
-  return getIcon(":/icons/material-icons/attachment_black_48dp.svg");
+  return getIcon(ATTACHMENT_ICON_PATH);
 }
 
-QIcon IconFactory::getIsCleanIcon() { return getIcon(":/icons/droplet.svg"); }
+QIcon IconFactory::getIsCleanIcon() { return getIcon(DROPLET_ICON_PATH); }
 
 QIcon IconFactory::getHasUserMetadataIcon() {
-  return getIcon(":/icons/material-icons/account_circle_black_48dp.svg");
+  return getIcon(ACCOUNT_CIRCLE_ICON_PATH);
 }
 
-QIcon IconFactory::getEditIcon() {
-  return getIcon(":/icons/material-icons/create_black_48dp.svg");
-}
+QIcon IconFactory::getEditIcon() { return getIcon(CREATE_ICON_PATH); }
 
-QIcon IconFactory::getSortIcon() {
-  return getIcon(":/icons/material-icons/sort_black_48dp.svg");
-}
+QIcon IconFactory::getSortIcon() { return getIcon(SORT_ICON_PATH); }
 
-QIcon IconFactory::getApplySortIcon() {
-  return getIcon(":/icons/material-icons/check_black_48dp.svg");
-}
+QIcon IconFactory::getApplySortIcon() { return getIcon(CHECK_ICON_PATH); }
 
-QIcon IconFactory::getDiscardSortIcon() {
-  return getIcon(":/icons/material-icons/close_black_48dp.svg");
-}
+QIcon IconFactory::getDiscardSortIcon() { return getIcon(CLOSE_ICON_PATH); }
 
 QIcon IconFactory::getUpdateMasterlistIcon() {
-  return getIcon(":/icons/material-icons/file_download_black_48dp.svg");
+  return getIcon(FILE_DOWNLOAD_ICON_PATH);
 }
 
-QIcon IconFactory::getSettingsIcon() {
-  return getIcon(":/icons/material-icons/settings_black_48dp.svg");
-}
+QIcon IconFactory::getSettingsIcon() { return getIcon(SETTINGS_ICON_PATH); }
 
-QIcon IconFactory::getArchiveIcon() {
-  return getIcon(":/icons/material-icons/archive_black_48dp.svg");
-}
+QIcon IconFactory::getArchiveIcon() { return getIcon(ARCHIVE_ICON_PATH); }
 
-QIcon IconFactory::getQuitIcon() {
-  return getIcon(":/icons/material-icons/close_black_48dp.svg");
-}
+QIcon IconFactory::getQuitIcon() { return getIcon(CLOSE_ICON_PATH); }
 
 QIcon IconFactory::getOpenGroupsEditorIcon() {
-  return getIcon(":/icons/material-icons/group_work_black_48dp.svg");
+  return getIcon(GROUP_WORK_ICON_PATH);
 }
 
-QIcon IconFactory::getSearchIcon() {
-  return getIcon(":/icons/material-icons/search_black_48dp.svg");
-}
+QIcon IconFactory::getSearchIcon() { return getIcon(SEARCH_ICON_PATH); }
 
-QIcon IconFactory::getCopyLoadOrderIcon() {
-  return getIcon(":/icons/material-icons/receipt_black_48dp.svg");
-}
+QIcon IconFactory::getCopyLoadOrderIcon() { return getIcon(RECEIPT_ICON_PATH); }
 
 QIcon IconFactory::getCopyContentIcon() {
-  return getIcon(":/icons/material-icons/content_copy_black_48dp.svg");
+  return getIcon(CONTENT_COPY_ICON_PATH);
 }
 
 QIcon IconFactory::getCopyMetadataIcon() {
-  return getIcon(":/icons/material-icons/data_object_black_48dp.svg");
+  return getIcon(DATA_OBJECT_ICON_PATH);
 }
 
-QIcon IconFactory::getRefreshIcon() {
-  return getIcon(":/icons/material-icons/refresh_black_48dp.svg");
-}
+QIcon IconFactory::getRefreshIcon() { return getIcon(REFRESH_ICON_PATH); }
 
-QIcon IconFactory::getRedateIcon() {
-  return getIcon(":/icons/material-icons/today_black_48dp.svg");
-}
+QIcon IconFactory::getRedateIcon() { return getIcon(TODAY_ICON_PATH); }
 
-QIcon IconFactory::getFixIcon() {
-  return getIcon(":/icons/material-icons/build_black_48dp.svg");
-}
+QIcon IconFactory::getFixIcon() { return getIcon(BUILD_ICON_PATH); }
 
-QIcon IconFactory::getDeleteIcon() {
-  return getIcon(":/icons/material-icons/delete_black_48dp.svg");
-}
+QIcon IconFactory::getDeleteIcon() { return getIcon(DELETE_ICON_PATH); }
 
-QIcon IconFactory::getViewDocsIcon() {
-  return getIcon(":/icons/material-icons/book_black_48dp.svg");
-}
+QIcon IconFactory::getViewDocsIcon() { return getIcon(BOOK_ICON_PATH); }
 
 QIcon IconFactory::getOpenLOOTDataFolderIcon() {
-  return getIcon(":/icons/material-icons/folder_black_48dp.svg");
+  return getIcon(FOLDER_ICON_PATH);
 }
 
 QIcon IconFactory::getJoinDiscordServerIcon() {
-  return getIcon(":/icons/material-icons/forum_black_48dp.svg");
-}
-
-QIcon IconFactory::getAboutIcon() {
-  return getIcon(":/icons/material-icons/help_black_48dp.svg");
+  return getIcon(FORUM_ICON_PATH);
 }
 
-QPixmap IconFactory::getPixmap(const QIcon& icon,
-                               int extent,
-                               QIcon::Mode mode,
-                               QIcon::State state) {
-  // Take the device pixel ratio into account when reading or writing the cache
-  // as it may change while the application is running.
-  const auto pixelRatio =
-      dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
-          ->devicePixelRatio();
-  auto scaledSize = extent * pixelRatio;
-  auto key = std::make_tuple(icon.cacheKey(), scaledSize, mode, state);
+QIcon IconFactory::getAboutIcon() { return getIcon(HELP_ICON_PATH); }
 
-  const auto it = pixmaps.find(key);
-  if (it != pixmaps.end()) {
-    return it->second;
+void IconFactory::paintIcon(QPainter& painter,
+                            const QRect& rect,
+                            const QIcon& icon,
+                            QIcon::Mode mode) {
+  const auto cellIt = iconCells.find(icon.cacheKey());
+  if (cellIt == iconCells.end()) {
+    icon.paint(&painter, rect, Qt::AlignCenter, mode);
+    return;
   }
 
-  auto pixmap = icon.pixmap(extent, mode, state);
+  const auto pixelRatio = painter.device()->devicePixelRatioF();
+  const auto& atlas = getAtlas(pixelRatio);
+
+  const QPixmap* pixmap = &atlas.normal;
+  if (mode == QIcon::Disabled) {
+    pixmap = &atlas.disabled;
+  } else if (mode == QIcon::Selected) {
+    pixmap = &atlas.selected;
+  }
 
-  pixmaps.emplace(key, pixmap);
+  const auto extent = std::min(rect.width(), rect.height());
+  const auto target = QRect(rect.x() + (rect.width() - extent) / 2,
+                            rect.y() + (rect.height() - extent) / 2,
+                            extent,
+                            extent);
 
-  return pixmap;
+  painter.save();
+  painter.setRenderHint(QPainter::SmoothPixmapTransform);
+  painter.drawPixmap(target, *pixmap, getCellRect(cellIt->second, pixelRatio));
+  painter.restore();
 }
 
 void IconFactory::setColours(QColor normal, QColor disabled, QColor selected) {
+  // The atlases are rendered again the next time an icon is needed.
   icons.clear();
-  pixmaps.clear();
+  iconCells.clear();
+  atlases.clear();
 
   normalColor = normal;
   disabledColor = disabled;
@@ -187,8 +306,9 @@ void IconFactory::setColours(QColor normal, QColor disabled, QColor selected) {
 
 std::map<QString, QIcon> IconFactory::icons;
 
-std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>, QPixmap>
-    IconFactory::pixmaps;
+std::map<qint64, int> IconFactory::iconCells;
+
+std::map<qreal, IconFactory::Atlas> IconFactory::atlases;
 
 QColor IconFactory::normalColor;
 
@@ -196,12 +316,41 @@ QColor IconFactory::disabledColor;
 
 QColor IconFactory::selectedColor;
 
-QIcon IconFactory::getIcon(QString resourcePath) {
+QIcon IconFactory::getIcon(const char* resourcePath) {
   const auto it = icons.find(resourcePath);
   if (it != icons.end()) {
     return it->second;
   }
 
+  const auto pathIt =
+      std::find(ICON_PATHS.begin(), ICON_PATHS.end(), resourcePath);
+  if (pathIt == ICON_PATHS.end()) {
+    throw std::logic_error(std::string("The icon ") + resourcePath +
+                           " is not in the icon atlas");
+  }
+  const auto cell = static_cast<int>(std::distance(ICON_PATHS.begin(), pathIt));
+
+  const auto pixelRatio = getApplicationPixelRatio();
+  const auto& atlas = getAtlas(pixelRatio);
+  const auto cellRect = getCellRect(cell, pixelRatio);
+
+  QIcon icon;
+  icon.addPixmap(atlas.normal.copy(cellRect), QIcon::Normal);
+  icon.addPixmap(atlas.disabled.copy(cellRect), QIcon::Disabled);
+  icon.addPixmap(atlas.selected.copy(cellRect), QIcon::Selected);
+
+  icons.emplace(resourcePath, icon);
+  iconCells.emplace(icon.cacheKey(), cell);
+
+  return icon;
+}
+
+const IconFactory::Atlas& IconFactory::getAtlas(qreal pixelRatio) {
+  const auto it = atlases.find(pixelRatio);
+  if (it != atlases.end()) {
+    return it->second;
+  }
+
   if (!normalColor.isValid()) {
     normalColor = QGuiApplication::palette().color(QPalette::Disabled,
                                                    QPalette::WindowText);
@@ -217,18 +366,21 @@ QIcon IconFactory::getIcon(QString resourcePath) {
                                                      QPalette::HighlightedText);
   }
 
-  auto rawPixmap = QPixmap(resourcePath);
-  auto normalPixmap = changeColor(rawPixmap, normalColor);
-  auto disabledPixmap = changeColor(rawPixmap, disabledColor);
-  auto selectedPixmap = changeColor(rawPixmap, selectedColor);
+  // Each icon is rasterised once per pixel ratio, and then the whole atlas is
+  // recoloured in one pass per colour.
+  const auto mask = renderAtlasMask(pixelRatio);
 
-  QIcon icon;
-  icon.addPixmap(normalPixmap, QIcon::Normal);
-  icon.addPixmap(disabledPixmap, QIcon::Disabled);
-  icon.addPixmap(selectedPixmap, QIcon::Selected);
+  Atlas atlas;
+  atlas.normal = QPixmap::fromImage(recolour(mask, normalColor));
+  atlas.disabled = QPixmap::fromImage(recolour(mask, disabledColor));
+  atlas.selected = QPixmap::fromImage(recolour(mask, selectedColor));
 
-  icons.emplace(resourcePath, icon);
+  return atlases.emplace(pixelRatio, std::move(atlas)).first->second;
+}
 
-  return icon;
+QRect IconFactory::getCellRect(int cell, qreal pixelRatio) {
+  const int cellPixels = qRound(ATLAS_CELL_EXTENT * pixelRatio);
+
+  return QRect(cell * cellPixels, 0, cellPixels, cellPixels);
 }
 }
@@ -29,6 +29,7 @@
 #include <QtCore/QString>
 #include <QtGui/QColor>
 #include <QtGui/QIcon>
+#include <QtGui/QPainter>
 #include <QtGui/QPixmap>
 #include <map>
 
@@ -67,25 +68,36 @@ public:
   static QIcon getJoinDiscordServerIcon();
   static QIcon getAboutIcon();
 
-  // Caches resized pixmaps so that the transformation only needs to be done
-  // once per (icon, extent, mode, state) tuple of argument values.
-  static QPixmap getPixmap(const QIcon& icon,
-                           int extent,
-                           QIcon::Mode mode = QIcon::Normal,
-                           QIcon::State state = QIcon::Off);
+  // Draws the icon's region of the icon atlas for the painter's device pixel
+  // ratio, so that no per-icon pixmaps need to be scaled or recoloured. Icons
+  // that didn't come from this class are painted normally.
+  static void paintIcon(QPainter& painter,
+                        const QRect& rect,
+                        const QIcon& icon,
+                        QIcon::Mode mode = QIcon::Normal);
 
   static void setColours(QColor normal, QColor disabled, QColor selected);
 
 private:
+  // All the icons rendered side by side at one device pixel ratio, in each
+  // of the icon colours.
+  struct Atlas {
+    QPixmap normal;
+    QPixmap disabled;
+    QPixmap selected;
+  };
+
   static std::map<QString, QIcon> icons;
-  static std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>,
-                  QPixmap>
-      pixmaps;
+  // Maps icon cache keys to their cell indices in the atlases.
+  static std::map<qint64, int> iconCells;
+  static std::map<qreal, Atlas> atlases;
   static QColor normalColor;
   static QColor disabledColor;
   static QColor selectedColor;
 
-  static QIcon getIcon(QString resourcePath);
+  static QIcon getIcon(const char* resourcePath);
+  static const Atlas& getAtlas(qreal pixelRatio);
+  static QRect getCellRect(int cell, qreal pixelRatio);
 };
 }
 
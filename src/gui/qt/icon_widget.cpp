@@ -0,0 +1,51 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/icon_widget.h"
+
+#include <QtGui/QPainter>
+
+#include "gui/qt/icon_factory.h"
+
+namespace loot {
+IconWidget::IconWidget(QWidget* parent, int extent) :
+    QWidget(parent), extent(extent) {
+  setFixedSize(extent, extent);
+}
+
+void IconWidget::setIcon(const QIcon& newIcon) {
+  icon = newIcon;
+  update();
+}
+
+QSize IconWidget::sizeHint() const { return QSize(extent, extent); }
+
+void IconWidget::paintEvent(QPaintEvent*) {
+  QPainter painter(this);
+
+  const auto mode = isEnabled() ? QIcon::Normal : QIcon::Disabled;
+  IconFactory::paintIcon(painter, rect(), icon, mode);
+}
+}
@@ -0,0 +1,52 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_ICON_WIDGET
+#define LOOT_GUI_QT_ICON_WIDGET
+
+#include <QtGui/QIcon>
+#include <QtWidgets/QWidget>
+
+namespace loot {
+// Displays an icon at a fixed extent by painting it straight from the icon
+// atlas, instead of holding a scaled pixmap of its own like a QLabel would.
+class IconWidget : public QWidget {
+public:
+  IconWidget(QWidget* parent, int extent);
+
+  void setIcon(const QIcon& icon);
+
+  QSize sizeHint() const override;
+
+protected:
+  void paintEvent(QPaintEvent* event) override;
+
+private:
+  QIcon icon;
+  int extent{0};
+};
+}
+
+#endif
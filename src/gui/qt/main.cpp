@@ -25,12 +25,15 @@
 
 #include <QtCore/QCommandLineOption>
 #include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
 #include <QtCore/QLibraryInfo>
 #include <QtCore/QTimer>
 #include <QtCore/QTranslator>
 #include <QtWidgets/QApplication>
+#include <iostream>
 
 #include "gui/application_mutex.h"
+#include "gui/daemon/daemon_server.h"
 #include "gui/qt/main_window.h"
 #include "gui/qt/style.h"
 #include "gui/state/logging.h"
@@ -74,7 +77,98 @@ void logRuntimeEnvironment() {
   }
 }
 
+QCommandLineOption getDaemonOption() {
+  return QCommandLineOption(
+      "daemon",
+      "Run without a UI, handling JSON requests sent to the given local socket",
+      "socket path");
+}
+
+bool isDaemonModeRequested(int argc, char* argv[]) {
+  for (int i = 1; i < argc; i += 1) {
+    const std::string argument = argv[i];
+    if (argument == "--daemon" || argument.rfind("--daemon=", 0) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+int runDaemon(int argc, char* argv[]) {
+  // The daemon has no UI, so doesn't need a QApplication, and it can run
+  // alongside an instance of LOOT's UI.
+  QCoreApplication app(argc, argv);
+
+  QCommandLineParser parser;
+  parser.addHelpOption();
+  parser.addVersionOption();
+  parser.addOptions(
+      {getDaemonOption(),
+       {"game",
+        "Set the game that has its install path overridden",
+        "game identifier"},
+       {"game-path", "Override the game's install path.", "path"},
+       {"loot-data-path",
+        "Set the directory where LOOT will store its data",
+        "path"}});
+  parser.process(app);
+
+  auto lootDataPath =
+      std::filesystem::u8path(parser.value("loot-data-path").toStdString());
+  auto gameFolder = parser.value("game").toStdString();
+  auto gamePath =
+      std::filesystem::u8path(parser.value("game-path").toStdString());
+  auto socketName = parser.value("daemon");
+
+  loot::LootState state("", lootDataPath);
+
+  logRuntimeEnvironment();
+
+  state.init(gameFolder, gamePath, false);
+
+  for (const auto& message : state.getInitMessages()) {
+    std::cerr << message.text << std::endl;
+  }
+
+  auto gamesSettings = state.GetInstalledGameSettings();
+  if (gamesSettings.empty()) {
+    std::cerr << "None of the supported games were detected." << std::endl;
+    return 1;
+  }
+
+  loot::DaemonRequestHandler handler(std::move(gamesSettings),
+                                     state.getLootDataPath(),
+                                     state.getPreludePath(),
+                                     state.getSettings().getLanguage());
+  loot::DaemonServer server(handler);
+
+  const auto logger = loot::getLogger();
+  if (!server.listen(socketName)) {
+    const auto error = server.errorString().toStdString();
+    if (logger) {
+      logger->error("Failed to listen on {}: {}",
+                    socketName.toStdString(),
+                    error);
+    }
+    std::cerr << "Failed to listen on " << socketName.toStdString() << ": "
+              << error << std::endl;
+    return 1;
+  }
+
+  if (logger) {
+    logger->info("Listening for daemon requests on {}",
+                 socketName.toStdString());
+  }
+
+  return app.exec();
+}
+
 int main(int argc, char* argv[]) {
+  if (isDaemonModeRequested(argc, argv)) {
+    return runDaemon(argc, argv);
+  }
+
 #ifdef _WIN32
   // Check if LOOT is already running
   //---------------------------------
@@ -102,7 +196,11 @@ int main(int argc, char* argv[]) {
        {"loot-data-path",
         "Set the directory where LOOT will store its data",
         "path"},
-       {"auto-sort", "Automatically sort the load order on launch"}});
+       {"auto-sort", "Automatically sort the load order on launch"},
+       {"replay-session",
+        "Display a captured session snapshot instead of loading a game",
+        "path"},
+       getDaemonOption()});
   parser.process(app);
 
   auto lootDataPath =
@@ -111,6 +209,8 @@ int main(int argc, char* argv[]) {
   auto gamePath =
       std::filesystem::u8path(parser.value("game-path").toStdString());
   auto autoSort = parser.isSet("auto-sort");
+  auto replaySessionPath =
+      std::filesystem::u8path(parser.value("replay-session").toStdString());
 
   loot::LootState state("", lootDataPath);
 
@@ -118,6 +218,12 @@ int main(int argc, char* argv[]) {
 
   state.init(startupGameFolder, gamePath, autoSort);
 
+  // Start loading the game while the UI is being constructed. There's no game
+  // to load when replaying a session.
+  if (replaySessionPath.empty()) {
+    state.startLoadingCurrentGame();
+  }
+
   // Load Qt's translations.
   QTranslator translator;
 
@@ -141,6 +247,14 @@ int main(int argc, char* argv[]) {
   loot::MainWindow mainWindow(state);
   mainWindow.applyTheme();
 
+  const auto initialiseMainWindow = [&]() {
+    if (replaySessionPath.empty()) {
+      mainWindow.initialise();
+    } else {
+      mainWindow.replaySession(replaySessionPath);
+    }
+  };
+
   const auto wasMaximised = state.getSettings()
                                 .getMainWindowPosition()
                                 .value_or(loot::LootSettings::WindowPosition())
@@ -185,7 +299,7 @@ int main(int argc, char* argv[]) {
           logger->info(message);
         }
 
-        mainWindow.initialise();
+        initialiseMainWindow();
 
         timer->stop();
         timer->deleteLater();
@@ -197,7 +311,7 @@ int main(int argc, char* argv[]) {
     timer->start(1);
   } else {
     mainWindow.show();
-    mainWindow.initialise();
+    initialiseMainWindow();
   }
 
   return app.exec();
@@ -28,30 +28,40 @@
 #include <QtCore/QTimer>
 #include <QtGui/QCloseEvent>
 #include <QtGui/QDesktopServices>
+#include <QtWidgets/QFileDialog>
 #include <QtWidgets/QHeaderView>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QProgressBar>
 #include <QtWidgets/QProgressDialog>
 #include <QtWidgets/QScrollBar>
 #include <QtWidgets/QTextEdit>
+#include <sstream>
 
 #include "gui/backup.h"
+#include "gui/helpers.h"
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
 #include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/report_writer.h"
+#include "gui/qt/session_snapshot.h"
 #include "gui/qt/sidebar_plugin_name_delegate.h"
 #include "gui/qt/style.h"
 #include "gui/qt/tasks/check_for_update_task.h"
 #include "gui/qt/tasks/update_masterlist_task.h"
 #include "gui/query/types/apply_sort_query.h"
+#include "gui/query/types/build_completion_index_query.h"
 #include "gui/query/types/cancel_sort_query.h"
 #include "gui/query/types/change_game_query.h"
 #include "gui/query/types/clear_all_metadata_query.h"
 #include "gui/query/types/clear_plugin_metadata_query.h"
 #include "gui/query/types/copy_load_order_query.h"
 #include "gui/query/types/copy_metadata_query.h"
+#include "gui/query/types/discard_full_plugin_data_query.h"
+#include "gui/query/types/evaluate_plugin_details_query.h"
+#include "gui/query/types/export_report_query.h"
 #include "gui/query/types/get_conflicting_plugins_query.h"
 #include "gui/query/types/get_game_data_query.h"
+#include "gui/query/types/get_startup_game_data_query.h"
 #include "gui/query/types/open_log_location_query.h"
 #include "gui/query/types/open_readme_query.h"
 #include "gui/query/types/sort_plugins_query.h"
@@ -93,6 +103,20 @@ bool hasLoadOrderChanged(const std::vector<std::string>& oldLoadOrder,
   return false;
 }
 
+bool filtersNeedPluginDetails(const PluginFiltersState& filtersState) {
+  return filtersState.hideMessagelessPlugins ||
+         !std::holds_alternative<std::monostate>(filtersState.content);
+}
+
+int getRowAtViewportY(const QListView& view, int y) {
+  const auto index = view.indexAt(QPoint(0, y));
+  if (!index.isValid()) {
+    return -1;
+  }
+
+  return index.row();
+}
+
 int calculateSidebarHeaderWidth(const QAbstractItemView& view, int column) {
   const auto headerText =
       view.model()->headerData(column, Qt::Horizontal).toString();
@@ -231,6 +255,7 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
     QMainWindow(parent), state(state) {
   qRegisterMetaType<QueryResult>("QueryResult");
   qRegisterMetaType<std::string>("std::string");
+  qRegisterMetaType<QueryTiming>("QueryTiming");
 
   setupUi();
 
@@ -303,6 +328,75 @@ void MainWindow::initialise() {
   }
 }
 
+void MainWindow::replaySession(const std::filesystem::path& snapshotPath) {
+  try {
+    themes = findThemes(state.getResourcesPath());
+
+    auto snapshot = loadSessionSnapshot(snapshotPath);
+    isReplayingSession = true;
+
+    // There is no game to evaluate plugin metadata against, so treat whatever
+    // was captured as the full details.
+    std::set<std::string> groupNames;
+    for (auto& item : snapshot.pluginItems) {
+      item.detailsEvaluated = true;
+
+      if (item.group.has_value()) {
+        groupNames.insert(item.group.value());
+      }
+    }
+
+    // The filtered group may not contain any of the captured plugins, but it
+    // still needs to be selectable.
+    auto& pluginFilters = snapshot.pluginFilters;
+    if (pluginFilters.groupName.has_value()) {
+      groupNames.insert(pluginFilters.groupName.value());
+    }
+
+    queryTimings.assign(snapshot.queryTimings.begin(),
+                        snapshot.queryTimings.end());
+
+    filtersWidget->setFilterStates(snapshot.filters);
+    filtersWidget->setContentFilter(pluginFilters.content,
+                                    pluginFilters.isContentRegex);
+
+    // Set the proxy model's filters before it has any plugins to filter, as
+    // the conflicts and group pickers can't select anything until the plugins
+    // and groups have been set.
+    auto filtersState = filtersWidget->getPluginFiltersState();
+    filtersState.conflictsPluginName = pluginFilters.conflictsPluginName;
+    filtersState.groupName = pluginFilters.groupName;
+
+    pluginItemModel->setCardContentFiltersState(
+        filtersWidget->getCardContentFiltersState());
+    proxyModel->setFiltersState(
+        std::move(filtersState),
+        std::move(pluginFilters.conflictingPluginNames));
+
+    const auto& generalInformation = snapshot.generalInformation;
+    pluginItemModel->setPluginItems(std::move(snapshot.pluginItems));
+    buildFilenameCompletions();
+    pluginItemModel->setGeneralInformation(
+        generalInformation.gameType,
+        generalInformation.masterlistRevision,
+        generalInformation.preludeRevision,
+        generalInformation.generalMessages);
+
+    filtersWidget->setGroups(
+        std::vector<std::string>(groupNames.begin(), groupNames.end()));
+    filtersWidget->setConflictsAndGroupsFilters(
+        pluginFilters.conflictsPluginName, pluginFilters.groupName);
+
+    // Game actions stay disabled as they need a loaded game, but searching
+    // only reads the model.
+    actionSearch->setEnabled(true);
+    actionSettings->setEnabled(false);
+    gameComboBox->setEnabled(false);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::applyTheme() {
   // Apply theme.
   auto styleSheet = loot::loadStyleSheet(state.getResourcesPath(),
@@ -313,18 +407,20 @@ void MainWindow::applyTheme() {
   }
 
   if (styleSheet.has_value()) {
+    // Only apply the stylesheet to this window and its children (including
+    // dialogs), not the whole application. Setting the application stylesheet
+    // would also repolish the card sizing cache's hidden widgets, and there
+    // can be thousands of them.
 #if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
-    qApp->setStyleSheet(styleSheet.value());
+    setStyleSheet(styleSheet.value());
 #else
-    const auto font = qApp->font();
-    qApp->setStyleSheet(styleSheet.value());
+    const auto font = this->font();
+    setStyleSheet(styleSheet.value());
 
     // Reapply previous font because setting the stylesheet seems to unset the
     // font.
-    qApp->setFont(font);
+    setFont(font);
 #endif
-
-    qApp->style()->polish(qApp);
   }
 }
 
@@ -411,6 +507,9 @@ void MainWindow::setupUi() {
 
   groupsEditor->setObjectName("groupsEditor");
 
+  fullPluginDataTimer->setObjectName("fullPluginDataTimer");
+  fullPluginDataTimer->setSingleShot(true);
+
   setupViews();
 
   translateUi();
@@ -444,6 +543,10 @@ void MainWindow::setupUi() {
           &MainWindow::linkColorChanged,
           this,
           &MainWindow::handleLinkColorChanged);
+  connect(this,
+          &MainWindow::searchResultColorChanged,
+          this,
+          &MainWindow::handleSearchResultColorChanged);
 }
 
 void MainWindow::setupMenuBar() {
@@ -452,6 +555,8 @@ void MainWindow::setupMenuBar() {
 
   actionBackupData->setObjectName("actionBackupData");
 
+  actionCaptureSession->setObjectName("actionCaptureSession");
+
   actionQuit->setObjectName("actionQuit");
 
   actionViewDocs->setObjectName("actionViewDocs");
@@ -472,6 +577,8 @@ void MainWindow::setupMenuBar() {
 
   actionCopyContent->setObjectName("actionCopyContent");
 
+  actionExportReport->setObjectName("actionExportReport");
+
   actionRefreshContent->setObjectName("actionRefreshContent");
   actionRefreshContent->setShortcut(QKeySequence::Refresh);
 
@@ -492,16 +599,21 @@ void MainWindow::setupMenuBar() {
 
   actionClearMetadata->setObjectName("actionClearMetadata");
 
+  actionViewEvaluationCosts->setObjectName("actionViewEvaluationCosts");
+  actionSaveEvaluationCosts->setObjectName("actionSaveEvaluationCosts");
+
   // Create menu bar.
   setMenuBar(menubar);
 
   menubar->addAction(menuFile->menuAction());
   menubar->addAction(menuGame->menuAction());
   menubar->addAction(menuPlugin->menuAction());
+  menubar->addAction(menuDebug->menuAction());
   menubar->addAction(menuHelp->menuAction());
   menuFile->addAction(actionSettings);
   menuFile->addAction(actionBackupData);
   menuFile->addAction(actionOpenLOOTDataFolder);
+  menuFile->addAction(actionCaptureSession);
   menuFile->addSeparator();
   menuFile->addAction(actionQuit);
   menuGame->addAction(actionOpenGroupsEditor);
@@ -514,6 +626,7 @@ void MainWindow::setupMenuBar() {
   menuGame->addAction(actionSearch);
   menuGame->addAction(actionCopyLoadOrder);
   menuGame->addAction(actionCopyContent);
+  menuGame->addAction(actionExportReport);
   menuGame->addAction(actionRefreshContent);
   menuGame->addSeparator();
   menuGame->addAction(actionFixAmbiguousLoadOrder);
@@ -526,10 +639,17 @@ void MainWindow::setupMenuBar() {
   menuPlugin->addAction(actionCopyMetadata);
   menuPlugin->addSeparator();
   menuPlugin->addAction(actionClearMetadata);
+  menuDebug->addAction(actionViewEvaluationCosts);
+  menuDebug->addAction(actionSaveEvaluationCosts);
   menuHelp->addAction(actionViewDocs);
   menuHelp->addAction(actionJoinDiscordServer);
   menuHelp->addSeparator();
   menuHelp->addAction(actionAbout);
+
+  // The Debug menu is only useful when investigating problems, so only show it
+  // when debug logging is enabled.
+  menuDebug->menuAction()->setVisible(
+      state.getSettings().isDebugLoggingEnabled());
 }
 
 void MainWindow::setupToolBar() {
@@ -563,6 +683,8 @@ void MainWindow::setupToolBar() {
 }
 
 void MainWindow::setupViews() {
+  filtersWidget->setPluginItemModel(pluginItemModel);
+
   sidebarPluginsView->setModel(proxyModel);
   sidebarPluginsView->setTabKeyNavigation(false);
   sidebarPluginsView->setDragEnabled(true);
@@ -666,6 +788,8 @@ void MainWindow::translateUi() {
   /* translators: This string is an action in the File menu. */
   actionOpenLOOTDataFolder->setText(translate("&Open LOOT Data Folder"));
   /* translators: This string is an action in the File menu. */
+  actionCaptureSession->setText(translate("&Capture Session Snapshot..."));
+  /* translators: This string is an action in the File menu. */
   actionQuit->setText(translate("&Quit"));
 
   /* translators: The mnemonic in this string shouldn't conflict with other
@@ -680,6 +804,8 @@ void MainWindow::translateUi() {
   /* translators: This string is an action in the Game menu. */
   actionCopyContent->setText(translate("&Copy Content"));
   /* translators: This string is an action in the Game menu. */
+  actionExportReport->setText(translate("&Export Report..."));
+  /* translators: This string is an action in the Game menu. */
   actionRefreshContent->setText(translate("&Refresh Content"));
   /* translators: This string is an action in the Game menu. */
   actionRedatePlugins->setText(translate("Redate &Plugins..."));
@@ -702,6 +828,14 @@ void MainWindow::translateUi() {
   /* translators: This string is an action in the Plugin menu. */
   actionClearMetadata->setText(translate("Clear &User Metadata..."));
 
+  /* translators: The mnemonic in this string shouldn't conflict with other
+     menus or sidebar sections. */
+  menuDebug->setTitle(translate("&Debug"));
+  /* translators: This string is an action in the Debug menu. */
+  actionViewEvaluationCosts->setText(translate("&View Evaluation Costs..."));
+  /* translators: This string is an action in the Debug menu. */
+  actionSaveEvaluationCosts->setText(translate("&Save Evaluation Costs"));
+
   /* translators: The mnemonic in this string shouldn't conflict with other
      menus or sidebar sections. */
   menuHelp->setTitle(translate("&Help"));
@@ -733,6 +867,7 @@ void MainWindow::setIcons() {
   actionSearch->setIcon(IconFactory::getSearchIcon());
   actionCopyLoadOrder->setIcon(IconFactory::getCopyLoadOrderIcon());
   actionCopyContent->setIcon(IconFactory::getCopyContentIcon());
+  actionExportReport->setIcon(IconFactory::getCopyContentIcon());
   actionRefreshContent->setIcon(IconFactory::getRefreshIcon());
   actionRedatePlugins->setIcon(IconFactory::getRedateIcon());
   actionFixAmbiguousLoadOrder->setIcon(IconFactory::getFixIcon());
@@ -751,6 +886,7 @@ void MainWindow::setIcons() {
 
 void MainWindow::enableGameActions() {
   menuGame->setEnabled(true);
+  menuDebug->setEnabled(true);
   actionSort->setEnabled(true);
   actionUpdateMasterlist->setEnabled(true);
   actionSearch->setEnabled(true);
@@ -765,6 +901,7 @@ void MainWindow::enableGameActions() {
 
 void MainWindow::disableGameActions() {
   menuGame->setEnabled(false);
+  menuDebug->setEnabled(false);
   actionSort->setEnabled(false);
   actionUpdateMasterlist->setEnabled(false);
   actionSearch->setEnabled(false);
@@ -842,10 +979,19 @@ void MainWindow::loadGame(bool isOnLOOTStartup) {
     emit progressUpdater->progressUpdate(QString::fromStdString(message));
   };
 
-  std::unique_ptr<Query> query =
-      std::make_unique<GetGameDataQuery>(state.GetCurrentGame(),
-                                         state.getSettings().getLanguage(),
-                                         sendProgressUpdate);
+  // On startup the game data may already be loading, in which case wait for
+  // it instead of loading it again.
+  auto startupGameData = isOnLOOTStartup ? state.takeStartupGameData()
+                                         : std::nullopt;
+
+  std::unique_ptr<Query> query;
+  if (startupGameData.has_value()) {
+    query = std::make_unique<GetStartupGameDataQuery>(
+        std::move(startupGameData.value()), sendProgressUpdate);
+  } else {
+    query = std::make_unique<GetGameDataQuery<>>(state.GetCurrentGame(),
+                                                 sendProgressUpdate);
+  }
 
   const auto handler = isOnLOOTStartup
                            ? &MainWindow::handleStartupGameDataLoaded
@@ -873,8 +1019,9 @@ void MainWindow::updateGeneralInformation() {
                                             FileType::MasterlistPrelude);
 
   auto initMessages = state.getInitMessages();
-  auto gameMessages = ToSimpleMessages(state.GetCurrentGame().GetMessages(),
-                                       state.getSettings().getLanguage());
+  auto gameMessages =
+      ToSimpleMessages(state.GetCurrentGame().GetStateSnapshot()->messages,
+                       state.getSettings().getLanguage());
   initMessages.insert(
       initMessages.end(), gameMessages.begin(), gameMessages.end());
 
@@ -887,14 +1034,61 @@ void MainWindow::updateGeneralInformation() {
 
 void MainWindow::updateGeneralMessages() {
   auto initMessages = state.getInitMessages();
-  auto gameMessages = ToSimpleMessages(state.GetCurrentGame().GetMessages(),
-                                       state.getSettings().getLanguage());
+  auto gameMessages =
+      ToSimpleMessages(state.GetCurrentGame().GetStateSnapshot()->messages,
+                       state.getSettings().getLanguage());
   initMessages.insert(
       initMessages.end(), gameMessages.begin(), gameMessages.end());
 
   pluginItemModel->setGeneralMessages(std::move(initMessages));
 }
 
+void MainWindow::loadCardSizes() {
+  try {
+    cardSizingCache.loadSizes(
+        state.GetCurrentGame().CardSizesPath(),
+        getCardSizingSignature(state.getSettings().getLanguage()));
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to load cached card sizes: {}", e.what());
+    }
+  }
+}
+
+void MainWindow::saveCardSizes() {
+  // A replayed session has no game to save card sizes for.
+  if (isReplayingSession || !state.HasCurrentGame()) {
+    return;
+  }
+
+  try {
+    cardSizingCache.saveSizes(
+        state.GetCurrentGame().CardSizesPath(),
+        getCardSizingSignature(state.getSettings().getLanguage()));
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to save card sizes: {}", e.what());
+    }
+  }
+}
+
+void MainWindow::saveConditionResults() {
+  if (isReplayingSession || !state.HasCurrentGame()) {
+    return;
+  }
+
+  try {
+    state.GetCurrentGame().SaveConditionResults();
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to save the condition cache: {}", e.what());
+    }
+  }
+}
+
 void MainWindow::updateSidebarColumnWidths() {
   const auto horizontalHeader = sidebarPluginsView->horizontalHeader();
 
@@ -909,7 +1103,7 @@ void MainWindow::updateSidebarColumnWidths() {
   const auto positionSectionWidth =
       state.HasCurrentGame() && state.GetCurrentGame().IsInitialised()
           ? calculateSidebarPositionSectionWidth(
-                state.GetCurrentGame().GetPlugins().size())
+                state.GetCurrentGame().GetStateSnapshot()->plugins.size())
           : calculateSidebarPositionSectionWidth(
                 DEFAULT_LOAD_ORDER_SIZE_ESTIMATE);
 
@@ -947,6 +1141,10 @@ void MainWindow::updateSidebarColumnWidths() {
 }
 
 void MainWindow::setFiltersState(PluginFiltersState&& filtersState) {
+  if (filtersNeedPluginDetails(filtersState)) {
+    evaluateAllPluginDetails();
+  }
+
   proxyModel->setFiltersState(std::move(filtersState));
 
   updateCounts(pluginItemModel->getGeneralMessages(),
@@ -958,6 +1156,10 @@ void MainWindow::setFiltersState(PluginFiltersState&& filtersState) {
 void MainWindow::setFiltersState(
     PluginFiltersState&& filtersState,
     std::vector<std::string>&& conflictingPluginNames) {
+  if (filtersNeedPluginDetails(filtersState)) {
+    evaluateAllPluginDetails();
+  }
+
   proxyModel->setFiltersState(std::move(filtersState),
                               std::move(conflictingPluginNames));
 
@@ -996,10 +1198,10 @@ void MainWindow::sortPlugins(bool isAutoSort) {
   };
 
   std::unique_ptr<Query> sortPluginsQuery =
-      std::make_unique<SortPluginsQuery>(state.GetCurrentGame(),
-                                         state,
-                                         state.getSettings().getLanguage(),
-                                         sendProgressUpdate);
+      std::make_unique<SortPluginsQuery<>>(state.GetCurrentGame(),
+                                           state,
+                                           state.getSettings().getLanguage(),
+                                           sendProgressUpdate);
 
   auto sortTask = new QueryTask(std::move(sortPluginsQuery));
 
@@ -1149,12 +1351,19 @@ void MainWindow::closeEvent(QCloseEvent* event) {
     }
   }
 
-  try {
-    state.getSettings().storeFilters(filtersWidget->getFilterSettings());
-  } catch (const std::exception& e) {
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to record filter states: {}", e.what());
+  saveCardSizes();
+  saveConditionResults();
+
+  // A replayed session's filters came from its snapshot, so they shouldn't
+  // replace the user's own.
+  if (!isReplayingSession) {
+    try {
+      state.getSettings().storeFilters(filtersWidget->getFilterSettings());
+    } catch (const std::exception& e) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to record filter states: {}", e.what());
+      }
     }
   }
 
@@ -1196,6 +1405,14 @@ void MainWindow::executeBackgroundQuery(
 void MainWindow::executeBackgroundTasks(
     std::vector<Task*> tasks,
     const ProgressUpdater* progressUpdater) {
+  for (auto task : tasks) {
+    const auto queryTask = qobject_cast<QueryTask*>(task);
+    if (queryTask != nullptr) {
+      connect(
+          queryTask, &QueryTask::timed, this, &MainWindow::handleQueryTimed);
+    }
+  }
+
   auto executor = new TaskExecutor(this, tasks);
 
   if (progressUpdater != nullptr) {
@@ -1220,9 +1437,331 @@ void MainWindow::executeBackgroundTasks(
           this,
           &MainWindow::handleWorkerThreadFinished);
 
+  activeExecutorCount += 1;
+
+  // Plugin details are evaluated and full plugin data is discarded using the
+  // current game, so wait for either to finish before running anything else.
+  if (isEvaluatingPluginDetails || isDiscardingFullPluginData) {
+    deferredExecutors.push_back(executor);
+  } else {
+    executor->start();
+  }
+}
+
+void MainWindow::buildFilenameCompletions() {
+  // Update the metadata editor's autocompletions, as the plugin names may
+  // have changed. The filters sidebar panel's plugin picker uses the model
+  // directly. Indexing the names can take a while for large load orders, so
+  // do it on a worker thread.
+  filenameCompletionsRevision += 1;
+  const auto revision = filenameCompletionsRevision;
+
+  auto task = new QueryTask(std::make_unique<BuildCompletionIndexQuery>(
+      pluginItemModel->getPluginNames()));
+
+  // Builds may finish out of order, so ignore any index built from names that
+  // have since been replaced.
+  connect(task, &Task::finished, this, [this, revision](QueryResult result) {
+    if (revision == filenameCompletionsRevision) {
+      handleFilenameCompletionsBuilt(std::move(result));
+    }
+  });
+  connect(task, &Task::error, this, &MainWindow::handleError);
+  connect(task, &QueryTask::timed, this, &MainWindow::handleQueryTimed);
+
+  // This doesn't go through executeBackgroundTasks() because it doesn't use
+  // the current game and must not reset the progress dialog.
+  auto executor = new TaskExecutor(this, {task});
+
+  connect(executor, &TaskExecutor::finished, executor, &QObject::deleteLater);
+
+  executor->start();
+}
+
+std::vector<std::string> MainWindow::getUnevaluatedPluginNames(
+    size_t maxCount) const {
+  const auto& items = pluginItemModel->getPluginItems();
+
+  std::vector<std::string> pluginNames;
+  std::set<std::string> addedNames;
+  const auto addItem = [&](const PluginItem& item) {
+    if (!item.detailsEvaluated && addedNames.insert(item.name).second) {
+      pluginNames.push_back(item.name);
+    }
+    return pluginNames.size() < maxCount;
+  };
+
+  // Evaluate the visible cards first, then the cards that are closest to
+  // them, then any that are currently filtered out, in load order.
+  const auto viewportHeight = pluginCardsView->viewport()->height();
+  const auto firstVisibleRow = getRowAtViewportY(*pluginCardsView, 0);
+  const auto lastVisibleRow =
+      getRowAtViewportY(*pluginCardsView, viewportHeight - 1);
+  const auto proxyRowCount = proxyModel->rowCount();
+
+  const auto proxyRows = getRowsInPriorityOrder(
+      proxyRowCount,
+      firstVisibleRow < 0 ? 0 : firstVisibleRow,
+      lastVisibleRow < 0 ? proxyRowCount - 1 : lastVisibleRow);
+
+  for (const auto proxyRow : proxyRows) {
+    const auto proxyIndex =
+        proxyModel->index(proxyRow, PluginItemModel::CARDS_COLUMN);
+    const auto sourceIndex = proxyModel->mapToSource(proxyIndex);
+
+    // Row 0 is the general information card.
+    if (!sourceIndex.isValid() || sourceIndex.row() == 0) {
+      continue;
+    }
+
+    if (!addItem(items.at(sourceIndex.row() - 1))) {
+      return pluginNames;
+    }
+  }
+
+  for (const auto& item : items) {
+    if (!addItem(item)) {
+      break;
+    }
+  }
+
+  return pluginNames;
+}
+
+void MainWindow::evaluatePluginDetails() {
+  static constexpr size_t BATCH_SIZE = 100;
+
+  if (isEvaluatingPluginDetails || isDiscardingFullPluginData ||
+      hasPluginDetailsEvaluationFailed || !state.HasCurrentGame()) {
+    return;
+  }
+
+  auto pluginNames = getUnevaluatedPluginNames(BATCH_SIZE);
+  if (pluginNames.empty()) {
+    return;
+  }
+
+  auto task = new QueryTask(std::make_unique<EvaluatePluginDetailsQuery<>>(
+      state.GetCurrentGame(),
+      state.getSettings().getLanguage(),
+      std::move(pluginNames)));
+
+  connect(task,
+          &Task::finished,
+          this,
+          &MainWindow::handlePluginDetailsEvaluated);
+  connect(task, &Task::error, this, &MainWindow::handlePluginDetailsError);
+  connect(task, &QueryTask::timed, this, &MainWindow::handleQueryTimed);
+
+  // This doesn't go through executeBackgroundTasks() because it runs in
+  // between other tasks and must not reset the progress dialog.
+  auto executor = new TaskExecutor(this, {task});
+
+  connect(executor, &TaskExecutor::finished, executor, &QObject::deleteLater);
+  connect(executor,
+          &TaskExecutor::finished,
+          this,
+          &MainWindow::handlePluginDetailsWorkerThreadFinished);
+
+  isEvaluatingPluginDetails = true;
   executor->start();
 }
 
+void MainWindow::evaluateAllPluginDetails() {
+  auto pluginNames =
+      getUnevaluatedPluginNames(pluginItemModel->getPluginItems().size());
+  if (pluginNames.empty()) {
+    return;
+  }
+
+  handleProgressUpdate(translate("Evaluating plugin metadata..."));
+
+  auto task = new QueryTask(std::make_unique<EvaluatePluginDetailsQuery<>>(
+      state.GetCurrentGame(),
+      state.getSettings().getLanguage(),
+      std::move(pluginNames)));
+
+  connect(task,
+          &Task::finished,
+          this,
+          &MainWindow::handlePluginDetailsEvaluated);
+  connect(task, &Task::error, this, &MainWindow::handlePluginDetailsError);
+
+  executeBackgroundTasks({task}, nullptr);
+}
+
+void MainWindow::runWithAllPluginDetails(std::function<void()> action) {
+  if (getUnevaluatedPluginNames(1).empty()) {
+    action();
+    return;
+  }
+
+  // Only queue one evaluation of the remaining plugins, however many actions
+  // are waiting for it.
+  if (actionsAwaitingPluginDetails.empty()) {
+    evaluateAllPluginDetails();
+  }
+
+  actionsAwaitingPluginDetails.push_back(std::move(action));
+}
+
+void MainWindow::captureSession(const std::filesystem::path& filePath) {
+  SessionSnapshot snapshot;
+  snapshot.generalInformation = pluginItemModel->getGeneralInfo();
+  snapshot.pluginItems = pluginItemModel->getPluginItems();
+  snapshot.filters = filtersWidget->getFilterSettings();
+
+  const auto filtersState = filtersWidget->getPluginFiltersState();
+  snapshot.pluginFilters.conflictsPluginName =
+      filtersState.conflictsPluginName;
+  snapshot.pluginFilters.groupName = filtersState.groupName;
+  snapshot.pluginFilters.content = filtersWidget->getContentFilterText();
+  snapshot.pluginFilters.isContentRegex =
+      filtersWidget->isContentFilterRegex();
+  if (filtersState.conflictsPluginName.has_value()) {
+    snapshot.pluginFilters.conflictingPluginNames =
+        proxyModel->getConflictingPluginNames();
+  }
+  snapshot.queryTimings.assign(queryTimings.begin(), queryTimings.end());
+
+  saveSessionSnapshot(snapshot, filePath);
+
+  showNotification(translate("The session snapshot has been saved."));
+}
+
+void MainWindow::copyContent() {
+  // Limit how much is put on the clipboard, as very large load orders can
+  // produce more content than is reasonable to paste anywhere.
+  static constexpr size_t MAX_COPIED_CONTENT_PLUGINS_SIZE = 8 * 1024 * 1024;
+
+  std::ostringstream content;
+  ReportWriter writer(
+      content, ReportFormat::Markdown, MAX_COPIED_CONTENT_PLUGINS_SIZE);
+
+  writer.writeGeneralInformation(pluginItemModel->getGeneralInfo());
+
+  for (const auto& plugin : pluginItemModel->getPluginItems()) {
+    if (!writer.writePlugin(plugin)) {
+      break;
+    }
+  }
+
+  writer.finish();
+
+  CopyToClipboard(content.str());
+
+  if (writer.isTruncated()) {
+    const auto message =
+        (boost::format(boost::locale::translate(
+             "Only the first %1% plugins' content has been copied to the "
+             "clipboard. Use Export Report to save all of LOOT's "
+             "content.")) %
+         writer.getPluginsWritten())
+            .str();
+    showNotification(QString::fromStdString(message));
+  } else {
+    showNotification(
+        translate("LOOT's content has been copied to the clipboard."));
+  }
+}
+
+void MainWindow::exportReport(const std::filesystem::path& filePath,
+                              ReportFormat format) {
+  auto progressUpdater = new ProgressUpdater();
+
+  // This lambda will run from the worker thread.
+  auto sendProgressUpdate = [progressUpdater](std::string message) {
+    emit progressUpdater->progressUpdate(QString::fromStdString(message));
+  };
+
+  // The query shares the model's plugin items instead of copying them on the
+  // GUI thread: the model copies them itself if it changes before the report
+  // has been written.
+  std::unique_ptr<Query> query =
+      std::make_unique<ExportReportQuery>(pluginItemModel->getGeneralInfo(),
+                                          pluginItemModel->sharePluginItems(),
+                                          filePath,
+                                          format,
+                                          sendProgressUpdate);
+
+  executeBackgroundQuery(
+      std::move(query), &MainWindow::handleReportExported, progressUpdater);
+}
+
+void MainWindow::scheduleFullPluginDataDiscard() {
+  static constexpr size_t BYTES_PER_MIB = 1024 * 1024;
+  static constexpr int MILLISECONDS_PER_SECOND = 1000;
+
+  // Full plugin data is only needed to find conflicts for plugins that haven't
+  // been checked since plugins were last loaded, so it can be discarded if it
+  // is using too much memory or hasn't been used for a while.
+  const auto memoryBudget = state.getSettings().getFullPluginDataMemoryBudget();
+  if (memoryBudget > 0) {
+    const auto memoryUsage = getResidentMemoryUsage();
+    if (memoryUsage.has_value() && memoryUsage.value() / BYTES_PER_MIB >
+                                       static_cast<size_t>(memoryBudget)) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->info(
+            "LOOT is using {} MiB of memory, which is more than the budget of "
+            "{} MiB for keeping full plugin data",
+            memoryUsage.value() / BYTES_PER_MIB,
+            memoryBudget);
+      }
+
+      fullPluginDataTimer->stop();
+      discardFullPluginData();
+      return;
+    }
+  }
+
+  const auto idleTimeout = state.getSettings().getFullPluginDataIdleTimeout();
+  if (idleTimeout > 0) {
+    fullPluginDataTimer->start(idleTimeout * MILLISECONDS_PER_SECOND);
+  }
+}
+
+void MainWindow::discardFullPluginData() {
+  // Discarding the data reloads the game's plugins, so it must not run at the
+  // same time as anything else that uses the game. If something is running,
+  // the discard is run once it and anything queued behind it have finished.
+  if (activeExecutorCount > 0 || isEvaluatingPluginDetails ||
+      isDiscardingFullPluginData) {
+    isFullPluginDataDiscardPending = true;
+    return;
+  }
+
+  isFullPluginDataDiscardPending = false;
+
+  auto task = new QueryTask(
+      std::make_unique<DiscardFullPluginDataQuery>(state.GetCurrentGame()));
+
+  connect(task, &Task::error, this, &MainWindow::handleError);
+  connect(task, &QueryTask::timed, this, &MainWindow::handleQueryTimed);
+
+  // This doesn't go through executeBackgroundTasks() because it isn't
+  // associated with any progress dialog and must not reset it.
+  auto executor = new TaskExecutor(this, {task});
+
+  connect(executor, &TaskExecutor::finished, executor, &QObject::deleteLater);
+  connect(executor,
+          &TaskExecutor::finished,
+          this,
+          &MainWindow::handleFullPluginDataDiscardFinished);
+
+  isDiscardingFullPluginData = true;
+  executor->start();
+}
+
+void MainWindow::runIdleGameTasks() {
+  if (isFullPluginDataDiscardPending && state.HasCurrentGame()) {
+    discardFullPluginData();
+  } else {
+    isFullPluginDataDiscardPending = false;
+    evaluatePluginDetails();
+  }
+}
+
 void MainWindow::handleError(const std::string& message) {
   progressDialog->reset();
 
@@ -1258,7 +1797,17 @@ void MainWindow::handleQueryException(const Query& query,
 void MainWindow::handleGameDataLoaded(QueryResult result) {
   progressDialog->reset();
 
+  hasPluginDetailsEvaluationFailed = false;
+
+  // Anything waiting for the previous plugins' details is no longer relevant.
+  actionsAwaitingPluginDetails.clear();
+
+  // Load cached card sizes before the model changes so that the cards can be
+  // laid out without measuring them all.
+  loadCardSizes();
+
   pluginItemModel->setPluginItems(std::move(std::get<PluginItems>(result)));
+  buildFilenameCompletions();
 
   updateGeneralInformation();
 
@@ -1268,6 +1817,8 @@ void MainWindow::handleGameDataLoaded(QueryResult result) {
       state.GetCurrentGame().GetKnownBashTags());
 
   enableGameActions();
+
+  evaluatePluginDetails();
 }
 
 bool MainWindow::handlePluginsSorted(QueryResult result) {
@@ -1290,9 +1841,9 @@ bool MainWindow::handlePluginsSorted(QueryResult result) {
     return false;
   }
 
-  auto currentLoadOrder = state.GetCurrentGame().GetLoadOrder();
+  const auto snapshot = state.GetCurrentGame().GetStateSnapshot();
   const auto loadOrderHasChanged =
-      hasLoadOrderChanged(currentLoadOrder, sortedPlugins);
+      hasLoadOrderChanged(snapshot->loadOrder, sortedPlugins);
 
   if (loadOrderHasChanged) {
     enterSortingState();
@@ -1343,7 +1894,7 @@ std::optional<std::filesystem::path> MainWindow::createBackup() {
 }
 
 void MainWindow::checkForAmbiguousLoadOrder() {
-  if (!state.GetCurrentGame().IsLoadOrderAmbiguous()) {
+  if (!state.GetCurrentGame().GetStateSnapshot()->isLoadOrderAmbiguous) {
     actionFixAmbiguousLoadOrder->setEnabled(false);
     return;
   }
@@ -1406,23 +1957,35 @@ void MainWindow::on_actionBackupData_triggered() {
   }
 }
 
+void MainWindow::on_actionCaptureSession_triggered() {
+  try {
+    const auto filePath =
+        QFileDialog::getSaveFileName(this,
+                                     translate("Capture Session Snapshot"),
+                                     QString(),
+                                     translate("TOML files (*.toml)"));
+    if (filePath.isEmpty()) {
+      return;
+    }
+
+    // Snapshots are replayed without a game to evaluate plugin details
+    // against, so they need to capture all of them.
+    const auto path = std::filesystem::u8path(filePath.toStdString());
+    runWithAllPluginDetails([this, path]() { captureSession(path); });
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::on_actionQuit_triggered() { this->close(); }
 
 void MainWindow::on_actionOpenGroupsEditor_triggered() {
   try {
-    std::set<std::string> installedPluginGroups;
-    for (const auto& plugin : pluginItemModel->getPluginItems()) {
-      if (plugin.group.has_value()) {
-        installedPluginGroups.insert(plugin.group.value());
-      }
-    }
-
     const auto groupNodePositions =
         LoadGroupNodePositions(state.GetCurrentGame().GroupNodePositionsPath());
 
     groupsEditor->setGroups(state.GetCurrentGame().GetMasterlistGroups(),
                             state.GetCurrentGame().GetUserGroups(),
-                            installedPluginGroups,
                             groupNodePositions);
 
     groupsEditor->show();
@@ -1431,19 +1994,24 @@ void MainWindow::on_actionOpenGroupsEditor_triggered() {
   }
 }
 
-void MainWindow::on_actionSearch_triggered() { searchDialog->show(); }
+void MainWindow::on_actionSearch_triggered() {
+  try {
+    // Searching covers all card content, so it all needs to be available.
+    evaluateAllPluginDetails();
+
+    searchDialog->show();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
 
 void MainWindow::on_actionCopyLoadOrder_triggered() {
   try {
-    auto plugins = state.GetCurrentGame().GetPluginsInLoadOrder();
-    std::vector<std::string> pluginNames;
-    pluginNames.reserve(plugins.size());
+    const auto snapshot = state.GetCurrentGame().GetStateSnapshot();
 
-    for (const auto& plugin : plugins) {
-      pluginNames.push_back(plugin->GetName());
-    }
-
-    CopyLoadOrderQuery query(state.GetCurrentGame(), pluginNames);
+    // Plugins in the load order that aren't loaded are skipped.
+    CopyLoadOrderQuery<gui::GameStateSnapshot> query(*snapshot,
+                                                     snapshot->loadOrder);
 
     query.executeLogic();
 
@@ -1456,17 +2024,42 @@ void MainWindow::on_actionCopyLoadOrder_triggered() {
 
 void MainWindow::on_actionCopyContent_triggered() {
   try {
-    auto content =
-        pluginItemModel->getGeneralInfo().getMarkdownContent() + "\n\n";
+    // The copied content includes all card content, so it all needs to be
+    // available.
+    runWithAllPluginDetails([this]() { copyContent(); });
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::on_actionExportReport_triggered() {
+  try {
+    const auto markdownFilter = translate("Markdown files (*.md)");
+    const auto jsonFilter = translate("JSON files (*.json)");
+    const auto csvFilter = translate("CSV files (*.csv)");
 
-    for (const auto& plugin : pluginItemModel->getPluginItems()) {
-      content += plugin.getMarkdownContent() + "\n\n";
+    QString selectedFilter;
+    const auto filePath = QFileDialog::getSaveFileName(
+        this,
+        translate("Export Report"),
+        QString(),
+        markdownFilter + ";;" + jsonFilter + ";;" + csvFilter,
+        &selectedFilter);
+    if (filePath.isEmpty()) {
+      return;
     }
 
-    CopyToClipboard(content);
+    auto format = ReportFormat::Markdown;
+    if (selectedFilter == jsonFilter) {
+      format = ReportFormat::Json;
+    } else if (selectedFilter == csvFilter) {
+      format = ReportFormat::Csv;
+    }
 
-    showNotification(
-        translate("LOOT's content has been copied to the clipboard."));
+    // Reports include all card content, so it all needs to be available.
+    const auto path = std::filesystem::u8path(filePath.toStdString());
+    runWithAllPluginDetails(
+        [this, path, format]() { exportReport(path, format); });
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1474,8 +2067,9 @@ void MainWindow::on_actionCopyContent_triggered() {
 
 void MainWindow::on_actionFixAmbiguousLoadOrder_triggered() {
   try {
-    auto loadOrder = state.GetCurrentGame().GetLoadOrder();
-    state.GetCurrentGame().SetLoadOrder(loadOrder);
+    // Set the load order that LOOT displays.
+    const auto snapshot = state.GetCurrentGame().GetStateSnapshot();
+    state.GetCurrentGame().SetLoadOrder(snapshot->loadOrder);
 
     showNotification(
         translate("The load order displayed by LOOT has been set."));
@@ -1815,6 +2409,38 @@ void MainWindow::on_actionAbout_triggered() {
   }
 }
 
+void MainWindow::on_actionViewEvaluationCosts_triggered() {
+  try {
+    evaluationCostsDialog->setReport(
+        state.GetCurrentGame().GetEvaluationCosts().GetReport());
+
+    evaluationCostsDialog->show();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::on_actionSaveEvaluationCosts_triggered() {
+  try {
+    // Save the costs next to the log so that they're included when the log
+    // is shared.
+    const auto filePath =
+        state.getLogPath().parent_path() / "LOOTEvaluationCosts.toml";
+
+    SaveEvaluationCostReport(
+        filePath, state.GetCurrentGame().GetEvaluationCosts().GetReport());
+
+    const auto message =
+        (boost::format(boost::locale::translate(
+             "The evaluation costs have been saved to %1%.")) %
+         filePath.u8string())
+            .str();
+    showNotification(QString::fromStdString(message));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::on_gameComboBox_activated(int index) {
   try {
     if (index < 0) {
@@ -1828,6 +2454,9 @@ void MainWindow::on_gameComboBox_activated(int index) {
       return;
     }
 
+    saveCardSizes();
+    saveConditionResults();
+
     auto progressUpdater = new ProgressUpdater();
 
     // This lambda will run from the worker thread.
@@ -1835,11 +2464,8 @@ void MainWindow::on_gameComboBox_activated(int index) {
       emit progressUpdater->progressUpdate(QString::fromStdString(message));
     };
 
-    std::unique_ptr<Query> query =
-        std::make_unique<ChangeGameQuery>(state,
-                                          state.getSettings().getLanguage(),
-                                          folderName,
-                                          sendProgressUpdate);
+    std::unique_ptr<Query> query = std::make_unique<ChangeGameQuery>(
+        state, folderName, sendProgressUpdate);
 
     executeBackgroundQuery(
         std::move(query), &MainWindow::handleGameChanged, progressUpdater);
@@ -2032,10 +2658,21 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
 
   cardSizingCache.update(topLeft, bottomRight);
 
-  if (roles.isEmpty() || roles.contains(CardContentFiltersRole)) {
+  // Plugin details are needed by some filters, and are evaluated after the
+  // filters may have been applied, so the filters need to be reapplied.
+  if (roles.isEmpty() || roles.contains(CardContentFiltersRole) ||
+      roles.contains(PluginDetailsRole)) {
     proxyModel->invalidate();
   }
 
+  if (roles.contains(PluginDetailsRole)) {
+    // Search results are stored in the model's items, so they're kept when
+    // the filters are reapplied. The search is run again once all details
+    // have been evaluated, as they may add new results.
+    updateCounts(pluginItemModel->getGeneralMessages(),
+                 pluginItemModel->getPluginItems());
+  }
+
   if (roles.isEmpty() || roles.contains(RawDataRole) ||
       roles.contains(CardContentFiltersRole)) {
     updateCounts(pluginItemModel->getGeneralMessages(),
@@ -2045,15 +2682,6 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
     proxyModel->clearSearchResults();
   }
 
-  if (roles.isEmpty() || roles.contains(RawDataRole)) {
-    // Also update the plugin name lists in the filters sidebar panel and the
-    // metadata editor's autocompletions in case raw data changed because the
-    // game was changed or content was refreshed.
-    auto pluginNames = pluginItemModel->getPluginNames();
-
-    filtersWidget->setPlugins(pluginNames);
-    pluginEditorWidget->setFilenameCompletions(pluginNames);
-  }
 }
 
 void MainWindow::on_pluginItemModel_rowsInserted(const QModelIndex&,
@@ -2136,10 +2764,11 @@ void MainWindow::on_filtersWidget_conflictsFilterChanged(
 
     handleProgressUpdate(translate("Identifying conflicting plugins..."));
 
-    std::unique_ptr<Query> query = std::make_unique<GetConflictingPluginsQuery>(
-        state.GetCurrentGame(),
-        state.getSettings().getLanguage(),
-        targetPluginName.value());
+    std::unique_ptr<Query> query =
+        std::make_unique<GetConflictingPluginsQuery<>>(
+            state.GetCurrentGame(),
+            state.getSettings().getLanguage(),
+            targetPluginName.value());
 
     executeBackgroundQuery(
         std::move(query), &MainWindow::handleConflictsChecked, nullptr);
@@ -2163,6 +2792,9 @@ void MainWindow::on_settingsDialog_accepted() {
     if (state.getSettings().getTheme() != currentTheme) {
       applyTheme();
     }
+
+    menuDebug->menuAction()->setVisible(
+        state.getSettings().isDebugLoggingEnabled());
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2355,6 +2987,39 @@ void MainWindow::handleConflictsChecked(QueryResult result) {
     // Load order state was refreshed when plugins were loaded, so check for
     // ambiguity.
     checkForAmbiguousLoadOrder();
+
+    scheduleFullPluginDataDiscard();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::on_fullPluginDataTimer_timeout() {
+  try {
+    if (!state.HasCurrentGame()) {
+      return;
+    }
+
+    discardFullPluginData();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleReportExported(QueryResult) {
+  try {
+    progressDialog->reset();
+
+    showNotification(translate("The report has been exported."));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleFilenameCompletionsBuilt(QueryResult result) {
+  try {
+    pluginEditorWidget->setFilenameCompletions(
+        std::get<std::shared_ptr<const CompletionIndex>>(result));
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2366,6 +3031,25 @@ void MainWindow::handleProgressUpdate(const QString& message) {
   progressDialog->adjustSize();
 }
 
+void MainWindow::handleQueryTimed(QueryTiming timing) {
+  // Only the most recent timings are kept so that a long-running session
+  // doesn't accumulate them without bound.
+  static constexpr size_t MAX_QUERY_TIMINGS = 1000;
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->debug("{} took {} microseconds",
+                  timing.queryName,
+                  timing.duration.count());
+  }
+
+  queryTimings.push_back(std::move(timing));
+
+  if (queryTimings.size() > MAX_QUERY_TIMINGS) {
+    queryTimings.pop_front();
+  }
+}
+
 void MainWindow::handleUpdateCheckFinished(QueryResult result) {
   try {
     const bool updateIsAvailable = std::get<bool>(result);
@@ -2411,7 +3095,73 @@ void MainWindow::handleUpdateCheckError(const std::string&) {
   }
 }
 
-void MainWindow::handleWorkerThreadFinished() { progressDialog->reset(); }
+void MainWindow::handlePluginDetailsEvaluated(QueryResult result) {
+  try {
+    pluginItemModel->mergePluginItemDetails(
+        std::move(std::get<PluginItems>(result)));
+
+    if (!getUnevaluatedPluginNames(1).empty()) {
+      return;
+    }
+
+    if (searchDialog->isVisible()) {
+      searchDialog->refreshSearch();
+    }
+
+    const auto actions = std::move(actionsAwaitingPluginDetails);
+    actionsAwaitingPluginDetails.clear();
+    for (const auto& action : actions) {
+      action();
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginDetailsError(const std::string& message) {
+  // Don't keep retrying the same plugins in the background.
+  hasPluginDetailsEvaluationFailed = true;
+
+  // Don't run anything that needed the details that couldn't be evaluated.
+  actionsAwaitingPluginDetails.clear();
+
+  handleError(message);
+}
+
+void MainWindow::handleWorkerThreadFinished() {
+  progressDialog->reset();
+
+  activeExecutorCount -= 1;
+  if (activeExecutorCount == 0) {
+    runIdleGameTasks();
+  }
+}
+
+void MainWindow::handlePluginDetailsWorkerThreadFinished() {
+  isEvaluatingPluginDetails = false;
+
+  if (!deferredExecutors.empty()) {
+    for (const auto executor : deferredExecutors) {
+      executor->start();
+    }
+    deferredExecutors.clear();
+  } else if (activeExecutorCount == 0) {
+    runIdleGameTasks();
+  }
+}
+
+void MainWindow::handleFullPluginDataDiscardFinished() {
+  isDiscardingFullPluginData = false;
+
+  if (!deferredExecutors.empty()) {
+    for (const auto executor : deferredExecutors) {
+      executor->start();
+    }
+    deferredExecutors.clear();
+  } else if (activeExecutorCount == 0) {
+    runIdleGameTasks();
+  }
+}
 
 void MainWindow::handleIconColorChanged() {
   IconFactory::setColours(
@@ -2455,4 +3205,15 @@ void MainWindow::handleLinkColorChanged() {
     pluginCardsView->reset();
   }
 }
+
+void MainWindow::handleSearchResultColorChanged() {
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+
+  if (cardDelegate) {
+    cardDelegate->setSearchResultColors(searchResultColor,
+                                        currentSearchResultColor);
+    pluginCardsView->viewport()->update();
+  }
+}
 }
@@ -34,6 +34,7 @@
 #include <QtWidgets/QAction>
 #endif
 
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
 #include <QtCore/QVariant>
 #include <QtWidgets/QApplication>
@@ -60,13 +61,17 @@
 #include <QtWidgets/QToolButton>
 #include <QtWidgets/QVBoxLayout>
 #include <QtWidgets/QWidget>
+#include <deque>
+#include <functional>
 
 #include "gui/qt/card_delegate.h"
+#include "gui/qt/evaluation_costs_dialog.h"
 #include "gui/qt/filters_widget.h"
 #include "gui/qt/groups_editor/groups_editor_dialog.h"
 #include "gui/qt/plugin_editor/plugin_editor_widget.h"
 #include "gui/qt/plugin_item_filter_model.h"
 #include "gui/qt/plugin_item_model.h"
+#include "gui/qt/report_writer.h"
 #include "gui/qt/search_dialog.h"
 #include "gui/qt/settings/settings_dialog.h"
 #include "gui/qt/tasks/tasks.h"
@@ -89,11 +94,16 @@ class MainWindow : public QMainWindow {
                  unselectedSidebarPluginGroupColor NOTIFY
                      unselectedSidebarPluginGroupColorChanged)
   Q_PROPERTY(QColor linkColor MEMBER linkColor NOTIFY linkColorChanged)
+  Q_PROPERTY(QColor searchResultColor MEMBER searchResultColor NOTIFY
+                 searchResultColorChanged)
+  Q_PROPERTY(QColor currentSearchResultColor MEMBER currentSearchResultColor
+                 NOTIFY searchResultColorChanged)
 
 public:
   explicit MainWindow(LootState &state, QWidget *parent = nullptr);
 
   void initialise();
+  void replaySession(const std::filesystem::path &snapshotPath);
   void applyTheme();
 
 signals:
@@ -106,6 +116,8 @@ signals:
 
   void linkColorChanged();
 
+  void searchResultColorChanged();
+
 private:
   LootState &state;
 
@@ -122,6 +134,7 @@ private:
   QAction *actionOpenGroupsEditor{new QAction(this)};
   QAction *actionCopyLoadOrder{new QAction(this)};
   QAction *actionCopyContent{new QAction(this)};
+  QAction *actionExportReport{new QAction(this)};
   QAction *actionRefreshContent{new QAction(this)};
   QAction *actionRedatePlugins{new QAction(this)};
   QAction *actionFixAmbiguousLoadOrder{new QAction(this)};
@@ -133,16 +146,31 @@ private:
   QAction *actionClearMetadata{new QAction(this)};
   QAction *actionSettings{new QAction(this)};
   QAction *actionBackupData{new QAction(this)};
+  QAction *actionCaptureSession{new QAction(this)};
+  QAction *actionViewEvaluationCosts{new QAction(this)};
+  QAction *actionSaveEvaluationCosts{new QAction(this)};
 
   QMenuBar *menubar{new QMenuBar(this)};
   QMenu *menuFile{new QMenu(menubar)};
   QMenu *menuHelp{new QMenu(menubar)};
   QMenu *menuGame{new QMenu(menubar)};
   QMenu *menuPlugin{new QMenu(menubar)};
+  QMenu *menuDebug{new QMenu(menubar)};
   QStatusBar *statusbar{new QStatusBar(this)};
   QToolBar *toolBar{new QToolBar(this)};
   QComboBox *gameComboBox{new QComboBox(toolBar)};
   QProgressDialog *progressDialog{new QProgressDialog(this)};
+  QTimer *fullPluginDataTimer{new QTimer(this)};
+  bool isEvaluatingPluginDetails{false};
+  bool isDiscardingFullPluginData{false};
+  bool isFullPluginDataDiscardPending{false};
+  bool hasPluginDetailsEvaluationFailed{false};
+  int activeExecutorCount{0};
+  std::vector<TaskExecutor *> deferredExecutors;
+  std::deque<QueryTiming> queryTimings;
+  bool isReplayingSession{false};
+  size_t filenameCompletionsRevision{0};
+  std::vector<std::function<void()>> actionsAwaitingPluginDetails;
 
   QSplitter *sidebarSplitter{new QSplitter(this)};
   QToolBox *toolBox{new QToolBox(sidebarSplitter)};
@@ -159,10 +187,12 @@ private:
 
   SettingsDialog *settingsDialog{new SettingsDialog(this)};
   SearchDialog *searchDialog{new SearchDialog(this)};
+  EvaluationCostsDialog *evaluationCostsDialog{
+      new EvaluationCostsDialog(this)};
 
   PluginItemModel *pluginItemModel{new PluginItemModel(this)};
   PluginItemFilterModel *proxyModel{new PluginItemFilterModel(this)};
-  CardSizingCache cardSizingCache{pluginCardsView->viewport()};
+  CardSizingCache cardSizingCache;
 
   GroupsEditorDialog *groupsEditor{
       new GroupsEditorDialog(this, pluginItemModel)};
@@ -178,6 +208,9 @@ private:
 
   QColor linkColor;
 
+  QColor searchResultColor;
+  QColor currentSearchResultColor;
+
   std::vector<std::string> themes;
 
   void setupUi();
@@ -205,6 +238,9 @@ private:
   void updateGeneralInformation();
   void updateGeneralMessages();
   void updateSidebarColumnWidths();
+  void loadCardSizes();
+  void saveCardSizes();
+  void saveConditionResults();
   void setFiltersState(PluginFiltersState &&state);
   void setFiltersState(PluginFiltersState &&state,
                        std::vector<std::string> &&conflictingPluginNames);
@@ -241,14 +277,34 @@ private:
 
   void checkForAmbiguousLoadOrder();
 
+  void scheduleFullPluginDataDiscard();
+  void discardFullPluginData();
+
+  void buildFilenameCompletions();
+
+  std::vector<std::string> getUnevaluatedPluginNames(size_t maxCount) const;
+  void evaluatePluginDetails();
+  void evaluateAllPluginDetails();
+  // Runs the given action once every plugin's details have been evaluated,
+  // which is immediately if they already have been.
+  void runWithAllPluginDetails(std::function<void()> action);
+  void runIdleGameTasks();
+
+  void captureSession(const std::filesystem::path &filePath);
+  void copyContent();
+  void exportReport(const std::filesystem::path &filePath,
+                    ReportFormat format);
+
 private slots:
   void on_actionSettings_triggered();
   void on_actionBackupData_triggered();
+  void on_actionCaptureSession_triggered();
   void on_actionQuit_triggered();
   void on_actionOpenGroupsEditor_triggered();
   void on_actionSearch_triggered();
   void on_actionCopyLoadOrder_triggered();
   void on_actionCopyContent_triggered();
+  void on_actionExportReport_triggered();
   void on_actionFixAmbiguousLoadOrder_triggered();
   void on_actionRefreshContent_triggered();
   void on_actionRedatePlugins_triggered();
@@ -262,6 +318,8 @@ private slots:
   void on_actionOpenLOOTDataFolder_triggered();
   void on_actionJoinDiscordServer_triggered();
   void on_actionAbout_triggered();
+  void on_actionViewEvaluationCosts_triggered();
+  void on_actionSaveEvaluationCosts_triggered();
 
   void on_gameComboBox_activated(int index);
   void on_actionSort_triggered();
@@ -308,6 +366,8 @@ private slots:
   void on_searchDialog_textChanged(const QVariant &text);
   void on_searchDialog_currentResultChanged(size_t resultIndex);
 
+  void on_fullPluginDataTimer_timeout();
+
   void handleGameChanged(QueryResult result);
   void handleRefreshGameDataLoaded(QueryResult result);
   void handleStartupGameDataLoaded(QueryResult result);
@@ -315,14 +375,22 @@ private slots:
   void handlePluginsAutoSorted(QueryResult results);
   void handleMasterlistUpdated(QueryResult result);
   void handleConflictsChecked(QueryResult result);
+  void handleReportExported(QueryResult result);
+  void handleFilenameCompletionsBuilt(QueryResult result);
   void handleProgressUpdate(const QString &message);
+  void handleQueryTimed(QueryTiming timing);
   void handleUpdateCheckFinished(QueryResult result);
   void handleUpdateCheckError(const std::string &);
+  void handlePluginDetailsEvaluated(QueryResult result);
+  void handlePluginDetailsError(const std::string &message);
   void handleWorkerThreadFinished();
+  void handlePluginDetailsWorkerThreadFinished();
+  void handleFullPluginDataDiscardFinished();
 
   void handleIconColorChanged();
   void handleSidebarTextColorChanged();
   void handleLinkColorChanged();
+  void handleSearchResultColorChanged();
 };
 }
 
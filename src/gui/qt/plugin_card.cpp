@@ -28,38 +28,11 @@
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QStyle>
 #include <QtWidgets/QVBoxLayout>
-#include <boost/algorithm/string.hpp>
-#include <boost/format.hpp>
-#include <boost/locale.hpp>
 
-#include "gui/helpers.h"
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
 
 namespace loot {
-static constexpr int ATTRIBUTE_ICON_HEIGHT = 18;
-
-void setIcon(QLabel* label, QIcon icon) {
-  label->setPixmap(IconFactory::getPixmap(icon, ATTRIBUTE_ICON_HEIGHT));
-}
-
-QString getTagsText(const std::vector<std::string> tags, bool hideTags) {
-  if (hideTags) {
-    return "";
-  }
-
-  QStringList tagsList;
-  for (const auto& tag : tags) {
-    tagsList.append(QString::fromStdString(tag));
-  }
-
-  if (tagsList.isEmpty()) {
-    return "";
-  }
-
-  return tagsList.join(", ");
-}
-
 std::vector<SimpleMessage> filterMessages(
     const std::vector<SimpleMessage>& messages,
     const CardContentFiltersState& filters) {
@@ -79,28 +52,28 @@ std::vector<SimpleMessage> filterMessages(
 PluginCard::PluginCard(QWidget* parent) : QFrame(parent) { setupUi(); }
 
 void PluginCard::setIcons() {
-  setIcon(isActiveLabel, IconFactory::getIsActiveIcon());
-  setIcon(masterFileLabel, IconFactory::getMasterFileIcon());
-  setIcon(lightPluginLabel, IconFactory::getLightPluginIcon());
-  setIcon(emptyPluginLabel, IconFactory::getEmptyPluginIcon());
-  setIcon(loadsArchiveLabel, IconFactory::getLoadsArchiveIcon());
-  setIcon(isCleanLabel, IconFactory::getIsCleanIcon());
-  setIcon(hasUserEditsLabel, IconFactory::getHasUserMetadataIcon());
+  isActiveLabel->setIcon(IconFactory::getIsActiveIcon());
+  masterFileLabel->setIcon(IconFactory::getMasterFileIcon());
+  lightPluginLabel->setIcon(IconFactory::getLightPluginIcon());
+  emptyPluginLabel->setIcon(IconFactory::getEmptyPluginIcon());
+  loadsArchiveLabel->setIcon(IconFactory::getLoadsArchiveIcon());
+  isCleanLabel->setIcon(IconFactory::getIsCleanIcon());
+  hasUserEditsLabel->setIcon(IconFactory::getHasUserMetadataIcon());
 }
 
 void PluginCard::setContent(const PluginItem& plugin,
+                            const PluginItemDisplayStrings& strings,
                             const CardContentFiltersState& filters) {
-  nameLabel->setText(QString::fromStdString(plugin.name));
+  nameLabel->setText(strings.name);
 
   if (plugin.crc.has_value() && !filters.hideCRCs) {
-    auto crc = crcToString(plugin.crc.value());
-    crcLabel->setText(QString::fromStdString(crc));
+    crcLabel->setText(strings.crc);
   } else {
     crcLabel->clear();
   }
 
   if (plugin.version.has_value() && !filters.hideVersionNumbers) {
-    versionLabel->setText(QString::fromStdString(plugin.version.value()));
+    versionLabel->setText(strings.version);
   } else {
     versionLabel->clear();
   }
@@ -113,9 +86,11 @@ void PluginCard::setContent(const PluginItem& plugin,
   isCleanLabel->setVisible(plugin.cleaningUtility.has_value());
   hasUserEditsLabel->setVisible(plugin.hasUserMetadata);
 
-  auto currentTagsText = getTagsText(plugin.currentTags, filters.hideBashTags);
-  auto addTagsText = getTagsText(plugin.addTags, filters.hideBashTags);
-  auto removeTagsText = getTagsText(plugin.removeTags, filters.hideBashTags);
+  const auto currentTagsText =
+      filters.hideBashTags ? QString() : strings.currentTags;
+  const auto addTagsText = filters.hideBashTags ? QString() : strings.addTags;
+  const auto removeTagsText =
+      filters.hideBashTags ? QString() : strings.removeTags;
 
   const auto showBashTags = !currentTagsText.isEmpty() ||
                             !addTagsText.isEmpty() || !removeTagsText.isEmpty();
@@ -141,21 +116,7 @@ void PluginCard::setContent(const PluginItem& plugin,
   const auto showLocations =
       !plugin.locations.empty() && !filters.hideLocations;
   if (showLocations) {
-    std::vector<std::string> locationLinks;
-    std::transform(plugin.locations.begin(),
-                   plugin.locations.end(),
-                   std::back_inserter(locationLinks),
-                   [](const auto& location) {
-                     return "[" + location.GetName() + "](" +
-                            location.GetURL() + ")";
-                   });
-
-    std::string locationsText = plugin.locations.size() == 1
-                                    ? boost::locale::translate("Source:")
-                                    : boost::locale::translate("Sources:");
-    locationsText += "  " + boost::join(locationLinks, u8" \uFF5C ");
-
-    locationsLabel->setText(QString::fromStdString(locationsText));
+    locationsLabel->setText(strings.locations);
   }
 
   locationsLabel->setVisible(showLocations);
@@ -166,15 +127,7 @@ void PluginCard::setContent(const PluginItem& plugin,
   }
   messagesWidget->setVisible(!messages.empty());
 
-  if (plugin.cleaningUtility.has_value()) {
-    auto cleanText =
-        (boost::format(boost::locale::translate("Verified clean by %s")) %
-         plugin.cleaningUtility.value())
-            .str();
-    isCleanLabel->setToolTip(QString::fromStdString(cleanText));
-  } else {
-    isCleanLabel->setToolTip(QString());
-  }
+  isCleanLabel->setToolTip(strings.cleaningUtilityToolTip);
 
   layout()->activate();
 }
@@ -237,7 +190,7 @@ void PluginCard::setupUi() {
 
   messagesWidget->setVisible(false);
 
-  locationsLabel->setTextFormat(Qt::MarkdownText);
+  locationsLabel->setTextFormat(Qt::RichText);
   locationsLabel->setOpenExternalLinks(true);
   locationsLabel->setWordWrap(true);
   locationsLabel->setVisible(false);
@@ -32,11 +32,11 @@
 
 #include "gui/plugin_item.h"
 #include "gui/qt/filters_states.h"
+#include "gui/qt/icon_widget.h"
 #include "gui/qt/messages_widget.h"
+#include "gui/qt/plugin_item_display_strings.h"
 
 namespace loot {
-QString getTagsText(const std::vector<std::string> tags, bool hideTags);
-
 std::vector<SimpleMessage> filterMessages(
     const std::vector<SimpleMessage>& messages,
     const CardContentFiltersState& filters);
@@ -49,6 +49,7 @@ public:
   void setIcons();
 
   void setContent(const PluginItem& plugin,
+                  const PluginItemDisplayStrings& strings,
                   const CardContentFiltersState& filters);
 
   void setSearchResult(bool isSearchResult, bool isCurrentSearchResult);
@@ -56,16 +57,18 @@ public:
   void refreshMessages();
 
 private:
+  static constexpr int ATTRIBUTE_ICON_HEIGHT = 18;
+
   QLabel* nameLabel{new QLabel(this)};
   QLabel* crcLabel{new QLabel(this)};
   QLabel* versionLabel{new QLabel(this)};
-  QLabel* isActiveLabel{new QLabel(this)};
-  QLabel* masterFileLabel{new QLabel(this)};
-  QLabel* lightPluginLabel{new QLabel(this)};
-  QLabel* emptyPluginLabel{new QLabel(this)};
-  QLabel* loadsArchiveLabel{new QLabel(this)};
-  QLabel* isCleanLabel{new QLabel(this)};
-  QLabel* hasUserEditsLabel{new QLabel(this)};
+  IconWidget* isActiveLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* masterFileLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* lightPluginLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* emptyPluginLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* loadsArchiveLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* isCleanLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
+  IconWidget* hasUserEditsLabel{new IconWidget(this, ATTRIBUTE_ICON_HEIGHT)};
   QLabel* currentTagsHeaderLabel{new QLabel(this)};
   QLabel* currentTagsLabel{new QLabel(this)};
   QLabel* addTagsHeaderLabel{new QLabel(this)};
@@ -0,0 +1,208 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_editor/column_width_cache.h"
+
+#include <numeric>
+
+namespace loot {
+void removeColumnWidth(std::map<int, size_t>& widthCounts, int width) {
+  const auto it = widthCounts.find(width);
+  if (it == widthCounts.end()) {
+    return;
+  }
+
+  it->second -= 1;
+  if (it->second == 0) {
+    widthCounts.erase(it);
+  }
+}
+
+void ColumnWidthCache::ColumnWidths::insert(size_t firstRow,
+                                            const std::vector<int>& widths) {
+  rowWidths.insert(rowWidths.begin() + firstRow, widths.begin(), widths.end());
+
+  for (const auto width : widths) {
+    widthCounts[width] += 1;
+  }
+}
+
+void ColumnWidthCache::ColumnWidths::erase(size_t first, size_t last) {
+  for (auto i = first; i <= last; i += 1) {
+    removeColumnWidth(widthCounts, rowWidths.at(i));
+  }
+
+  rowWidths.erase(rowWidths.begin() + first, rowWidths.begin() + last + 1);
+}
+
+void ColumnWidthCache::ColumnWidths::update(size_t row, int width) {
+  auto& rowWidth = rowWidths.at(row);
+  if (rowWidth == width) {
+    return;
+  }
+
+  removeColumnWidth(widthCounts, rowWidth);
+  widthCounts[width] += 1;
+  rowWidth = width;
+}
+
+ColumnWidthCache::ColumnWidthCache(QObject* parent, ItemMeasurer measureItem) :
+    QObject(parent), measureItem(measureItem) {}
+
+void ColumnWidthCache::setModel(const QAbstractItemModel* newModel) {
+  for (const auto& connection : connections) {
+    disconnect(connection);
+  }
+  connections.clear();
+
+  model = newModel;
+
+  if (model != nullptr) {
+    connections = {
+        connect(model,
+                &QAbstractItemModel::rowsInserted,
+                this,
+                &ColumnWidthCache::onRowsInserted),
+        connect(model,
+                &QAbstractItemModel::rowsRemoved,
+                this,
+                &ColumnWidthCache::onRowsRemoved),
+        connect(model,
+                &QAbstractItemModel::dataChanged,
+                this,
+                &ColumnWidthCache::onDataChanged),
+        connect(model,
+                &QAbstractItemModel::modelReset,
+                this,
+                &ColumnWidthCache::reset),
+        connect(model,
+                &QAbstractItemModel::layoutChanged,
+                this,
+                &ColumnWidthCache::reset),
+        connect(model,
+                &QAbstractItemModel::columnsInserted,
+                this,
+                &ColumnWidthCache::reset),
+        connect(model,
+                &QAbstractItemModel::columnsRemoved,
+                this,
+                &ColumnWidthCache::reset),
+    };
+  }
+
+  reset();
+}
+
+int ColumnWidthCache::getMaxContentWidth(int column) const {
+  if (column < 0 || static_cast<size_t>(column) >= columns.size()) {
+    return 0;
+  }
+
+  const auto& widthCounts = columns.at(column).widthCounts;
+  if (widthCounts.empty()) {
+    return 0;
+  }
+
+  return widthCounts.rbegin()->first;
+}
+
+void ColumnWidthCache::reset() {
+  columns.clear();
+
+  if (model == nullptr) {
+    return;
+  }
+
+  columns.resize(model->columnCount());
+  onRowsInserted(QModelIndex(), 0, model->rowCount() - 1);
+}
+
+void ColumnWidthCache::onRowsInserted(const QModelIndex& parent,
+                                      int first,
+                                      int last) {
+  if (parent.isValid() || first > last) {
+    return;
+  }
+
+  for (size_t i = 0; i < columns.size(); i += 1) {
+    const auto column = static_cast<int>(i);
+
+    std::vector<int> widths;
+    widths.reserve(last - first + 1);
+    for (auto row = first; row <= last; row += 1) {
+      widths.push_back(measureItem(model->index(row, column)));
+    }
+
+    columns.at(i).insert(first, widths);
+  }
+}
+
+void ColumnWidthCache::onRowsRemoved(const QModelIndex& parent,
+                                     int first,
+                                     int last) {
+  if (parent.isValid() || first > last) {
+    return;
+  }
+
+  for (auto& column : columns) {
+    column.erase(first, last);
+  }
+}
+
+void ColumnWidthCache::onDataChanged(const QModelIndex& topLeft,
+                                     const QModelIndex& bottomRight) {
+  if (!topLeft.isValid() || !bottomRight.isValid() ||
+      topLeft.parent().isValid()) {
+    return;
+  }
+
+  for (auto column = topLeft.column(); column <= bottomRight.column();
+       column += 1) {
+    for (auto row = topLeft.row(); row <= bottomRight.row(); row += 1) {
+      const auto index = model->index(row, column);
+      columns.at(column).update(row, measureItem(index));
+    }
+  }
+}
+
+std::vector<int> scaleColumnWidths(const std::vector<int>& widths,
+                                   int totalWidth) {
+  const auto widthsSum = std::accumulate(widths.begin(), widths.end(), 0.0);
+  if (widthsSum == 0) {
+    // Don't divide by zero.
+    return widths;
+  }
+
+  const auto scalingFactor = static_cast<double>(totalWidth) / widthsSum;
+
+  std::vector<int> scaledWidths;
+  scaledWidths.reserve(widths.size());
+  for (const auto width : widths) {
+    scaledWidths.push_back(static_cast<int>(width * scalingFactor));
+  }
+
+  return scaledWidths;
+}
+}
@@ -0,0 +1,81 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_EDITOR_COLUMN_WIDTH_CACHE
+#define LOOT_GUI_QT_PLUGIN_EDITOR_COLUMN_WIDTH_CACHE
+
+#include <QtCore/QAbstractItemModel>
+#include <QtCore/QObject>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace loot {
+// Keeps track of the width of the widest item in each column of a model,
+// updating it as rows are inserted, removed or changed, so that a view can
+// be resized without measuring every item again.
+class ColumnWidthCache : public QObject {
+public:
+  typedef std::function<int(const QModelIndex& index)> ItemMeasurer;
+
+  ColumnWidthCache(QObject* parent, ItemMeasurer measureItem);
+
+  void setModel(const QAbstractItemModel* model);
+
+  // Returns 0 if the column has no items.
+  int getMaxContentWidth(int column) const;
+
+private:
+  struct ColumnWidths {
+    std::vector<int> rowWidths;
+    // Counts the rows that have each width, so that the maximum is still
+    // known after the widest row is removed.
+    std::map<int, size_t> widthCounts;
+
+    void insert(size_t firstRow, const std::vector<int>& widths);
+    void erase(size_t first, size_t last);
+    void update(size_t row, int width);
+  };
+
+  ItemMeasurer measureItem;
+  const QAbstractItemModel* model{nullptr};
+  std::vector<ColumnWidths> columns;
+  std::vector<QMetaObject::Connection> connections;
+
+  void reset();
+  void onRowsInserted(const QModelIndex& parent, int first, int last);
+  void onRowsRemoved(const QModelIndex& parent, int first, int last);
+  void onDataChanged(const QModelIndex& topLeft,
+                     const QModelIndex& bottomRight);
+};
+
+// Scales the given widths so that they add up to the given total width,
+// keeping their proportions. If the widths add up to zero, they're returned
+// unchanged.
+std::vector<int> scaleColumnWidths(const std::vector<int>& widths,
+                                   int totalWidth);
+}
+
+#endif
@@ -28,11 +28,11 @@
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
 #include <QtWidgets/QComboBox>
-#include <QtWidgets/QCompleter>
 #include <QtWidgets/QLineEdit>
 
 #include "gui/qt/helpers.h"
 #include "gui/qt/plugin_editor/message_content_editor.h"
+#include "gui/qt/plugin_editor/models/fuzzy_completion_model.h"
 
 namespace loot {
 ComboBoxDelegate::ComboBoxDelegate(
@@ -163,18 +163,15 @@ bool MessageContentDelegate::eventFilter(QObject* editor, QEvent* event) {
 
 AutocompletingLineEditDelegate::AutocompletingLineEditDelegate(
     QObject* parent,
-    const QStringList& completions) :
+    const std::shared_ptr<const CompletionIndex>& completions) :
     QStyledItemDelegate(parent), completions(completions) {}
 
 QWidget* AutocompletingLineEditDelegate::createEditor(
     QWidget* parent,
     const QStyleOptionViewItem&,
     const QModelIndex&) const {
-  auto completer = new QCompleter(completions, parent);
-  completer->setCaseSensitivity(Qt::CaseInsensitive);
-
   QLineEdit* lineEdit = new QLineEdit(parent);
-  lineEdit->setCompleter(completer);
+  lineEdit->setCompleter(createFuzzyCompleter(lineEdit, completions));
 
   return lineEdit;
 }
@@ -27,7 +27,9 @@
 #define LOOT_GUI_QT_PLUGIN_EDITOR_DELEGATES
 
 #include <QtWidgets/QStyledItemDelegate>
+#include <memory>
 
+#include "gui/qt/completion_index.h"
 #include "gui/state/loot_settings.h"
 
 namespace loot {
@@ -93,8 +95,9 @@ private:
 
 class AutocompletingLineEditDelegate : public QStyledItemDelegate {
 public:
-  AutocompletingLineEditDelegate(QObject* parent,
-                                 const QStringList& completions);
+  AutocompletingLineEditDelegate(
+      QObject* parent,
+      const std::shared_ptr<const CompletionIndex>& completions);
 
   QWidget* createEditor(QWidget* parent,
                         const QStyleOptionViewItem& option,
@@ -107,7 +110,7 @@ public:
                     const QModelIndex& index) const override;
 
 private:
-  const QStringList& completions;
+  const std::shared_ptr<const CompletionIndex>& completions;
 };
 }
 
@@ -42,6 +42,10 @@ void GroupTab::initialiseInputs(const std::vector<std::string>& groups,
                                 const std::optional<std::string>& userGroup) {
   groupComboBox->clear();
 
+  // Groups are few enough to index each time the inputs are initialised.
+  groupCompletionModel->setIndex(
+      std::make_shared<const CompletionIndex>(groups));
+
   for (const auto& group : groups) {
     groupComboBox->addItem(QString::fromStdString(group));
   }
@@ -73,7 +77,10 @@ void GroupTab::initialiseInputs(const std::vector<std::string>& groups,
 
 std::optional<std::string> GroupTab::getUserMetadata() const {
   // Only return the selected group if it's different from the nonUserGroupName.
-  auto name = groupComboBox->currentText().toStdString();
+  // Use the selected item's text rather than the current text, which may be
+  // partially typed.
+  auto name =
+      groupComboBox->itemText(groupComboBox->currentIndex()).toStdString();
 
   if (name == nonUserGroupName) {
     return std::nullopt;
@@ -87,10 +94,28 @@ void GroupTab::setupUi() {
 
   layout->addRow(groupLabel, groupComboBox);
 
-  connect(groupComboBox, &QComboBox::currentTextChanged, [this]() {
-    emit groupChanged(getUserMetadata().has_value());
+  // Typing suggests groups using the same fuzzy matching as the plugin editor's
+  // file inputs, but only existing groups can be selected.
+  groupComboBox->setEditable(true);
+  groupComboBox->setInsertPolicy(QComboBox::NoInsert);
+
+  const auto lineEdit = groupComboBox->lineEdit();
+  auto completer =
+      createFuzzyCompleter(lineEdit, std::make_shared<const CompletionIndex>());
+  groupCompletionModel =
+      qobject_cast<FuzzyCompletionModel*>(completer->model());
+  groupComboBox->setCompleter(completer);
+
+  // Don't leave text that doesn't match an item in the line edit.
+  connect(lineEdit, &QLineEdit::editingFinished, [this]() {
+    groupComboBox->setEditText(
+        groupComboBox->itemText(groupComboBox->currentIndex()));
   });
 
+  connect(groupComboBox,
+          QOverload<int>::of(&QComboBox::currentIndexChanged),
+          [this]() { emit groupChanged(getUserMetadata().has_value()); });
+
   translateUi();
 }
 
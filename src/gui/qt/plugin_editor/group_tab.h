@@ -31,6 +31,8 @@
 #include <QtWidgets/QWidget>
 #include <optional>
 
+#include "gui/qt/plugin_editor/models/fuzzy_completion_model.h"
+
 namespace loot {
 class GroupTab : public QWidget {
   Q_OBJECT
@@ -49,6 +51,7 @@ signals:
 private:
   QLabel* groupLabel{new QLabel(this)};
   QComboBox* groupComboBox{new QComboBox(this)};
+  FuzzyCompletionModel* groupCompletionModel{nullptr};
   std::string nonUserGroupName;
 
   void setupUi();
@@ -0,0 +1,99 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_editor/models/fuzzy_completion_model.h"
+
+namespace loot {
+static constexpr size_t MAX_COMPLETIONS = 20;
+
+FuzzyCompletionModel::FuzzyCompletionModel(
+    QObject* parent,
+    std::shared_ptr<const CompletionIndex> index) :
+    QAbstractListModel(parent), index(std::move(index)) {}
+
+void FuzzyCompletionModel::setIndex(
+    std::shared_ptr<const CompletionIndex> newIndex) {
+  beginResetModel();
+
+  index = std::move(newIndex);
+  matches.clear();
+
+  endResetModel();
+}
+
+void FuzzyCompletionModel::setText(const QString& text) {
+  beginResetModel();
+
+  if (index) {
+    matches = index->find(text.toStdString(), MAX_COMPLETIONS);
+  } else {
+    matches.clear();
+  }
+
+  endResetModel();
+}
+
+int FuzzyCompletionModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(matches.size());
+}
+
+QVariant FuzzyCompletionModel::data(const QModelIndex& modelIndex,
+                                    int role) const {
+  if (!modelIndex.isValid() || modelIndex.row() >= rowCount()) {
+    return QVariant();
+  }
+
+  if (role != Qt::DisplayRole && role != Qt::EditRole) {
+    return QVariant();
+  }
+
+  const auto nameIndex = matches.at(modelIndex.row());
+  return QString::fromStdString(index->getName(nameIndex));
+}
+
+QCompleter* createFuzzyCompleter(
+    QLineEdit* lineEdit,
+    std::shared_ptr<const CompletionIndex> index) {
+  auto model = new FuzzyCompletionModel(lineEdit, std::move(index));
+
+  auto completer = new QCompleter(model, lineEdit);
+  completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+  completer->setCaseSensitivity(Qt::CaseInsensitive);
+
+  // The line edit shows the completer's popup after emitting textEdited, so
+  // the matches are updated before they're displayed. Highlighting a
+  // completion changes the text without emitting textEdited.
+  QObject::connect(lineEdit,
+                   &QLineEdit::textEdited,
+                   model,
+                   &FuzzyCompletionModel::setText);
+
+  return completer;
+}
+}
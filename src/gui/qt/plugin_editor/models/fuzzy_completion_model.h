@@ -0,0 +1,65 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_EDITOR_MODELS_FUZZY_COMPLETION_MODEL
+#define LOOT_GUI_QT_PLUGIN_EDITOR_MODELS_FUZZY_COMPLETION_MODEL
+
+#include <QtCore/QAbstractListModel>
+#include <QtWidgets/QCompleter>
+#include <QtWidgets/QLineEdit>
+#include <memory>
+
+#include "gui/qt/completion_index.h"
+
+namespace loot {
+// Holds the names in a completion index that best match the text that was
+// last set, best match first. QCompleter only supports prefix or substring
+// matching, so it's given this model unfiltered to show ranked fuzzy matches.
+class FuzzyCompletionModel : public QAbstractListModel {
+  Q_OBJECT
+public:
+  FuzzyCompletionModel(QObject* parent,
+                       std::shared_ptr<const CompletionIndex> index);
+
+  void setIndex(std::shared_ptr<const CompletionIndex> index);
+  void setText(const QString& text);
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& modelIndex,
+                int role = Qt::DisplayRole) const override;
+
+private:
+  std::shared_ptr<const CompletionIndex> index;
+  std::vector<size_t> matches;
+};
+
+// Creates a completer that suggests names from the given index as text is
+// typed into the line edit, which the caller must then set the completer on.
+QCompleter* createFuzzyCompleter(QLineEdit* lineEdit,
+                                 std::shared_ptr<const CompletionIndex> index);
+}
+
+#endif
@@ -45,20 +45,13 @@ PluginEditorWidget::PluginEditorWidget(
 
 void PluginEditorWidget::setBashTagCompletions(
     const std::vector<std::string> &knownBashTags) {
-  bashTagCompletions.clear();
-
-  for (const auto &bashTag : knownBashTags) {
-    bashTagCompletions.append(QString::fromStdString(bashTag));
-  }
+  // There are few enough known Bash Tags to index them immediately.
+  bashTagCompletions = std::make_shared<const CompletionIndex>(knownBashTags);
 }
 
 void PluginEditorWidget::setFilenameCompletions(
-    const std::vector<std::string> &knownFilenames) {
-  filenameCompletions.clear();
-
-  for (const auto &filename : knownFilenames) {
-    filenameCompletions.append(QString::fromStdString(filename));
-  }
+    std::shared_ptr<const CompletionIndex> filenameIndex) {
+  filenameCompletions = std::move(filenameIndex);
 }
 
 void PluginEditorWidget::initialiseInputs(
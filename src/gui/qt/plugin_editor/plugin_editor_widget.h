@@ -32,7 +32,9 @@
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QTabWidget>
 #include <QtWidgets/QWidget>
+#include <memory>
 
+#include "gui/qt/completion_index.h"
 #include "gui/qt/plugin_editor/group_tab.h"
 #include "gui/qt/plugin_editor/table_tabs.h"
 #include "gui/state/loot_settings.h"
@@ -46,7 +48,10 @@ public:
                      const std::string &language);
 
   void setBashTagCompletions(const std::vector<std::string> &knownBashTags);
-  void setFilenameCompletions(const std::vector<std::string> &knownFilenames);
+  // The filename completions index can be large, so it's built elsewhere
+  // (e.g. on a worker thread) and shared by the file inputs.
+  void setFilenameCompletions(
+      std::shared_ptr<const CompletionIndex> filenameIndex);
 
   void initialiseInputs(const std::vector<std::string> &groups,
                         const std::string &pluginName,
@@ -63,8 +68,10 @@ private:
   const std::vector<LootSettings::Language> &languages;
   const std::string language;
 
-  QStringList bashTagCompletions;
-  QStringList filenameCompletions;
+  std::shared_ptr<const CompletionIndex> bashTagCompletions{
+      std::make_shared<const CompletionIndex>()};
+  std::shared_ptr<const CompletionIndex> filenameCompletions{
+      std::make_shared<const CompletionIndex>()};
 
   QLabel *pluginLabel{new QLabel(this)};
   QTabWidget *tabs{new QTabWidget(this)};
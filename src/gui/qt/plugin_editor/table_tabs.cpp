@@ -30,6 +30,8 @@
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QHeaderView>
 #include <QtWidgets/QVBoxLayout>
+#include <algorithm>
+#include <numeric>
 
 #include "gui/qt/helpers.h"
 #include "gui/qt/plugin_editor/delegates.h"
@@ -129,6 +131,17 @@ int calculateMinimumColumnWidth(
   return maxTextWidth;
 }
 
+QStyleOptionViewItem MetadataTableView::getViewItemOption() const {
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
+  QStyleOptionViewItem option;
+  initViewItemOption(&option);
+
+  return option;
+#else
+  return viewOptions();
+#endif
+}
+
 BaseTableTab::BaseTableTab(QWidget* parent) : QWidget(parent) { setupUi(); }
 
 QAbstractItemModel* BaseTableTab::getTableModel() const {
@@ -142,6 +155,7 @@ void BaseTableTab::setTableModel(QAbstractItemModel* model) {
   tableView->setModel(model);
   tableView->horizontalHeader()->setMinimumSectionSize(
       calculateMinimumHeaderWidth(model));
+  columnWidthCache->setModel(model);
 
   if (oldModel != nullptr) {
     oldModel->deleteLater();
@@ -181,6 +195,9 @@ void BaseTableTab::setColumnHidden(int column, bool hide) {
 void BaseTableTab::setItemDelegateForColumn(int column,
                                             QStyledItemDelegate* delegate) {
   tableView->setItemDelegateForColumn(column, delegate);
+
+  // The delegate may size items differently, so measure them again.
+  columnWidthCache->setModel(tableView->model());
 }
 
 void BaseTableTab::setColumnFixedWidth(int column, int width) {
@@ -196,38 +213,34 @@ void BaseTableTab::configureAsDropTarget() {
 
 void BaseTableTab::resizeEvent(QResizeEvent*) {
   const auto header = tableView->horizontalHeader();
-  for (int i = 0; i < header->count(); i += 1) {
-    if (!header->isSectionHidden(i) &&
-        header->sectionResizeMode(i) != QHeaderView::Fixed) {
-      tableView->resizeColumnToContents(i);
-    }
-  }
-
-  const auto tableWidth = tableView->width();
 
-  // Some header sections are fixed width, we don't want to resize them,
-  // so exclude them from the headers width scaling factor calculation.
-  double headersWidth = 0;
+  // Fit the columns that aren't fixed width to their contents, then scale
+  // them to fill the table view. The content widths are cached because
+  // measuring them involves every row.
+  const auto gridWidth = tableView->showGrid() ? 1 : 0;
+  std::vector<int> columns;
+  std::vector<int> contentWidths;
   for (int i = 0; i < header->count(); i += 1) {
     if (!header->isSectionHidden(i) &&
         header->sectionResizeMode(i) != QHeaderView::Fixed) {
-      headersWidth += header->sectionSize(i);
+      const auto contentWidth =
+          columnWidthCache->getMaxContentWidth(i) + gridWidth;
+
+      columns.push_back(i);
+      contentWidths.push_back(
+          std::max(contentWidth, header->sectionSizeHint(i)));
     }
   }
 
-  if (headersWidth == 0) {
-    // Don't divide by zero.
+  if (std::accumulate(contentWidths.begin(), contentWidths.end(), 0) == 0) {
+    // There's nothing to scale.
     return;
   }
 
-  const auto scalingFactor = static_cast<double>(tableWidth) / headersWidth;
-
-  for (auto i = 0; i < header->count(); i += 1) {
-    const int newColumnWidth =
-        static_cast<int>(tableView->columnWidth(i) * scalingFactor);
-    if (header->sectionResizeMode(i) != QHeaderView::Fixed) {
-      tableView->setColumnWidth(i, newColumnWidth);
-    }
+  const auto columnWidths =
+      scaleColumnWidths(contentWidths, tableView->width());
+  for (size_t i = 0; i < columns.size(); i += 1) {
+    tableView->setColumnWidth(columns.at(i), columnWidths.at(i));
   }
 
   // If the headers are now wider than the table view (e.g. due to rounding
@@ -247,6 +260,15 @@ void BaseTableTab::resizeEvent(QResizeEvent*) {
   }
 }
 
+int BaseTableTab::measureItemWidth(const QModelIndex& index) const {
+  auto delegate = tableView->itemDelegateForColumn(index.column());
+  if (delegate == nullptr) {
+    delegate = tableView->itemDelegate();
+  }
+
+  return delegate->sizeHint(tableView->getViewItemOption(), index).width();
+}
+
 void BaseTableTab::setupUi() {
   tableView->setTabKeyNavigation(false);
   tableView->verticalHeader()->hide();
@@ -332,10 +354,11 @@ void BaseTableTab::onModelRowsRemoved() {
   emit tableRowCountChanged(hasUserMetadata());
 }
 
-FileTableTab::FileTableTab(QWidget* parent,
-                           const std::vector<LootSettings::Language>& languages,
-                           const std::string& language,
-                           const QStringList& completions) :
+FileTableTab::FileTableTab(
+    QWidget* parent,
+    const std::vector<LootSettings::Language>& languages,
+    const std::string& language,
+    const std::shared_ptr<const CompletionIndex>& completions) :
     MetadataTableTab(parent),
     languages(languages),
     language(language),
@@ -515,7 +538,9 @@ bool CleaningDataTableTab::hasUserMetadata() const {
   return !getUserMetadata().empty();
 }
 
-TagTableTab::TagTableTab(QWidget* parent, const QStringList& completions) :
+TagTableTab::TagTableTab(
+    QWidget* parent,
+    const std::shared_ptr<const CompletionIndex>& completions) :
     MetadataTableTab(parent), completions(completions) {}
 
 void TagTableTab::initialiseInputs(const std::vector<Tag>& nonUserMetadata,
@@ -38,10 +38,22 @@
 #include <QtWidgets/QStyledItemDelegate>
 #include <QtWidgets/QTableView>
 #include <QtWidgets/QWidget>
+#include <memory>
 
+#include "gui/qt/completion_index.h"
+#include "gui/qt/plugin_editor/column_width_cache.h"
 #include "gui/state/loot_settings.h"
 
 namespace loot {
+// Exposes the options that the view uses to draw its items, so that items can
+// be measured the same way outside of the view.
+class MetadataTableView : public QTableView {
+public:
+  using QTableView::QTableView;
+
+  QStyleOptionViewItem getViewItemOption() const;
+};
+
 class BaseTableTab : public QWidget {
   Q_OBJECT
 public:
@@ -63,13 +75,19 @@ protected:
   void resizeEvent(QResizeEvent* event) override;
 
 private:
-  QTableView* tableView{new QTableView(this)};
+  MetadataTableView* tableView{new MetadataTableView(this)};
   QPushButton* addNewRowButton{new QPushButton(this)};
   QPushButton* deleteRowButton{new QPushButton(this)};
+  ColumnWidthCache* columnWidthCache{
+      new ColumnWidthCache(this, [this](const QModelIndex& index) {
+        return measureItemWidth(index);
+      })};
 
   void setupUi();
   void translateUi();
 
+  int measureItemWidth(const QModelIndex& index) const;
+
 private slots:
   void on_addNewRowButton_clicked();
   void on_deleteRowButton_clicked();
@@ -97,7 +115,7 @@ public:
   FileTableTab(QWidget* parent,
                const std::vector<LootSettings::Language>& languages,
                const std::string& language,
-               const QStringList& completions);
+               const std::shared_ptr<const CompletionIndex>& completions);
 
   void initialiseInputs(const std::vector<File>& nonUserMetadata,
                         const std::vector<File>& userMetadata) override;
@@ -109,7 +127,7 @@ public:
 private:
   const std::vector<LootSettings::Language>& languages;
   const std::string& language;
-  const QStringList& completions;
+  const std::shared_ptr<const CompletionIndex>& completions;
 };
 
 class LoadAfterFileTableTab : public FileTableTab {
@@ -197,7 +215,8 @@ private:
 class TagTableTab : public MetadataTableTab<Tag> {
   Q_OBJECT
 public:
-  TagTableTab(QWidget* parent, const QStringList& completions);
+  TagTableTab(QWidget* parent,
+              const std::shared_ptr<const CompletionIndex>& completions);
 
   void initialiseInputs(const std::vector<Tag>& nonUserMetadata,
                         const std::vector<Tag>& userMetadata) override;
@@ -207,7 +226,7 @@ public:
   bool hasUserMetadata() const override;
 
 private:
-  const QStringList& completions;
+  const std::shared_ptr<const CompletionIndex>& completions;
 };
 }
 
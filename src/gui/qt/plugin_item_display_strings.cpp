@@ -0,0 +1,94 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_item_display_strings.h"
+
+#include <QtCore/QStringList>
+#include <boost/format.hpp>
+#include <boost/locale.hpp>
+
+#include "gui/helpers.h"
+
+namespace loot {
+QString joinTags(const std::vector<std::string>& tags) {
+  QStringList tagsList;
+  for (const auto& tag : tags) {
+    tagsList.append(QString::fromStdString(tag));
+  }
+
+  return tagsList.join(", ");
+}
+
+QString getLocationsHtml(const std::vector<Location>& locations) {
+  if (locations.empty()) {
+    return QString();
+  }
+
+  QStringList locationLinks;
+  for (const auto& location : locations) {
+    const auto url = QString::fromStdString(location.GetURL());
+    const auto name = QString::fromStdString(location.GetName());
+
+    locationLinks.append("<a href=\"" + url.toHtmlEscaped() + "\">" +
+                         name.toHtmlEscaped() + "</a>");
+  }
+
+  const std::string label = locations.size() == 1
+                                ? boost::locale::translate("Source:")
+                                : boost::locale::translate("Sources:");
+
+  return QString::fromStdString(label).toHtmlEscaped() + " " +
+         locationLinks.join(QString::fromUtf8(u8" \uFF5C "));
+}
+
+PluginItemDisplayStrings::PluginItemDisplayStrings(const PluginItem& plugin) :
+    name(QString::fromStdString(plugin.name)),
+    loadOrderIndex(QString::fromStdString(plugin.loadOrderIndexText())),
+    currentTags(joinTags(plugin.currentTags)),
+    addTags(joinTags(plugin.addTags)),
+    removeTags(joinTags(plugin.removeTags)),
+    locations(getLocationsHtml(plugin.locations)),
+    contentToSearch(QString::fromStdString(plugin.contentToSearch())) {
+  if (plugin.group.has_value()) {
+    group = QString::fromStdString(plugin.group.value());
+  }
+
+  if (plugin.crc.has_value()) {
+    crc = QString::fromStdString(crcToString(plugin.crc.value()));
+  }
+
+  if (plugin.version.has_value()) {
+    version = QString::fromStdString(plugin.version.value());
+  }
+
+  if (plugin.cleaningUtility.has_value()) {
+    const auto cleanText =
+        (boost::format(boost::locale::translate("Verified clean by %s")) %
+         plugin.cleaningUtility.value())
+            .str();
+    cleaningUtilityToolTip = QString::fromStdString(cleanText);
+  }
+}
+}
@@ -0,0 +1,59 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_ITEM_DISPLAY_STRINGS
+#define LOOT_GUI_QT_PLUGIN_ITEM_DISPLAY_STRINGS
+
+#include <QtCore/QMetaType>
+#include <QtCore/QString>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+// Text that views display for a plugin item, converted and formatted once
+// when the item enters the model so that painting and size hint calculation
+// only copy implicitly-shared QStrings.
+struct PluginItemDisplayStrings {
+  PluginItemDisplayStrings() = default;
+  explicit PluginItemDisplayStrings(const PluginItem& plugin);
+
+  QString name;
+  QString group;
+  QString loadOrderIndex;
+  QString crc;
+  QString version;
+  QString currentTags;
+  QString addTags;
+  QString removeTags;
+  // Rich text, so that displaying it doesn't involve parsing Markdown.
+  QString locations;
+  QString cleaningUtilityToolTip;
+  QString contentToSearch;
+};
+}
+
+Q_DECLARE_METATYPE(loot::PluginItemDisplayStrings);
+
+#endif
@@ -62,6 +62,11 @@ void PluginItemFilterModel::setFiltersState(
   invalidateFilter();
 }
 
+const std::vector<std::string>&
+PluginItemFilterModel::getConflictingPluginNames() const {
+  return conflictingPluginNames;
+}
+
 void PluginItemFilterModel::setSearchResults(QModelIndexList results) {
   std::set<int> resultRows;
   for (const auto& result : results) {
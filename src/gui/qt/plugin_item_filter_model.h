@@ -40,6 +40,8 @@ public:
   void setFiltersState(PluginFiltersState&& state,
                        std::vector<std::string>&& conflictingPluginNames);
 
+  const std::vector<std::string>& getConflictingPluginNames() const;
+
   void setSearchResults(QModelIndexList results);
   void clearSearchResults();
 
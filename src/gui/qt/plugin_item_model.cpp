@@ -32,6 +32,18 @@
 #include "gui/qt/icon_factory.h"
 
 namespace loot {
+std::vector<PluginItemDisplayStrings> buildDisplayStrings(
+    const std::vector<PluginItem>& items) {
+  std::vector<PluginItemDisplayStrings> displayStrings;
+  displayStrings.reserve(items.size());
+
+  for (const auto& item : items) {
+    displayStrings.emplace_back(item);
+  }
+
+  return displayStrings;
+}
+
 SearchResultData::SearchResultData(bool isResult, bool isCurrentResult) :
     isResult(isResult), isCurrentResult(isCurrentResult) {}
 
@@ -40,7 +52,7 @@ PluginItemModel::PluginItemModel(QObject* parent) :
 
 int PluginItemModel::rowCount(const QModelIndex&) const {
   // Row 0 is an extra row for the general information card.
-  return static_cast<int>(items.size()) + 1;
+  return static_cast<int>(items->size()) + 1;
 }
 
 int PluginItemModel::columnCount(const QModelIndex&) const {
@@ -71,18 +83,23 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
     }
 
     const int itemsIndex = index.row() - 1;
-    return QVariant::fromValue(items.at(itemsIndex));
+    return QVariant::fromValue(items->at(itemsIndex));
   }
 
   if (index.row() == 0) {
     if (index.column() == CARDS_COLUMN && role == CountersRole) {
-      const auto counters =
-          GeneralInformationCounters(generalInformation.generalMessages, items);
+      const auto counters = GeneralInformationCounters(
+          generalInformation.generalMessages, *items);
       return QVariant::fromValue(counters);
     }
   } else {
     const int itemsIndex = index.row() - 1;
-    const auto& plugin = items.at(itemsIndex);
+    const auto& plugin = items->at(itemsIndex);
+    const auto& strings = displayStrings.at(itemsIndex);
+
+    if (role == DisplayStringsRole) {
+      return QVariant::fromValue(strings);
+    }
 
     switch (index.column()) {
       case SIDEBAR_POSITION_COLUMN: {
@@ -94,7 +111,7 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
       }
       case SIDEBAR_INDEX_COLUMN: {
         if (role == Qt::DisplayRole) {
-          return QString::fromStdString(plugin.loadOrderIndexText());
+          return strings.loadOrderIndex;
         }
 
         break;
@@ -102,8 +119,8 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
       case SIDEBAR_NAME_COLUMN: {
         if (role == EditorStateRole) {
           return currentEditorPluginName.has_value();
-        } else if (role == DragRole) {
-          return QString::fromStdString(plugin.name);
+        } else if (role == Qt::DisplayRole || role == DragRole) {
+          return strings.name;
         }
 
         break;
@@ -137,7 +154,7 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
         if (role == CardContentFiltersRole) {
           return QVariant::fromValue(cardContentFiltersState);
         } else if (role == ContentSearchRole) {
-          return QString::fromStdString(plugin.contentToSearch());
+          return strings.contentToSearch;
         } else if (role == SearchResultRole) {
           const int searchResultsIndex = index.row() - 1;
 
@@ -281,7 +298,10 @@ bool PluginItemModel::setData(const QModelIndex& index,
   } else {
     const int itemsIndex = index.row() - 1;
 
-    items.at(itemsIndex) = value.value<PluginItem>();
+    auto& item = getMutablePluginItems().at(itemsIndex);
+    item = value.value<PluginItem>();
+    displayStrings.at(itemsIndex) = PluginItemDisplayStrings(item);
+    groupPluginsIndex.update(itemsIndex, item);
   }
 
   // The RawDataRole data changed, emit dataChanged for all columns.
@@ -293,13 +313,18 @@ bool PluginItemModel::setData(const QModelIndex& index,
 }
 
 const std::vector<PluginItem>& PluginItemModel::getPluginItems() const {
+  return *items;
+}
+
+std::shared_ptr<const std::vector<PluginItem>>
+PluginItemModel::sharePluginItems() const {
   return items;
 }
 
 std::vector<std::string> PluginItemModel::getPluginNames() const {
   std::vector<std::string> pluginNames;
 
-  for (const auto& plugin : items) {
+  for (const auto& plugin : *items) {
     pluginNames.push_back(plugin.name);
   }
 
@@ -323,10 +348,17 @@ std::unordered_map<std::string, int> PluginItemModel::getPluginNameToRowMap()
   return nameToRowMap;
 }
 
+const GroupPluginsIndex& PluginItemModel::getGroupPluginsIndex() const {
+  return groupPluginsIndex;
+}
+
 void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
-  beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
+  beginRemoveRows(QModelIndex(), 1, static_cast<int>(items->size()));
 
-  items.clear();
+  // Replace the vector instead of clearing it, as it may be shared.
+  items = std::make_shared<std::vector<PluginItem>>();
+  displayStrings.clear();
+  groupPluginsIndex = GroupPluginsIndex();
   searchResults.clear();
   currentSearchResultIndex = std::nullopt;
 
@@ -334,12 +366,59 @@ void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
 
   beginInsertRows(QModelIndex(), 1, static_cast<int>(newItems.size()));
 
-  std::swap(items, newItems);
-  searchResults.resize(items.size(), false);
+  items = std::make_shared<std::vector<PluginItem>>(std::move(newItems));
+  displayStrings = buildDisplayStrings(*items);
+  groupPluginsIndex = GroupPluginsIndex(*items);
+  searchResults.resize(items->size(), false);
 
   endInsertRows();
 }
 
+void PluginItemModel::mergePluginItemDetails(
+    std::vector<PluginItem>&& detailedItems) {
+  std::unordered_map<std::string, PluginItem*> nameToDetailedItemMap;
+  nameToDetailedItemMap.reserve(detailedItems.size());
+  for (auto& item : detailedItems) {
+    nameToDetailedItemMap.emplace(item.name, &item);
+  }
+
+  std::optional<int> firstChangedRow;
+  std::optional<int> lastChangedRow;
+  for (size_t i = 0; i < items->size(); i += 1) {
+    const auto& item = items->at(i);
+    if (item.detailsEvaluated) {
+      continue;
+    }
+
+    const auto it = nameToDetailedItemMap.find(item.name);
+    if (it == nameToDetailedItemMap.end()) {
+      continue;
+    }
+
+    auto& mutableItem = getMutablePluginItems().at(i);
+    mutableItem = std::move(*it->second);
+    displayStrings.at(i) = PluginItemDisplayStrings(mutableItem);
+    groupPluginsIndex.update(i, mutableItem);
+
+    const auto row = static_cast<int>(i) + 1;
+    if (!firstChangedRow.has_value()) {
+      firstChangedRow = row;
+    }
+    lastChangedRow = row;
+  }
+
+  if (!firstChangedRow.has_value()) {
+    return;
+  }
+
+  // Emit a single signal for the whole batch so that listeners don't need to
+  // recalculate derived data for each item.
+  const auto topLeft = index(firstChangedRow.value(), 0);
+  const auto bottomRight = index(lastChangedRow.value(), columnCount() - 1);
+
+  emit dataChanged(topLeft, bottomRight, {PluginDetailsRole});
+}
+
 void PluginItemModel::setEditorPluginName(
     const std::optional<std::string>& editorPluginName) {
   currentEditorPluginName = editorPluginName;
@@ -420,4 +499,14 @@ QModelIndex PluginItemModel::setCurrentSearchResult(size_t resultIndex) {
 
   return QModelIndex();
 }
+
+std::vector<PluginItem>& PluginItemModel::getMutablePluginItems() {
+  // Copy the items if they're shared, so that whatever they're shared with
+  // doesn't see them change.
+  if (items.use_count() > 1) {
+    items = std::make_shared<std::vector<PluginItem>>(*items);
+  }
+
+  return *items;
+}
 }
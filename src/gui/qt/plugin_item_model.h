@@ -27,12 +27,15 @@
 #define LOOT_GUI_QT_PLUGIN_ITEM_MODEL
 
 #include <QtCore/QAbstractListModel>
+#include <memory>
 
 #include "gui/plugin_item.h"
 #include "gui/qt/counters.h"
 #include "gui/qt/filters_states.h"
 #include "gui/qt/general_info.h"
+#include "gui/qt/group_plugins_index.h"
 #include "gui/qt/helpers.h"
+#include "gui/qt/plugin_item_display_strings.h"
 
 Q_DECLARE_METATYPE(loot::PluginItem);
 
@@ -44,6 +47,8 @@ static constexpr int CardContentFiltersRole = Qt::UserRole + 5;
 static constexpr int ContentSearchRole = Qt::UserRole + 6;
 static constexpr int DragRole = Qt::UserRole + 7;
 static constexpr int SearchResultRole = Qt::UserRole + 8;
+static constexpr int DisplayStringsRole = Qt::UserRole + 9;
+static constexpr int PluginDetailsRole = Qt::UserRole + 10;
 
 struct SearchResultData {
   SearchResultData() = default;
@@ -87,12 +92,24 @@ public:
 
   const std::vector<PluginItem>& getPluginItems() const;
 
+  // Get the items without copying them, e.g. for a background query to read.
+  // The model copies the items before changing them while they're shared.
+  std::shared_ptr<const std::vector<PluginItem>> sharePluginItems() const;
+
   std::vector<std::string> getPluginNames() const;
 
   std::unordered_map<std::string, int> getPluginNameToRowMap() const;
 
+  // The index's item indexes are one less than the items' rows.
+  const GroupPluginsIndex& getGroupPluginsIndex() const;
+
   void setPluginItems(std::vector<PluginItem>&& items);
 
+  // Replaces the items that have the same names as the given items, if the
+  // existing items' details have not already been evaluated. Emits
+  // dataChanged with PluginDetailsRole, as the items' names are unchanged.
+  void mergePluginItemDetails(std::vector<PluginItem>&& items);
+
   void setEditorPluginName(const std::optional<std::string>& editorPluginName);
 
   void setGeneralInformation(GameType gameType,
@@ -114,12 +131,19 @@ public:
 
 private:
   GeneralInformation generalInformation;
-  std::vector<PluginItem> items;
+  std::shared_ptr<std::vector<PluginItem>> items{
+      std::make_shared<std::vector<PluginItem>>()};
+  // Kept in step with items, each element is built from the item at the same
+  // index.
+  std::vector<PluginItemDisplayStrings> displayStrings;
+  GroupPluginsIndex groupPluginsIndex;
   std::vector<bool> searchResults;
   std::optional<int> currentSearchResultIndex;
 
   std::optional<std::string> currentEditorPluginName;
   CardContentFiltersState cardContentFiltersState;
+
+  std::vector<PluginItem>& getMutablePluginItems();
 };
 }
 
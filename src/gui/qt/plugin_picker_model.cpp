@@ -0,0 +1,53 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_picker_model.h"
+
+namespace loot {
+PluginPickerModel::PluginPickerModel(QObject* parent) :
+    QIdentityProxyModel(parent) {}
+
+void PluginPickerModel::setPlaceholderText(const QString& text) {
+  placeholderText = text;
+
+  if (rowCount() > 0) {
+    const auto topLeft = index(0, 0);
+    const auto bottomRight = index(0, columnCount() - 1);
+    emit dataChanged(topLeft, bottomRight, {Qt::DisplayRole, Qt::EditRole});
+  }
+}
+
+QVariant PluginPickerModel::data(const QModelIndex& index, int role) const {
+  if (role != Qt::DisplayRole && role != Qt::EditRole) {
+    return QIdentityProxyModel::data(index, role);
+  }
+
+  if (index.isValid() && index.row() == 0) {
+    return placeholderText;
+  }
+
+  return QIdentityProxyModel::data(index, Qt::DisplayRole);
+}
+}
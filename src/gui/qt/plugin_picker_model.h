@@ -0,0 +1,54 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_PICKER_MODEL
+#define LOOT_GUI_QT_PLUGIN_PICKER_MODEL
+
+#include <QtCore/QIdentityProxyModel>
+
+namespace loot {
+/**
+ * A proxy over PluginItemModel for use in plugin name pickers. Row 0 (the
+ * general information row) is displayed as a placeholder item, and every other
+ * row is displayed as its plugin's name. As it's an identity proxy, changes to
+ * the source model are forwarded incrementally instead of pickers needing to
+ * be rebuilt.
+ */
+class PluginPickerModel : public QIdentityProxyModel {
+  Q_OBJECT
+public:
+  explicit PluginPickerModel(QObject* parent);
+
+  void setPlaceholderText(const QString& text);
+
+  QVariant data(const QModelIndex& index,
+                int role = Qt::DisplayRole) const override;
+
+private:
+  QString placeholderText;
+};
+}
+
+#endif
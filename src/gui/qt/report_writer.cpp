@@ -0,0 +1,326 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/report_writer.h"
+
+#include <boost/algorithm/string/join.hpp>
+#include <cstdio>
+#include <stdexcept>
+
+#include "gui/helpers.h"
+
+namespace loot {
+std::string toJsonString(const std::string& text) {
+  std::string json = "\"";
+  for (const auto character : text) {
+    switch (character) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      case '\n':
+        json += "\\n";
+        break;
+      case '\r':
+        json += "\\r";
+        break;
+      case '\t':
+        json += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(character) < 0x20) {
+          char escaped[7];
+          std::snprintf(escaped,
+                        sizeof(escaped),
+                        "\\u%04x",
+                        static_cast<unsigned int>(character));
+          json += escaped;
+        } else {
+          json += character;
+        }
+    }
+  }
+
+  return json + "\"";
+}
+
+std::string toJsonString(const std::optional<std::string>& text) {
+  return text.has_value() ? toJsonString(text.value()) : "null";
+}
+
+std::string toJsonArray(const std::vector<std::string>& strings) {
+  std::string json = "[";
+  for (const auto& string : strings) {
+    if (json.size() > 1) {
+      json += ",";
+    }
+    json += toJsonString(string);
+  }
+
+  return json + "]";
+}
+
+std::string getReportMessageType(MessageType type) {
+  switch (type) {
+    case MessageType::say:
+      return "say";
+    case MessageType::warn:
+      return "warn";
+    default:
+      return "error";
+  }
+}
+
+std::string messagesToJson(const std::vector<SimpleMessage>& messages) {
+  std::string json = "[";
+  for (const auto& message : messages) {
+    if (json.size() > 1) {
+      json += ",";
+    }
+    json += "{\"type\":" + toJsonString(getReportMessageType(message.type)) +
+            ",\"text\":" + toJsonString(message.text) + "}";
+  }
+
+  return json + "]";
+}
+
+std::string revisionToJson(const FileRevisionSummary& revision) {
+  return "{\"id\":" + toJsonString(revision.id) +
+         ",\"date\":" + toJsonString(revision.date) + "}";
+}
+
+std::string toBoolString(bool value) { return value ? "true" : "false"; }
+
+std::string pluginToJson(const PluginItem& plugin) {
+  std::string json = "{\"name\":" + toJsonString(plugin.name);
+
+  json += ",\"loadOrderIndex\":";
+  json += plugin.loadOrderIndex.has_value()
+              ? std::to_string(plugin.loadOrderIndex.value())
+              : "null";
+
+  json += ",\"crc\":";
+  json += plugin.crc.has_value() ? toJsonString(crcToString(plugin.crc.value()))
+                                 : "null";
+
+  json += ",\"version\":" + toJsonString(plugin.version);
+  json += ",\"group\":" + toJsonString(plugin.group);
+  json += ",\"cleaningUtility\":" + toJsonString(plugin.cleaningUtility);
+  json += ",\"isActive\":" + toBoolString(plugin.isActive);
+  json += ",\"isDirty\":" + toBoolString(plugin.isDirty);
+  json += ",\"isEmpty\":" + toBoolString(plugin.isEmpty);
+  json += ",\"isMaster\":" + toBoolString(plugin.isMaster);
+  json += ",\"isLightPlugin\":" + toBoolString(plugin.isLightPlugin);
+  json += ",\"loadsArchive\":" + toBoolString(plugin.loadsArchive);
+  json += ",\"hasUserMetadata\":" + toBoolString(plugin.hasUserMetadata);
+  json +=
+      ",\"isCreationClubPlugin\":" + toBoolString(plugin.isCreationClubPlugin);
+  json += ",\"currentTags\":" + toJsonArray(plugin.currentTags);
+  json += ",\"addTags\":" + toJsonArray(plugin.addTags);
+  json += ",\"removeTags\":" + toJsonArray(plugin.removeTags);
+  json += ",\"messages\":" + messagesToJson(plugin.messages);
+
+  json += ",\"locations\":[";
+  for (size_t i = 0; i < plugin.locations.size(); i += 1) {
+    if (i > 0) {
+      json += ",";
+    }
+    json += "{\"name\":" + toJsonString(plugin.locations[i].GetName()) +
+            ",\"url\":" + toJsonString(plugin.locations[i].GetURL()) + "}";
+  }
+
+  return json + "]}";
+}
+
+std::string toCsvField(const std::string& text) {
+  if (text.find_first_of(",\"\r\n") == std::string::npos) {
+    return text;
+  }
+
+  std::string field = "\"";
+  for (const auto character : text) {
+    if (character == '"') {
+      field += '"';
+    }
+    field += character;
+  }
+
+  return field + "\"";
+}
+
+std::string pluginToCsv(const PluginItem& plugin) {
+  std::vector<std::string> messageTexts;
+  for (const auto& message : plugin.messages) {
+    messageTexts.push_back(message.text);
+  }
+
+  std::vector<std::string> fields{
+      plugin.name,
+      plugin.loadOrderIndexText(),
+      plugin.version.value_or(""),
+      plugin.crc.has_value() ? crcToString(plugin.crc.value()) : "",
+      plugin.group.value_or(""),
+      plugin.cleaningUtility.value_or(""),
+      toBoolString(plugin.isActive),
+      toBoolString(plugin.isDirty),
+      toBoolString(plugin.isEmpty),
+      toBoolString(plugin.isMaster),
+      toBoolString(plugin.isLightPlugin),
+      toBoolString(plugin.loadsArchive),
+      toBoolString(plugin.hasUserMetadata),
+      boost::join(plugin.currentTags, ", "),
+      boost::join(plugin.addTags, ", "),
+      boost::join(plugin.removeTags, ", "),
+      boost::join(messageTexts, "\n"),
+  };
+
+  std::string row;
+  for (const auto& field : fields) {
+    if (!row.empty()) {
+      row += ",";
+    }
+    row += toCsvField(field);
+  }
+
+  return row + "\r\n";
+}
+
+ReportWriter::ReportWriter(std::ostream& out,
+                           ReportFormat format,
+                           size_t maxPluginsSize) :
+    out_(out), format_(format), maxPluginsSize_(maxPluginsSize) {
+  buffer_.reserve(BUFFER_SIZE);
+}
+
+void ReportWriter::writeGeneralInformation(
+    const GeneralInformation& generalInformation) {
+  if (format_ == ReportFormat::Markdown) {
+    write(generalInformation.getMarkdownContent() + "\n\n");
+  } else if (format_ == ReportFormat::Json && !started_) {
+    write("{\n  \"generalInformation\": {\"masterlistRevision\":" +
+          revisionToJson(generalInformation.masterlistRevision) +
+          ",\"preludeRevision\":" +
+          revisionToJson(generalInformation.preludeRevision) +
+          ",\"messages\":" +
+          messagesToJson(generalInformation.generalMessages) +
+          "},\n  \"plugins\": [");
+    started_ = true;
+  } else {
+    writeStart();
+  }
+}
+
+bool ReportWriter::writePlugin(const PluginItem& plugin) {
+  if (truncated_) {
+    return false;
+  }
+
+  writeStart();
+
+  std::string content;
+  if (format_ == ReportFormat::Markdown) {
+    content = plugin.getMarkdownContent() + "\n\n";
+  } else if (format_ == ReportFormat::Json) {
+    content = (pluginsWritten_ == 0 ? "\n    " : ",\n    ") +
+              pluginToJson(plugin);
+  } else {
+    content = pluginToCsv(plugin);
+  }
+
+  if (content.size() > maxPluginsSize_ - pluginsSize_) {
+    truncated_ = true;
+    return false;
+  }
+
+  write(content);
+  pluginsSize_ += content.size();
+  pluginsWritten_ += 1;
+
+  return true;
+}
+
+void ReportWriter::finish() {
+  writeStart();
+
+  if (format_ == ReportFormat::Json) {
+    write("\n  ]\n}\n");
+  }
+
+  flush();
+}
+
+bool ReportWriter::isTruncated() const { return truncated_; }
+
+size_t ReportWriter::getPluginsWritten() const { return pluginsWritten_; }
+
+size_t ReportWriter::getBufferedSize() const { return buffer_.size(); }
+
+void ReportWriter::writeStart() {
+  if (started_) {
+    return;
+  }
+
+  if (format_ == ReportFormat::Json) {
+    write("{\n  \"plugins\": [");
+  } else if (format_ == ReportFormat::Csv) {
+    write(
+        "Name,Load Order Index,Version,CRC,Group,Verified Clean By,Active,"
+        "Dirty,Empty,Master Plugin,Light Plugin,Loads Archive,"
+        "Has User Metadata,Current Bash Tags,Add Bash Tags,Remove Bash Tags,"
+        "Messages\r\n");
+  }
+
+  started_ = true;
+}
+
+void ReportWriter::write(const std::string& content) {
+  if (buffer_.size() + content.size() > BUFFER_SIZE) {
+    flush();
+  }
+
+  if (content.size() > BUFFER_SIZE) {
+    out_.write(content.data(), content.size());
+  } else {
+    buffer_ += content;
+  }
+
+  if (!out_.good()) {
+    throw std::runtime_error("Failed to write the report");
+  }
+}
+
+void ReportWriter::flush() {
+  if (!buffer_.empty()) {
+    out_.write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+  }
+
+  if (!out_.good()) {
+    throw std::runtime_error("Failed to write the report");
+  }
+}
+}
@@ -0,0 +1,87 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_REPORT_WRITER
+#define LOOT_GUI_QT_REPORT_WRITER
+
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <string>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/general_info.h"
+
+namespace loot {
+enum class ReportFormat { Markdown, Json, Csv };
+
+// Serialises LOOT's content one plugin at a time through a fixed-size buffer,
+// so the memory used while writing a report doesn't grow with the number of
+// plugins. CSV reports only contain plugin rows.
+class ReportWriter {
+public:
+  static constexpr size_t BUFFER_SIZE = 64 * 1024;
+  static constexpr size_t NO_SIZE_LIMIT = std::numeric_limits<size_t>::max();
+
+  // If maxPluginsSize is given, plugins that would take the total size of the
+  // plugin content written past it are dropped and the report is marked as
+  // truncated. The general information and any closing syntax are not
+  // counted against the limit.
+  ReportWriter(std::ostream& out,
+               ReportFormat format,
+               size_t maxPluginsSize = NO_SIZE_LIMIT);
+
+  void writeGeneralInformation(const GeneralInformation& generalInformation);
+
+  // Returns false if the plugin was not written because of the size limit.
+  bool writePlugin(const PluginItem& plugin);
+
+  // Writes any closing syntax and flushes the buffer to the output stream.
+  void finish();
+
+  bool isTruncated() const;
+  size_t getPluginsWritten() const;
+
+  // Returns the size of the content that is waiting to be written to the
+  // output stream.
+  size_t getBufferedSize() const;
+
+private:
+  void writeStart();
+  void write(const std::string& content);
+  void flush();
+
+  std::ostream& out_;
+  ReportFormat format_;
+  size_t maxPluginsSize_;
+  std::string buffer_;
+  size_t pluginsSize_{0};
+  size_t pluginsWritten_{0};
+  bool started_{false};
+  bool truncated_{false};
+};
+}
+
+#endif
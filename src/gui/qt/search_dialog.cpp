@@ -61,6 +61,12 @@ void SearchDialog::setSearchResults(size_t resultsCount) {
   }
 }
 
+void SearchDialog::refreshSearch() {
+  if (!searchInput->text().isEmpty()) {
+    on_searchInput_textChanged(searchInput->text());
+  }
+}
+
 void SearchDialog::setupUi() {
   searchInput->setObjectName("searchInput");
   regexCheckbox->setObjectName("regexCheckbox");
@@ -49,6 +49,9 @@ public:
   void reset();
   void setSearchResults(size_t resultsCount);
 
+  // Searches again using the current search text, if there is any.
+  void refreshSearch();
+
 signals:
   void textChanged(const QVariant &text);
   void currentResultChanged(size_t resultIndex);
@@ -0,0 +1,448 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/session_snapshot.h"
+
+#include <toml++/toml.h>
+
+#include <fstream>
+
+#include "gui/helpers.h"
+
+namespace loot {
+static constexpr int64_t SESSION_SNAPSHOT_FORMAT_VERSION = 1;
+
+std::string messageTypeToString(MessageType type) {
+  switch (type) {
+    case MessageType::say:
+      return "say";
+    case MessageType::warn:
+      return "warn";
+    default:
+      return "error";
+  }
+}
+
+toml::array stringsToToml(const std::vector<std::string>& strings) {
+  toml::array array;
+  for (const auto& string : strings) {
+    array.push_back(string);
+  }
+
+  return array;
+}
+
+std::vector<std::string> stringsFromToml(const toml::array* array) {
+  std::vector<std::string> strings;
+  if (array == nullptr) {
+    return strings;
+  }
+
+  for (const auto& element : *array) {
+    const auto string = element.value<std::string>();
+    if (string.has_value()) {
+      strings.push_back(string.value());
+    }
+  }
+
+  return strings;
+}
+
+toml::array messagesToToml(const std::vector<SimpleMessage>& messages) {
+  toml::array array;
+  for (const auto& message : messages) {
+    array.push_back(toml::table{
+        {"type", messageTypeToString(message.type)},
+        {"language", message.language},
+        {"text", message.text},
+        {"condition", message.condition},
+    });
+  }
+
+  return array;
+}
+
+std::vector<SimpleMessage> messagesFromToml(const toml::array* array) {
+  std::vector<SimpleMessage> messages;
+  if (array == nullptr) {
+    return messages;
+  }
+
+  for (const auto& element : *array) {
+    const auto table = element.as_table();
+    if (table == nullptr) {
+      throw std::runtime_error("message array element is not a table");
+    }
+
+    SimpleMessage message;
+    message.type =
+        mapMessageType((*table)["type"].value_or(std::string("error")));
+    message.language = (*table)["language"].value_or(std::string());
+    message.text = (*table)["text"].value_or(std::string());
+    message.condition = (*table)["condition"].value_or(std::string());
+
+    messages.push_back(message);
+  }
+
+  return messages;
+}
+
+toml::table revisionToToml(const FileRevisionSummary& revision) {
+  return toml::table{
+      {"id", revision.id},
+      {"date", revision.date},
+  };
+}
+
+FileRevisionSummary revisionFromToml(const toml::table* table) {
+  if (table == nullptr) {
+    return FileRevisionSummary();
+  }
+
+  return FileRevisionSummary((*table)["id"].value_or(std::string()),
+                             (*table)["date"].value_or(std::string()));
+}
+
+toml::table pluginItemToToml(const PluginItem& item) {
+  toml::table table{
+      {"name", item.name},
+      {"isActive", item.isActive},
+      {"isDirty", item.isDirty},
+      {"isEmpty", item.isEmpty},
+      {"isMaster", item.isMaster},
+      {"isLightPlugin", item.isLightPlugin},
+      {"loadsArchive", item.loadsArchive},
+      {"hasUserMetadata", item.hasUserMetadata},
+      {"isCreationClubPlugin", item.isCreationClubPlugin},
+      {"currentTags", stringsToToml(item.currentTags)},
+      {"addTags", stringsToToml(item.addTags)},
+      {"removeTags", stringsToToml(item.removeTags)},
+      {"messages", messagesToToml(item.messages)},
+      {"detailsEvaluated", item.detailsEvaluated},
+  };
+
+  if (item.loadOrderIndex.has_value()) {
+    table.insert("loadOrderIndex",
+                 static_cast<int64_t>(item.loadOrderIndex.value()));
+  }
+
+  if (item.crc.has_value()) {
+    table.insert("crc", static_cast<int64_t>(item.crc.value()));
+  }
+
+  if (item.version.has_value()) {
+    table.insert("version", item.version.value());
+  }
+
+  if (item.group.has_value()) {
+    table.insert("group", item.group.value());
+  }
+
+  if (item.cleaningUtility.has_value()) {
+    table.insert("cleaningUtility", item.cleaningUtility.value());
+  }
+
+  toml::array locations;
+  for (const auto& location : item.locations) {
+    locations.push_back(toml::table{
+        {"url", location.GetURL()},
+        {"name", location.GetName()},
+    });
+  }
+  table.insert("locations", locations);
+
+  return table;
+}
+
+PluginItem pluginItemFromToml(const toml::table& table) {
+  const auto name = table["name"].value<std::string>();
+  if (!name) {
+    throw std::runtime_error("'name' key missing from plugin table");
+  }
+
+  PluginItem item;
+  item.name = name.value();
+
+  const auto loadOrderIndex = table["loadOrderIndex"].value<int64_t>();
+  if (loadOrderIndex.has_value()) {
+    item.loadOrderIndex = static_cast<short>(loadOrderIndex.value());
+  }
+
+  const auto crc = table["crc"].value<int64_t>();
+  if (crc.has_value()) {
+    item.crc = static_cast<uint32_t>(crc.value());
+  }
+
+  item.version = table["version"].value<std::string>();
+  item.group = table["group"].value<std::string>();
+  item.cleaningUtility = table["cleaningUtility"].value<std::string>();
+
+  item.isActive = table["isActive"].value_or(false);
+  item.isDirty = table["isDirty"].value_or(false);
+  item.isEmpty = table["isEmpty"].value_or(false);
+  item.isMaster = table["isMaster"].value_or(false);
+  item.isLightPlugin = table["isLightPlugin"].value_or(false);
+  item.loadsArchive = table["loadsArchive"].value_or(false);
+  item.hasUserMetadata = table["hasUserMetadata"].value_or(false);
+  item.isCreationClubPlugin = table["isCreationClubPlugin"].value_or(false);
+
+  item.currentTags = stringsFromToml(table["currentTags"].as_array());
+  item.addTags = stringsFromToml(table["addTags"].as_array());
+  item.removeTags = stringsFromToml(table["removeTags"].as_array());
+
+  item.messages = messagesFromToml(table["messages"].as_array());
+
+  const auto locations = table["locations"].as_array();
+  if (locations != nullptr) {
+    for (const auto& element : *locations) {
+      const auto location = element.as_table();
+      if (location == nullptr) {
+        throw std::runtime_error("locations array element is not a table");
+      }
+
+      item.locations.push_back(
+          Location((*location)["url"].value_or(std::string()),
+                   (*location)["name"].value_or(std::string())));
+    }
+  }
+
+  item.detailsEvaluated = table["detailsEvaluated"].value_or(false);
+
+  return item;
+}
+
+toml::table filtersToToml(const LootSettings::Filters& filters) {
+  return toml::table{
+      {"hideVersionNumbers", filters.hideVersionNumbers},
+      {"hideCRCs", filters.hideCRCs},
+      {"hideBashTags", filters.hideBashTags},
+      {"hideLocations", filters.hideLocations},
+      {"hideNotes", filters.hideNotes},
+      {"hideAllPluginMessages", filters.hideAllPluginMessages},
+      {"hideInactivePlugins", filters.hideInactivePlugins},
+      {"hideMessagelessPlugins", filters.hideMessagelessPlugins},
+      {"hideCreationClubPlugins", filters.hideCreationClubPlugins},
+      {"showOnlyEmptyPlugins", filters.showOnlyEmptyPlugins},
+  };
+}
+
+LootSettings::Filters filtersFromToml(const toml::table* table) {
+  LootSettings::Filters filters;
+  if (table == nullptr) {
+    return filters;
+  }
+
+  filters.hideVersionNumbers =
+      (*table)["hideVersionNumbers"].value_or(filters.hideVersionNumbers);
+  filters.hideCRCs = (*table)["hideCRCs"].value_or(filters.hideCRCs);
+  filters.hideBashTags =
+      (*table)["hideBashTags"].value_or(filters.hideBashTags);
+  filters.hideLocations =
+      (*table)["hideLocations"].value_or(filters.hideLocations);
+  filters.hideNotes = (*table)["hideNotes"].value_or(filters.hideNotes);
+  filters.hideAllPluginMessages =
+      (*table)["hideAllPluginMessages"].value_or(filters.hideAllPluginMessages);
+  filters.hideInactivePlugins =
+      (*table)["hideInactivePlugins"].value_or(filters.hideInactivePlugins);
+  filters.hideMessagelessPlugins = (*table)["hideMessagelessPlugins"].value_or(
+      filters.hideMessagelessPlugins);
+  filters.hideCreationClubPlugins =
+      (*table)["hideCreationClubPlugins"].value_or(
+          filters.hideCreationClubPlugins);
+  filters.showOnlyEmptyPlugins =
+      (*table)["showOnlyEmptyPlugins"].value_or(filters.showOnlyEmptyPlugins);
+
+  return filters;
+}
+
+toml::table pluginFiltersToToml(const SessionPluginFilters& filters) {
+  toml::table table{
+      {"conflictingPluginNames", stringsToToml(filters.conflictingPluginNames)},
+      {"content", filters.content},
+      {"isContentRegex", filters.isContentRegex},
+  };
+
+  if (filters.conflictsPluginName.has_value()) {
+    table.insert("conflictsPluginName", filters.conflictsPluginName.value());
+  }
+
+  if (filters.groupName.has_value()) {
+    table.insert("groupName", filters.groupName.value());
+  }
+
+  return table;
+}
+
+SessionPluginFilters pluginFiltersFromToml(const toml::table* table) {
+  SessionPluginFilters filters;
+  if (table == nullptr) {
+    return filters;
+  }
+
+  filters.conflictsPluginName =
+      (*table)["conflictsPluginName"].value<std::string>();
+  filters.conflictingPluginNames =
+      stringsFromToml((*table)["conflictingPluginNames"].as_array());
+  filters.groupName = (*table)["groupName"].value<std::string>();
+  filters.content = (*table)["content"].value_or(std::string());
+  filters.isContentRegex = (*table)["isContentRegex"].value_or(false);
+
+  return filters;
+}
+
+GameType gameTypeFromToml(int64_t value) {
+  switch (value) {
+    case static_cast<int64_t>(GameType::tes3):
+    case static_cast<int64_t>(GameType::tes4):
+    case static_cast<int64_t>(GameType::tes5):
+    case static_cast<int64_t>(GameType::tes5se):
+    case static_cast<int64_t>(GameType::tes5vr):
+    case static_cast<int64_t>(GameType::fo3):
+    case static_cast<int64_t>(GameType::fonv):
+    case static_cast<int64_t>(GameType::fo4):
+    case static_cast<int64_t>(GameType::fo4vr):
+      return static_cast<GameType>(value);
+    default:
+      throw std::runtime_error("Unrecognised game type: " +
+                               std::to_string(value));
+  }
+}
+
+void saveSessionSnapshot(const SessionSnapshot& snapshot,
+                         const std::filesystem::path& file) {
+  const auto& generalInformation = snapshot.generalInformation;
+
+  toml::table root{
+      {"formatVersion", SESSION_SNAPSHOT_FORMAT_VERSION},
+      {"generalInformation",
+       toml::table{
+           {"gameType", static_cast<int64_t>(generalInformation.gameType)},
+           {"masterlistRevision",
+            revisionToToml(generalInformation.masterlistRevision)},
+           {"preludeRevision",
+            revisionToToml(generalInformation.preludeRevision)},
+           {"messages", messagesToToml(generalInformation.generalMessages)},
+       }},
+      {"filters", filtersToToml(snapshot.filters)},
+      {"pluginFilters", pluginFiltersToToml(snapshot.pluginFilters)},
+  };
+
+  toml::array plugins;
+  for (const auto& item : snapshot.pluginItems) {
+    plugins.push_back(pluginItemToToml(item));
+  }
+  root.insert("plugins", plugins);
+
+  toml::array queryTimings;
+  for (const auto& timing : snapshot.queryTimings) {
+    queryTimings.push_back(toml::table{
+        {"query", timing.queryName},
+        {"durationMicroseconds",
+         static_cast<int64_t>(timing.duration.count())},
+    });
+  }
+  root.insert("queryTimings", queryTimings);
+
+  std::ofstream out(file);
+  if (!out.is_open()) {
+    throw std::runtime_error(file.u8string() +
+                             " could not be opened for writing");
+  }
+
+  out << root;
+}
+
+SessionSnapshot loadSessionSnapshot(const std::filesystem::path& file) {
+  // Don't use toml::parse_file() as it just uses a std stream,
+  // which don't support UTF-8 paths on Windows.
+  std::ifstream in(file);
+  if (!in.is_open()) {
+    throw std::runtime_error(file.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  const auto root = toml::parse(in, file.u8string());
+
+  const auto formatVersion = root["formatVersion"].value<int64_t>();
+  if (!formatVersion.has_value() ||
+      formatVersion.value() > SESSION_SNAPSHOT_FORMAT_VERSION) {
+    throw std::runtime_error(file.u8string() +
+                             " is not a supported session snapshot");
+  }
+
+  SessionSnapshot snapshot;
+
+  const auto generalInformation = root["generalInformation"].as_table();
+  if (generalInformation != nullptr) {
+    const auto gameType = (*generalInformation)["gameType"].value<int64_t>();
+    if (gameType.has_value()) {
+      snapshot.generalInformation.gameType =
+          gameTypeFromToml(gameType.value());
+    }
+
+    snapshot.generalInformation.masterlistRevision = revisionFromToml(
+        (*generalInformation)["masterlistRevision"].as_table());
+    snapshot.generalInformation.preludeRevision =
+        revisionFromToml((*generalInformation)["preludeRevision"].as_table());
+    snapshot.generalInformation.generalMessages =
+        messagesFromToml((*generalInformation)["messages"].as_array());
+  }
+
+  snapshot.filters = filtersFromToml(root["filters"].as_table());
+  snapshot.pluginFilters =
+      pluginFiltersFromToml(root["pluginFilters"].as_table());
+
+  const auto plugins = root["plugins"].as_array();
+  if (plugins != nullptr) {
+    for (const auto& element : *plugins) {
+      const auto table = element.as_table();
+      if (table == nullptr) {
+        throw std::runtime_error("plugins array element is not a table");
+      }
+
+      snapshot.pluginItems.push_back(pluginItemFromToml(*table));
+    }
+  }
+
+  const auto queryTimings = root["queryTimings"].as_array();
+  if (queryTimings != nullptr) {
+    for (const auto& element : *queryTimings) {
+      const auto table = element.as_table();
+      if (table == nullptr) {
+        throw std::runtime_error("queryTimings array element is not a table");
+      }
+
+      QueryTiming timing;
+      timing.queryName = (*table)["query"].value_or(std::string());
+      timing.duration = std::chrono::microseconds(
+          (*table)["durationMicroseconds"].value_or(int64_t{0}));
+
+      snapshot.queryTimings.push_back(timing);
+    }
+  }
+
+  return snapshot;
+}
+}
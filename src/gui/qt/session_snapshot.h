@@ -0,0 +1,67 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_SESSION_SNAPSHOT
+#define LOOT_GUI_QT_SESSION_SNAPSHOT
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/general_info.h"
+#include "gui/qt/tasks/tasks.h"
+#include "gui/state/loot_settings.h"
+
+namespace loot {
+// The plugin filters that aren't simple toggles, stored as they were entered
+// so that they can be restored into the filters sidebar.
+struct SessionPluginFilters {
+  std::optional<std::string> conflictsPluginName;
+  std::vector<std::string> conflictingPluginNames;
+  std::optional<std::string> groupName;
+  std::string content;
+  bool isContentRegex{false};
+};
+
+// Everything that is needed to reproduce the UI's workload without libloot or
+// a game install: the data that was displayed, how it was filtered and how
+// long the queries that produced it took.
+struct SessionSnapshot {
+  GeneralInformation generalInformation;
+  std::vector<PluginItem> pluginItems;
+  LootSettings::Filters filters;
+  SessionPluginFilters pluginFilters;
+  std::vector<QueryTiming> queryTimings;
+};
+
+void saveSessionSnapshot(const SessionSnapshot& snapshot,
+                         const std::filesystem::path& file);
+
+SessionSnapshot loadSessionSnapshot(const std::filesystem::path& file);
+}
+
+#endif
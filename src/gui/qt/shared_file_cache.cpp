@@ -0,0 +1,170 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/shared_file_cache.h"
+
+#include <loot/exception/file_access_error.h>
+#include <toml++/toml.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QLockFile>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "gui/helpers.h"
+#include "gui/qt/helpers.h"
+#include "gui/state/logging.h"
+
+namespace loot {
+static constexpr const char* SHARED_CACHE_LOCK_FILENAME = "cache.lock";
+static constexpr const char* SHARED_CACHE_INDEX_FILENAME = "sources.toml";
+static constexpr const char* SHARED_CACHE_BLOBS_FOLDER = "blobs";
+static constexpr const char* SHARED_CACHE_BLOB_KEY = "blob_sha1";
+static constexpr const char* SHARED_CACHE_ETAG_KEY = "etag";
+static constexpr const char* SHARED_CACHE_SIZE_KEY = "size";
+// Cache operations only read or write a few files, so if the lock can't be
+// acquired quickly another process has probably hung while holding it.
+static constexpr int SHARED_CACHE_LOCK_TIMEOUT_MS = 10000;
+
+std::unique_ptr<QLockFile> lockSharedCache(
+    const std::filesystem::path& directory) {
+  auto lockFile = std::make_unique<QLockFile>(QString::fromStdString(
+      (directory / SHARED_CACHE_LOCK_FILENAME).u8string()));
+
+  if (!lockFile->tryLock(SHARED_CACHE_LOCK_TIMEOUT_MS)) {
+    throw std::runtime_error("Failed to lock the shared cache at " +
+                             directory.u8string());
+  }
+
+  return lockFile;
+}
+
+toml::table readSharedCacheIndex(const std::filesystem::path& indexPath) {
+  if (!std::filesystem::exists(indexPath)) {
+    return toml::table();
+  }
+
+  // Don't use toml::parse_file() as it just uses a std stream,
+  // which don't support UTF-8 paths on Windows.
+  std::ifstream in(indexPath);
+  if (!in.is_open()) {
+    throw std::runtime_error(indexPath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  return toml::parse(in, indexPath.u8string());
+}
+
+SharedFileCache::SharedFileCache(const std::filesystem::path& directory) :
+    directory(directory) {
+  std::filesystem::create_directories(directory / SHARED_CACHE_BLOBS_FOLDER);
+}
+
+std::optional<SharedCacheEntry> SharedFileCache::getEntry(
+    const std::string& source) const {
+  const auto lock = lockSharedCache(directory);
+
+  const auto index = readSharedCacheIndex(getIndexPath());
+
+  const auto sourceTable = index[source];
+  const auto blobHash = sourceTable[SHARED_CACHE_BLOB_KEY].value<std::string>();
+  if (!blobHash.has_value() ||
+      !std::filesystem::exists(getBlobPath(blobHash.value()))) {
+    return std::nullopt;
+  }
+
+  SharedCacheEntry entry;
+  entry.blobHash = blobHash.value();
+  entry.etag = sourceTable[SHARED_CACHE_ETAG_KEY].value_or(std::string());
+  entry.size = sourceTable[SHARED_CACHE_SIZE_KEY].value<int64_t>();
+
+  return entry;
+}
+
+QByteArray SharedFileCache::readBlob(const SharedCacheEntry& entry) const {
+  const auto lock = lockSharedCache(directory);
+
+  const auto blobPath = getBlobPath(entry.blobHash);
+  QFile file(QString::fromStdString(blobPath.u8string()));
+  if (!file.open(QIODevice::ReadOnly)) {
+    throw FileAccessError(blobPath.u8string() + " could not be read");
+  }
+
+  auto data = file.readAll();
+
+  if (entry.size.has_value() && data.size() != entry.size.value()) {
+    throw FileAccessError(blobPath.u8string() +
+                          " does not have the size recorded for it");
+  }
+
+  return data;
+}
+
+std::string SharedFileCache::store(const std::string& source,
+                                   const QByteArray& data,
+                                   const std::string& etag) {
+  const auto blobHash = calculateGitBlobHash(data);
+
+  const auto lock = lockSharedCache(directory);
+
+  const auto blobPath = getBlobPath(blobHash);
+  if (!std::filesystem::exists(blobPath)) {
+    writeFileAtomically(blobPath, data.constData(), data.size());
+  }
+
+  auto index = readSharedCacheIndex(getIndexPath());
+
+  index.insert_or_assign(
+      source,
+      toml::table{{SHARED_CACHE_BLOB_KEY, blobHash},
+                  {SHARED_CACHE_ETAG_KEY, etag},
+                  {SHARED_CACHE_SIZE_KEY, static_cast<int64_t>(data.size())}});
+
+  std::ostringstream indexStream;
+  indexStream << index;
+  const auto indexText = indexStream.str();
+
+  writeFileAtomically(getIndexPath(), indexText.c_str(), indexText.size());
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Stored data from {} in the shared cache with blob hash {}",
+                 source,
+                 blobHash);
+  }
+
+  return blobHash;
+}
+
+std::filesystem::path SharedFileCache::getBlobPath(
+    const std::string& blobHash) const {
+  return directory / SHARED_CACHE_BLOBS_FOLDER / blobHash;
+}
+
+std::filesystem::path SharedFileCache::getIndexPath() const {
+  return directory / SHARED_CACHE_INDEX_FILENAME;
+}
+}
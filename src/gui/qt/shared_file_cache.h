@@ -0,0 +1,73 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_SHARED_FILE_CACHE
+#define LOOT_GUI_QT_SHARED_FILE_CACHE
+
+#include <QtCore/QByteArray>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace loot {
+struct SharedCacheEntry {
+  std::string blobHash;
+  // The HTTP entity tag that the source's server sent with the data, if any.
+  std::string etag;
+  // The blob's size in bytes, if the index recorded it.
+  std::optional<int64_t> size;
+};
+
+// A content-addressed cache of downloaded files that can be shared between
+// LOOT instances using different data folders on the same machine. Files are
+// stored by their Git blob hash and an index records which blob was last
+// fetched from each source. All access is serialised between processes using
+// a lock file in the cache directory.
+class SharedFileCache {
+public:
+  explicit SharedFileCache(const std::filesystem::path& directory);
+
+  // Get the entry recorded for the given source, if its blob is present.
+  std::optional<SharedCacheEntry> getEntry(const std::string& source) const;
+
+  // Blobs are written atomically and named after their hash, so their content
+  // isn't hashed again when read, but a blob that doesn't have the entry's
+  // recorded size is treated as corrupt.
+  QByteArray readBlob(const SharedCacheEntry& entry) const;
+
+  // Store data fetched from the given source and return its blob hash.
+  std::string store(const std::string& source,
+                    const QByteArray& data,
+                    const std::string& etag);
+
+private:
+  std::filesystem::path directory;
+
+  std::filesystem::path getBlobPath(const std::string& blobHash) const;
+  std::filesystem::path getIndexPath() const;
+};
+}
+
+#endif
@@ -71,6 +71,8 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
   painter->save();
 
   auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  auto strings =
+      index.data(DisplayStringsRole).value<PluginItemDisplayStrings>();
   auto isEditorOpen = index.data(EditorStateRole).toBool();
 
   const auto isSelected = styleOption.state.testFlag(QStyle::State_Selected) &&
@@ -83,7 +85,7 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
   }
 
   auto name = QFontMetricsF(painter->font())
-                  .elidedText(QString::fromStdString(pluginItem.name),
+                  .elidedText(strings.name,
                               Qt::ElideRight,
                               styleOption.rect.width());
   painter->drawText(styleOption.rect, Qt::AlignLeft, name);
@@ -102,9 +104,7 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
     }
 
     auto group = painter->fontMetrics().elidedText(
-        QString::fromStdString(pluginItem.group.value()),
-        Qt::ElideRight,
-        groupRect.width());
+        strings.group, Qt::ElideRight, groupRect.width());
     painter->drawText(groupRect, Qt::AlignLeft, group);
   }
 
@@ -25,6 +25,9 @@
 
 #include "gui/qt/tasks/tasks.h"
 
+#include <boost/core/demangle.hpp>
+#include <typeinfo>
+
 namespace loot {
 QueryTask::QueryTask(std::unique_ptr<Query> query) : query(std::move(query)) {}
 
@@ -35,7 +38,16 @@ void QueryTask::execute() {
           "Attempted to execute a query with no query set!");
     }
 
-    emit finished(query->executeLogic());
+    const auto startTime = std::chrono::steady_clock::now();
+    auto result = query->executeLogic();
+
+    QueryTiming timing;
+    timing.queryName = boost::core::demangle(typeid(*query).name());
+    timing.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    emit timed(timing);
+
+    emit finished(result);
   } catch (const std::exception &e) {
     auto logger = getLogger();
     if (logger) {
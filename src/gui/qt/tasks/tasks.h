@@ -29,6 +29,7 @@
 #include <QtCore/QMetaType>
 #include <QtCore/QString>
 #include <QtCore/QThread>
+#include <chrono>
 
 #include "gui/query/query.h"
 
@@ -36,6 +37,11 @@ Q_DECLARE_METATYPE(loot::QueryResult);
 Q_DECLARE_METATYPE(std::string);
 
 namespace loot {
+struct QueryTiming {
+  std::string queryName;
+  std::chrono::microseconds duration{0};
+};
+
 class ProgressUpdater : public QObject {
   Q_OBJECT
 signals:
@@ -60,6 +66,9 @@ public:
 public slots:
   void execute() override;
 
+signals:
+  void timed(QueryTiming timing);
+
 private:
   std::unique_ptr<Query> query;
 };
@@ -91,4 +100,6 @@ private slots:
 };
 }
 
+Q_DECLARE_METATYPE(loot::QueryTiming);
+
 #endif
@@ -26,8 +26,121 @@
 #include "gui/qt/tasks/update_masterlist_task.h"
 
 #include "gui/qt/helpers.h"
+#include "gui/state/logging.h"
 
 namespace loot {
+static constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+std::optional<SharedCacheEntry> getSharedCacheEntry(
+    const std::optional<SharedFileCache> &sharedCache,
+    const std::string &source) {
+  if (!sharedCache.has_value()) {
+    return std::nullopt;
+  }
+
+  try {
+    return sharedCache.value().getEntry(source);
+  } catch (const std::exception &e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->warn("Failed to read the shared cache entry for {}: {}",
+                   source,
+                   e.what());
+    }
+
+    return std::nullopt;
+  }
+}
+
+QNetworkRequest createRequest(
+    const std::string &source,
+    const std::optional<SharedCacheEntry> &cachedEntry) {
+  QNetworkRequest request(QUrl(QString::fromStdString(source)));
+
+  // If another LOOT instance has already downloaded the file, only ask for
+  // it again if it has changed since then.
+  if (cachedEntry.has_value() && !cachedEntry.value().etag.empty()) {
+    request.setRawHeader("If-None-Match",
+                         QByteArray::fromStdString(cachedEntry.value().etag));
+  }
+
+  return request;
+}
+
+enum class ResponseOutcome { Error, Unchanged, Changed, CachedCopyUnreadable };
+
+ResponseOutcome toResponseOutcome(bool fileChanged) {
+  return fileChanged ? ResponseOutcome::Changed : ResponseOutcome::Unchanged;
+}
+
+// If the response says that the shared cache's copy of the file is still
+// current but that copy can't be read, the file needs to be requested again
+// without asking for only changes.
+ResponseOutcome updateFileFromResponse(
+    QNetworkReply *reply,
+    const std::string &source,
+    std::optional<SharedFileCache> &sharedCache,
+    const std::optional<SharedCacheEntry> &cachedEntry,
+    const std::filesystem::path &filePath) {
+  auto logger = getLogger();
+
+  const auto statusCode =
+      reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+  if (statusCode == HTTP_STATUS_NOT_MODIFIED && sharedCache.has_value() &&
+      cachedEntry.has_value()) {
+    reply->deleteLater();
+
+    if (logger) {
+      logger->info("{} has not changed, using the shared cache's copy",
+                   source);
+    }
+
+    const auto &blobHash = cachedEntry.value().blobHash;
+    QByteArray data;
+    try {
+      data = sharedCache.value().readBlob(cachedEntry.value());
+    } catch (const std::exception &e) {
+      if (logger) {
+        logger->warn(
+            "Failed to read the shared cache's copy of {}, requesting it "
+            "again: {}",
+            source,
+            e.what());
+      }
+
+      return ResponseOutcome::CachedCopyUnreadable;
+    }
+
+    return toResponseOutcome(updateFileWithData(filePath, data, blobHash));
+  }
+
+  const auto etag = reply->rawHeader("ETag").toStdString();
+  const auto responseData = readHttpResponse(reply);
+
+  if (!responseData.has_value()) {
+    return ResponseOutcome::Error;
+  }
+
+  if (sharedCache.has_value()) {
+    try {
+      const auto blobHash =
+          sharedCache.value().store(source, responseData.value(), etag);
+
+      return toResponseOutcome(
+          updateFileWithData(filePath, responseData.value(), blobHash));
+    } catch (const std::exception &e) {
+      if (logger) {
+        logger->warn("Failed to store {} in the shared cache: {}",
+                     source,
+                     e.what());
+      }
+    }
+  }
+
+  return toResponseOutcome(updateFileWithData(filePath, responseData.value()));
+}
+
 UpdateMasterlistTask::UpdateMasterlistTask(LootState &state) : state(state) {}
 
 void UpdateMasterlistTask::execute() {
@@ -38,6 +151,20 @@ void UpdateMasterlistTask::execute() {
       networkAccessManager = new QNetworkAccessManager(this);
     }
 
+    const auto sharedCachePath = state.getSettings().getSharedCachePath();
+    if (!sharedCachePath.empty()) {
+      try {
+        sharedCache.emplace(std::filesystem::u8path(sharedCachePath));
+      } catch (const std::exception &e) {
+        auto logger = getLogger();
+        if (logger) {
+          logger->warn("Failed to open the shared cache at {}: {}",
+                       sharedCachePath,
+                       e.what());
+        }
+      }
+    }
+
     updatePrelude();
   } catch (const std::exception &e) {
     emit this->error(e.what());
@@ -62,23 +189,11 @@ void UpdateMasterlistTask::updatePrelude() {
     logger->trace("Sending a prelude update request to GET {}", source);
   }
 
-  QNetworkRequest request(QUrl(QString::fromStdString(source)));
+  cachedPreludeEntry = getSharedCacheEntry(sharedCache, source);
 
-  const auto reply = networkAccessManager->get(request);
-
-  connect(reply,
-          &QNetworkReply::finished,
-          this,
-          &UpdateMasterlistTask::onPreludeReplyFinished);
-
-  connect(reply,
-          &QNetworkReply::errorOccurred,
-          this,
-          &UpdateMasterlistTask::onNetworkError);
-  connect(reply,
-          &QNetworkReply::sslErrors,
-          this,
-          &UpdateMasterlistTask::onSSLError);
+  sendRequest(source,
+              cachedPreludeEntry,
+              &UpdateMasterlistTask::onPreludeReplyFinished);
 }
 
 void UpdateMasterlistTask::updateMasterlist() {
@@ -99,14 +214,22 @@ void UpdateMasterlistTask::updateMasterlist() {
     logger->trace("Sending a masterlist update request to GET {}", source);
   }
 
-  QNetworkRequest request(QUrl(QString::fromStdString(source)));
+  cachedMasterlistEntry = getSharedCacheEntry(sharedCache, source);
+
+  sendRequest(source,
+              cachedMasterlistEntry,
+              &UpdateMasterlistTask::onMasterlistReplyFinished);
+}
+
+void UpdateMasterlistTask::sendRequest(
+    const std::string &source,
+    const std::optional<SharedCacheEntry> &cachedEntry,
+    void (UpdateMasterlistTask::*onReplyFinished)()) {
+  const auto request = createRequest(source, cachedEntry);
 
   const auto reply = networkAccessManager->get(request);
 
-  connect(reply,
-          &QNetworkReply::finished,
-          this,
-          &UpdateMasterlistTask::onMasterlistReplyFinished);
+  connect(reply, &QNetworkReply::finished, this, onReplyFinished);
 
   connect(reply,
           &QNetworkReply::errorOccurred,
@@ -144,17 +267,28 @@ void UpdateMasterlistTask::onMasterlistReplyFinished() {
       logger->trace("Finished receiving a response for masterlist update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto source = state.GetCurrentGame().GetSettings().MasterlistSource();
+    const auto outcome =
+        updateFileFromResponse(qobject_cast<QNetworkReply *>(sender()),
+                               source,
+                               sharedCache,
+                               cachedMasterlistEntry,
+                               state.GetCurrentGame().MasterlistPath());
 
-    if (!responseData.has_value()) {
+    if (outcome == ResponseOutcome::Error) {
       emit error("Masterlist update response errored");
       return;
     }
 
-    auto masterlistPath = state.GetCurrentGame().MasterlistPath();
-    masterlistUpdated =
-        updateFileWithData(masterlistPath, responseData.value());
+    if (outcome == ResponseOutcome::CachedCopyUnreadable) {
+      cachedMasterlistEntry = std::nullopt;
+      sendRequest(source,
+                  cachedMasterlistEntry,
+                  &UpdateMasterlistTask::onMasterlistReplyFinished);
+      return;
+    }
+
+    masterlistUpdated = outcome == ResponseOutcome::Changed;
 
     finish();
   } catch (const std::exception &e) {
@@ -169,16 +303,28 @@ void UpdateMasterlistTask::onPreludeReplyFinished() {
       logger->trace("Finished receiving a response for prelude update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto source = state.getSettings().getPreludeSource();
+    const auto outcome =
+        updateFileFromResponse(qobject_cast<QNetworkReply *>(sender()),
+                               source,
+                               sharedCache,
+                               cachedPreludeEntry,
+                               state.getPreludePath());
 
-    if (!responseData.has_value()) {
+    if (outcome == ResponseOutcome::Error) {
       emit error("Prelude update response errored");
       return;
     }
 
-    auto preludePath = state.getPreludePath();
-    preludeUpdated = updateFileWithData(preludePath, responseData.value());
+    if (outcome == ResponseOutcome::CachedCopyUnreadable) {
+      cachedPreludeEntry = std::nullopt;
+      sendRequest(source,
+                  cachedPreludeEntry,
+                  &UpdateMasterlistTask::onPreludeReplyFinished);
+      return;
+    }
+
+    preludeUpdated = outcome == ResponseOutcome::Changed;
 
     // Now update the masterlist.
     updateMasterlist();
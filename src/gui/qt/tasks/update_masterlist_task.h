@@ -29,6 +29,7 @@
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
 
+#include "gui/qt/shared_file_cache.h"
 #include "gui/qt/tasks/tasks.h"
 
 namespace loot {
@@ -45,11 +46,18 @@ private:
 
   QNetworkAccessManager *networkAccessManager{nullptr};
 
+  std::optional<SharedFileCache> sharedCache;
+  std::optional<SharedCacheEntry> cachedPreludeEntry;
+  std::optional<SharedCacheEntry> cachedMasterlistEntry;
+
   bool preludeUpdated{false};
   bool masterlistUpdated{false};
 
   void updatePrelude();
   void updateMasterlist();
+  void sendRequest(const std::string &source,
+                   const std::optional<SharedCacheEntry> &cachedEntry,
+                   void (UpdateMasterlistTask::*onReplyFinished)());
   void finish();
 
 private slots:
@@ -27,12 +27,16 @@ along with LOOT.  If not, see
 #define LOOT_GUI_QUERY_QUERY
 
 #include <boost/locale.hpp>
+#include <memory>
 #include <optional>
+#include <set>
 #include <string>
+#include <utility>
 #include <variant>
 
 #include "gui/helpers.h"
 #include "gui/plugin_item.h"
+#include "gui/qt/completion_index.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
 #include "gui/state/loot_state.h"
@@ -42,13 +46,17 @@ typedef std::vector<std::pair<std::string, std::optional<short>>>
     CancelSortResult;
 typedef std::vector<PluginItem> PluginItems;
 typedef std::vector<std::pair<PluginItem, bool>> GetConflictingPluginsResult;
+// The names of the groups at each end of some group graph edges.
+typedef std::set<std::pair<std::string, std::string>> GroupEdgeNames;
 
 typedef std::variant<std::monostate,
                      bool,
                      CancelSortResult,
                      PluginItems,
                      PluginItem,
-                     GetConflictingPluginsResult>
+                     GetConflictingPluginsResult,
+                     GroupEdgeNames,
+                     std::shared_ptr<const CompletionIndex>>
     QueryResult;
 
 class Query {
@@ -0,0 +1,46 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_BUILD_COMPLETION_INDEX_QUERY
+#define LOOT_GUI_QUERY_BUILD_COMPLETION_INDEX_QUERY
+
+#include "gui/query/query.h"
+
+namespace loot {
+class BuildCompletionIndexQuery : public Query {
+public:
+  explicit BuildCompletionIndexQuery(std::vector<std::string> names) :
+      names_(std::move(names)) {}
+
+  QueryResult executeLogic() override {
+    return std::make_shared<const CompletionIndex>(std::move(names_));
+  }
+
+private:
+  std::vector<std::string> names_;
+};
+}
+
+#endif
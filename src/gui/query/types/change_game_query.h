@@ -32,20 +32,18 @@ namespace loot {
 class ChangeGameQuery : public Query {
 public:
   ChangeGameQuery(GamesManager& gamesManager,
-                  std::string language,
                   std::string gameFolder,
                   std::function<void(std::string)> sendProgressUpdate) :
       gamesManager_(gamesManager),
       gameFolder_(gameFolder),
-      language_(language),
       sendProgressUpdate_(sendProgressUpdate) {}
 
   QueryResult executeLogic() override {
     gamesManager_.SetCurrentGame(gameFolder_);
     gamesManager_.GetCurrentGame().Init();
 
-    GetGameDataQuery subQuery(
-        gamesManager_.GetCurrentGame(), language_, sendProgressUpdate_);
+    GetGameDataQuery<> subQuery(gamesManager_.GetCurrentGame(),
+                                sendProgressUpdate_);
 
     return subQuery.executeLogic();
   }
@@ -53,7 +51,6 @@ public:
 private:
   GamesManager& gamesManager_;
   const std::string gameFolder_;
-  const std::string language_;
   const std::function<void(std::string)> sendProgressUpdate_;
 };
 }
@@ -0,0 +1,64 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_EVALUATE_PLUGIN_DETAILS_QUERY
+#define LOOT_GUI_QUERY_EVALUATE_PLUGIN_DETAILS_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+
+namespace loot {
+template<typename G = gui::Game>
+class EvaluatePluginDetailsQuery : public Query {
+public:
+  EvaluatePluginDetailsQuery(G& game,
+                             std::string language,
+                             std::vector<std::string> pluginNames) :
+      game_(game),
+      language_(language),
+      pluginNames_(std::move(pluginNames)) {}
+
+  QueryResult executeLogic() override {
+    std::vector<PluginItem> pluginItems;
+    pluginItems.reserve(pluginNames_.size());
+
+    for (const auto& pluginName : pluginNames_) {
+      const auto plugin = game_.GetPlugin(pluginName);
+      if (plugin) {
+        pluginItems.push_back(PluginItem(*plugin, game_, language_));
+      }
+    }
+
+    return pluginItems;
+  }
+
+private:
+  G& game_;
+  std::string language_;
+  std::vector<std::string> pluginNames_;
+};
+}
+
+#endif
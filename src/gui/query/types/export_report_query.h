@@ -0,0 +1,106 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_EXPORT_REPORT_QUERY
+#define LOOT_GUI_QUERY_EXPORT_REPORT_QUERY
+
+#include <boost/format.hpp>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+
+#include "gui/qt/report_writer.h"
+#include "gui/query/query.h"
+
+namespace loot {
+class ExportReportQuery : public Query {
+public:
+  static constexpr size_t PROGRESS_UPDATE_INTERVAL = 500;
+
+  ExportReportQuery(GeneralInformation generalInformation,
+                    std::shared_ptr<const std::vector<PluginItem>> pluginItems,
+                    std::filesystem::path outputPath,
+                    ReportFormat format,
+                    std::function<void(std::string)> sendProgressUpdate) :
+      generalInformation_(std::move(generalInformation)),
+      pluginItems_(std::move(pluginItems)),
+      outputPath_(std::move(outputPath)),
+      format_(format),
+      sendProgressUpdate_(sendProgressUpdate) {}
+
+  QueryResult executeLogic() override {
+    sendProgressUpdate_(boost::locale::translate("Exporting report..."));
+
+    std::ofstream out(outputPath_, std::ios::binary);
+    if (!out.is_open()) {
+      throw std::runtime_error(outputPath_.u8string() +
+                               " could not be opened for writing");
+    }
+
+    ReportWriter writer(out, format_);
+    writer.writeGeneralInformation(generalInformation_);
+
+    const auto& pluginItems = *pluginItems_;
+    for (size_t i = 0; i < pluginItems.size(); i += 1) {
+      writer.writePlugin(pluginItems[i]);
+
+      if ((i + 1) % PROGRESS_UPDATE_INTERVAL == 0) {
+        sendProgressUpdate_(
+            (boost::format(boost::locale::translate(
+                 "Exporting report... (%1% of %2% plugins)")) %
+             (i + 1) % pluginItems.size())
+                .str());
+      }
+    }
+
+    writer.finish();
+
+    out.close();
+    if (out.fail()) {
+      throw std::runtime_error(outputPath_.u8string() +
+                               " could not be written");
+    }
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->info("Exported a report of {} plugins to {}",
+                   writer.getPluginsWritten(),
+                   outputPath_.u8string());
+    }
+
+    return std::monostate();
+  }
+
+private:
+  const GeneralInformation generalInformation_;
+  const std::shared_ptr<const std::vector<PluginItem>> pluginItems_;
+  const std::filesystem::path outputPath_;
+  const ReportFormat format_;
+  const std::function<void(std::string)> sendProgressUpdate_;
+};
+}
+
+#endif
@@ -26,13 +26,16 @@ along with LOOT.  If not, see
 #ifndef LOOT_GUI_QUERY_GET_CONFLICTING_PLUGINS_QUERY
 #define LOOT_GUI_QUERY_GET_CONFLICTING_PLUGINS_QUERY
 
+#include <set>
+
 #include "gui/query/query.h"
 #include "gui/state/game/game.h"
 
 namespace loot {
+template<typename G = gui::Game>
 class GetConflictingPluginsQuery : public Query {
 public:
-  GetConflictingPluginsQuery(gui::Game& game,
+  GetConflictingPluginsQuery(G& game,
                              std::string language,
                              std::string pluginName) :
       game_(game), language_(language), pluginName_(pluginName) {}
@@ -43,18 +46,33 @@ public:
       logger->debug("Searching for plugins that conflict with {}", pluginName_);
     }
 
+    // If this plugin's conflicts have already been found, there's no need to
+    // use the full plugin data, which may have been discarded since.
+    auto conflictingPluginNames =
+        game_.GetCachedConflictingPluginNames(pluginName_);
+    if (conflictingPluginNames.has_value()) {
+      if (logger) {
+        logger->debug("Using cached conflicts for {}", pluginName_);
+      }
+
+      return getResult(conflictingPluginNames.value());
+    }
+
     // Checking for FormID overlap will only work if the plugins have been
     // loaded, so check if the plugins have been fully loaded, and if not load
     // all plugins.
     if (!game_.ArePluginsFullyLoaded())
       game_.LoadAllInstalledPlugins(false);
 
-    return getResult();
+    auto names = findConflictingPluginNames();
+    game_.CacheConflictingPluginNames(pluginName_, names);
+
+    return getResult(names);
   }
 
 private:
-  std::vector<std::pair<PluginItem, bool>> getResult() {
-    std::vector<std::pair<PluginItem, bool>> result;
+  std::vector<std::string> findConflictingPluginNames() {
+    std::vector<std::string> conflictingPluginNames;
 
     auto plugin = game_.GetPlugin(pluginName_);
     if (!plugin) {
@@ -63,8 +81,24 @@ private:
     }
 
     for (const auto& otherPlugin : game_.GetPluginsInLoadOrder()) {
-      auto metadata = PluginItem(*otherPlugin, game_, language_);
-      auto conflict = doPluginsConflict(*plugin, *otherPlugin);
+      if (doPluginsConflict(*plugin, *otherPlugin)) {
+        conflictingPluginNames.push_back(otherPlugin->GetName());
+      }
+    }
+
+    return conflictingPluginNames;
+  }
+
+  std::vector<std::pair<PluginItem, bool>> getResult(
+      const std::vector<std::string>& conflictingPluginNames) {
+    std::vector<std::pair<PluginItem, bool>> result;
+
+    const std::set<std::string> conflictingPluginNamesSet(
+        conflictingPluginNames.begin(), conflictingPluginNames.end());
+
+    for (const auto& plugin : game_.GetPluginsInLoadOrder()) {
+      auto metadata = PluginItem(*plugin, game_, language_);
+      auto conflict = conflictingPluginNamesSet.count(plugin->GetName()) > 0;
 
       result.push_back(std::make_pair(metadata, conflict));
     }
@@ -81,7 +115,7 @@ private:
     }
   }
 
-  gui::Game& game_;
+  G& game_;
   std::string language_;
   const std::string pluginName_;
 };
@@ -27,51 +27,93 @@ along with LOOT.  If not, see
 #define LOOT_GUI_QUERY_GET_GAME_DATA_QUERY
 
 #include <boost/locale.hpp>
+#include <future>
 
 #include "gui/query/query.h"
 #include "gui/state/game/game.h"
 #include "loot/loot_version.h"
 
 namespace loot {
+template<typename G = gui::Game>
 class GetGameDataQuery : public Query {
 public:
-  GetGameDataQuery(gui::Game& game,
-                   std::string language,
+  GetGameDataQuery(G& game,
                    std::function<void(std::string)> sendProgressUpdate) :
-      game_(game),
-      language_(language),
-      sendProgressUpdate_(sendProgressUpdate) {}
+      game_(game), sendProgressUpdate_(sendProgressUpdate) {}
 
   QueryResult executeLogic() override {
     sendProgressUpdate_(boost::locale::translate(
         "Parsing, merging and evaluating metadata..."));
 
     /* If the game's plugins object is empty, this is the first time loading
-       the game data, so also load the metadata lists. */
+       the game data, so also load the metadata lists. Parsing them doesn't
+       depend on the plugins, so do it on another thread while they load. */
     bool isFirstLoad = game_.GetPlugins().empty();
 
-    game_.LoadAllInstalledPlugins(true);
-
+    std::future<std::optional<Message>> metadataParsed;
     if (isFirstLoad) {
-      game_.LoadMetadata();
+      metadataParsed = std::async(std::launch::async, [this]() {
+        return game_.ParseMetadataLists();
+      });
+    }
+
+    try {
+      game_.LoadAllInstalledPlugins(true);
+    } catch (...) {
+      // Don't leave the metadata lists being parsed after this query has
+      // failed, and don't lose any error that parsing them caused.
+      if (metadataParsed.valid()) {
+        logMetadataParsingError(metadataParsed);
+      }
+      throw;
+    }
+
+    if (metadataParsed.valid()) {
+      const auto errorMessage = metadataParsed.get();
+      if (errorMessage.has_value()) {
+        game_.AppendMessage(errorMessage.value());
+      }
     }
 
     game_.LoadCreationClubPluginNames();
 
+    // Loading plugins doesn't publish the general messages because the
+    // metadata lists may have been parsed at the same time, so publish them
+    // now that both have finished.
+    game_.PublishStateSnapshot();
+
     // Sort plugins into their load order.
     auto installed = game_.GetPluginsInLoadOrder();
 
+    // Only get the data that's cheap to get, so that the cards can be
+    // displayed sooner: plugin messages and other evaluated metadata get
+    // filled in later.
     std::vector<PluginItem> metadata;
+    metadata.reserve(installed.size());
     for (const auto& plugin : installed) {
-      metadata.push_back(PluginItem(*plugin, game_, language_));
+      metadata.push_back(PluginItem(*plugin, game_));
     }
 
     return metadata;
   }
 
 private:
-  gui::Game& game_;
-  std::string language_;
+  static void logMetadataParsingError(
+      std::future<std::optional<Message>>& metadataParsed) {
+    try {
+      metadataParsed.get();
+    } catch (const std::exception& e) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->error(
+            "Failed to parse the metadata lists while plugins were being "
+            "loaded. Details: {}",
+            e.what());
+      }
+    }
+  }
+
+  G& game_;
   std::function<void(std::string)> sendProgressUpdate_;
 };
 }
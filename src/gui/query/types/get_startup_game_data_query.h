@@ -0,0 +1,58 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_GET_STARTUP_GAME_DATA_QUERY
+#define LOOT_GUI_QUERY_GET_STARTUP_GAME_DATA_QUERY
+
+#include <boost/locale.hpp>
+#include <future>
+
+#include "gui/query/query.h"
+
+namespace loot {
+// Waits for game data that started loading before the UI was ready, see
+// LootState::startLoadingCurrentGame().
+class GetStartupGameDataQuery : public Query {
+public:
+  GetStartupGameDataQuery(
+      std::future<std::vector<PluginItem>> gameData,
+      std::function<void(std::string)> sendProgressUpdate) :
+      gameData_(std::move(gameData)),
+      sendProgressUpdate_(sendProgressUpdate) {}
+
+  QueryResult executeLogic() override {
+    sendProgressUpdate_(boost::locale::translate(
+        "Parsing, merging and evaluating metadata..."));
+
+    return gameData_.get();
+  }
+
+private:
+  std::future<std::vector<PluginItem>> gameData_;
+  std::function<void(std::string)> sendProgressUpdate_;
+};
+}
+
+#endif
@@ -33,9 +33,10 @@ along with LOOT.  If not, see
 #include "gui/state/unapplied_change_counter.h"
 
 namespace loot {
+template<typename G = gui::Game>
 class SortPluginsQuery : public Query {
 public:
-  SortPluginsQuery(gui::Game& game,
+  SortPluginsQuery(G& game,
                    UnappliedChangeCounter& counter,
                    std::string language,
                    std::function<void(std::string)> sendProgressUpdate) :
@@ -85,7 +86,7 @@ private:
     return result;
   }
 
-  gui::Game& game_;
+  G& game_;
   std::string language_;
   UnappliedChangeCounter& counter_;
   const std::function<void(std::string)> sendProgressUpdate_;
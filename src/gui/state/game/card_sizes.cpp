@@ -0,0 +1,159 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/card_sizes.h"
+
+#include <fstream>
+
+namespace loot {
+constexpr uint32_t LCSZ_MAGIC_NUMBER = 0x5A53434C;
+constexpr uint8_t LCSZ_FORMAT_VERSION = 1;
+
+template<typename T>
+void readValue(std::istream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof value);
+}
+
+template<typename T>
+void writeValue(std::ostream& out, const T& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+CardSizes LoadCardSizes(const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return {};
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  uint32_t magicNumber{0};
+  readValue(in, magicNumber);
+
+  if (magicNumber != LCSZ_MAGIC_NUMBER) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": wrong magic number");
+  }
+
+  uint8_t formatVersion{0};
+  readValue(in, formatVersion);
+
+  if (formatVersion != LCSZ_FORMAT_VERSION) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": unrecognised format version");
+  }
+
+  uint16_t signatureLength{0};
+  readValue(in, signatureLength);
+
+  CardSizes cardSizes;
+  cardSizes.signature = std::string(signatureLength, '\0');
+  in.read(cardSizes.signature.data(), signatureLength);
+
+  if (!in.good()) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": the signature is truncated");
+  }
+
+  while (in.good()) {
+    CardSize cardSize;
+    readValue(in, cardSize.contentHash);
+
+    if (!in.good()) {
+      // Handle reaching end of file.
+      break;
+    }
+
+    int32_t minWidth{0};
+    readValue(in, minWidth);
+    cardSize.minWidth = minWidth;
+
+    uint16_t heightsCount{0};
+    readValue(in, heightsCount);
+
+    for (uint16_t i = 0; i < heightsCount && in.good(); i += 1) {
+      int32_t width{0};
+      int32_t height{0};
+      readValue(in, width);
+      readValue(in, height);
+
+      cardSize.heightsForWidths.emplace(width, height);
+    }
+
+    if (!in.good()) {
+      throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                               ": a card size is truncated");
+    }
+
+    cardSizes.sizes.push_back(std::move(cardSize));
+  }
+
+  return cardSizes;
+}
+
+void SaveCardSizes(const std::filesystem::path& filePath,
+                   const CardSizes& cardSizes) {
+  // Don't care about endianness because the files don't need to be portable.
+
+  if (cardSizes.signature.size() > UINT16_MAX) {
+    throw std::runtime_error("Cannot write a card size signature longer than " +
+                             std::to_string(UINT16_MAX) + " bytes");
+  }
+
+  std::ofstream out(
+      filePath,
+      std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  writeValue(out, LCSZ_MAGIC_NUMBER);
+  writeValue(out, LCSZ_FORMAT_VERSION);
+
+  writeValue(out, static_cast<uint16_t>(cardSizes.signature.size()));
+  out.write(cardSizes.signature.c_str(), cardSizes.signature.size());
+
+  for (const auto& cardSize : cardSizes.sizes) {
+    if (cardSize.heightsForWidths.size() > UINT16_MAX) {
+      throw std::runtime_error("Cannot write more than " +
+                               std::to_string(UINT16_MAX) +
+                               " heights for a card");
+    }
+
+    writeValue(out, cardSize.contentHash);
+    writeValue(out, static_cast<int32_t>(cardSize.minWidth));
+    writeValue(out, static_cast<uint16_t>(cardSize.heightsForWidths.size()));
+
+    for (const auto& [width, height] : cardSize.heightsForWidths) {
+      writeValue(out, static_cast<int32_t>(width));
+      writeValue(out, static_cast<int32_t>(height));
+    }
+  }
+}
+}
@@ -0,0 +1,57 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_CARD_SIZES
+#define LOOT_GUI_STATE_GAME_CARD_SIZES
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace loot {
+struct CardSize {
+  // A hash of all the content that the card's size depends on.
+  uint64_t contentHash{0};
+  int minWidth{0};
+  // Card heights keyed by the width that they were measured at.
+  std::map<int, int> heightsForWidths;
+};
+
+struct CardSizes {
+  // Identifies the fonts, screen metrics and language that the sizes were
+  // measured with, as sizes measured with different values aren't reusable.
+  std::string signature;
+  std::vector<CardSize> sizes;
+};
+
+CardSizes LoadCardSizes(const std::filesystem::path& filePath);
+
+void SaveCardSizes(const std::filesystem::path& filePath,
+                   const CardSizes& cardSizes);
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/condition_cache.h"
+
+#include <fstream>
+#include <regex>
+#include <set>
+#include <sstream>
+
+#include "gui/helpers.h"
+
+namespace loot {
+constexpr uint32_t LCDC_MAGIC_NUMBER = 0x4344434C;
+constexpr uint8_t LCDC_FORMAT_VERSION = 1;
+
+constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+constexpr uint64_t FNV_PRIME = 0x100000001B3;
+
+// Characters that libloot treats as part of a regex, plus the characters that
+// are commonly used in regexes even though they can't appear in paths.
+constexpr const char* REGEX_CHARACTERS = ":\\*?|()[]{}^$+";
+
+std::string readConditionCacheString(std::istream& in) {
+  uint16_t length{0};
+  in.read(reinterpret_cast<char*>(&length), sizeof length);
+
+  std::string string(length, '\0');
+  in.read(string.data(), length);
+
+  return string;
+}
+
+void writeConditionCacheString(std::ostream& out, const std::string& string) {
+  // Don't care about endianness because the files don't need to be portable.
+  if (string.size() > UINT16_MAX) {
+    throw std::runtime_error("Cannot write a string longer than " +
+                             std::to_string(UINT16_MAX) + " bytes");
+  }
+
+  const auto length = static_cast<uint16_t>(string.size());
+  out.write(reinterpret_cast<const char*>(&length), sizeof length);
+  out.write(string.data(), length);
+}
+
+void hashBytes(uint64_t& hash, const void* data, size_t size) {
+  const auto bytes = reinterpret_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; i += 1) {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+}
+
+template<typename T>
+void hashValue(uint64_t& hash, const T& value) {
+  hashBytes(hash, &value, sizeof value);
+}
+
+void hashString(uint64_t& hash, const std::string& string) {
+  hashBytes(hash, string.data(), string.size());
+  // Include the terminator so that adjacent strings can't run together.
+  hashValue(hash, '\0');
+}
+
+void hashPathState(uint64_t& hash, const std::filesystem::path& path) {
+  std::error_code errorCode;
+  const auto status = std::filesystem::status(path, errorCode);
+  const bool exists = !errorCode && std::filesystem::exists(status);
+
+  hashValue(hash, exists);
+  if (!exists) {
+    return;
+  }
+
+  const auto isRegularFile = std::filesystem::is_regular_file(status);
+  hashValue(hash, isRegularFile);
+
+  if (isRegularFile) {
+    const uint64_t size = std::filesystem::file_size(path, errorCode);
+    hashValue(hash, errorCode ? UINT64_MAX : size);
+  }
+
+  // A directory's modification time changes when entries are added to it or
+  // removed from it, which is what regex conditions check for.
+  const auto writeTime = std::filesystem::last_write_time(path, errorCode);
+  const auto ticks = static_cast<int64_t>(writeTime.time_since_epoch().count());
+  hashValue(hash, errorCode ? int64_t{0} : ticks);
+}
+
+ConditionCache LoadConditionCache(const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return {};
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  uint32_t magicNumber{0};
+  in.read(reinterpret_cast<char*>(&magicNumber), sizeof magicNumber);
+
+  if (magicNumber != LCDC_MAGIC_NUMBER) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": wrong magic number");
+  }
+
+  uint8_t formatVersion{0};
+  in.read(reinterpret_cast<char*>(&formatVersion), sizeof formatVersion);
+
+  if (formatVersion != LCDC_FORMAT_VERSION) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": unrecognised format version");
+  }
+
+  ConditionCache cache;
+  cache.signature = readConditionCacheString(in);
+
+  if (!in.good()) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": the signature is truncated");
+  }
+
+  while (in.good()) {
+    auto condition = readConditionCacheString(in);
+
+    if (!in.good()) {
+      // Handle reaching end of file.
+      break;
+    }
+
+    CachedConditionResult result;
+    uint8_t resultValue{0};
+    in.read(reinterpret_cast<char*>(&result.fingerprint),
+            sizeof result.fingerprint);
+    in.read(reinterpret_cast<char*>(&resultValue), sizeof resultValue);
+    result.result = resultValue != 0;
+
+    if (!in.good()) {
+      throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                               ": a condition result is truncated");
+    }
+
+    cache.results.insert_or_assign(std::move(condition), result);
+  }
+
+  return cache;
+}
+
+void SaveConditionCache(const std::filesystem::path& filePath,
+                        const ConditionCache& cache) {
+  // Another LOOT instance may be reading or writing the same file, so write
+  // it atomically to avoid leaving it truncated.
+  std::ostringstream out(std::ios_base::out | std::ios_base::binary);
+
+  out.write(reinterpret_cast<const char*>(&LCDC_MAGIC_NUMBER),
+            sizeof LCDC_MAGIC_NUMBER);
+  out.write(reinterpret_cast<const char*>(&LCDC_FORMAT_VERSION),
+            sizeof LCDC_FORMAT_VERSION);
+
+  writeConditionCacheString(out, cache.signature);
+
+  for (const auto& [condition, result] : cache.results) {
+    const uint8_t resultValue = result.result ? 1 : 0;
+
+    writeConditionCacheString(out, condition);
+    out.write(reinterpret_cast<const char*>(&result.fingerprint),
+              sizeof result.fingerprint);
+    out.write(reinterpret_cast<const char*>(&resultValue), sizeof resultValue);
+  }
+
+  const auto content = out.str();
+  writeFileAtomically(filePath, content.data(), content.size());
+}
+
+std::vector<std::string> GetConditionPaths(const std::string& condition) {
+  // Every condition function that reads the filesystem takes a quoted path or
+  // regex. Other quoted arguments (i.e. versions) are also picked up, but
+  // they're harmless as they just get hashed as paths that don't exist.
+  static const std::regex STRING_LITERAL_REGEX("\"([^\"]*)\"");
+
+  std::set<std::string> paths;
+  auto begin = std::sregex_iterator(
+      condition.begin(), condition.end(), STRING_LITERAL_REGEX);
+  for (auto it = begin; it != std::sregex_iterator(); ++it) {
+    const auto string = (*it)[1].str();
+    paths.insert(string);
+
+    if (string.find_first_of(REGEX_CHARACTERS) != std::string::npos) {
+      // The string might be a regex, in which case only its last component
+      // is a regex and the rest is a directory path.
+      const auto lastSlashPos = string.rfind('/');
+      paths.insert(lastSlashPos == std::string::npos
+                       ? std::string()
+                       : string.substr(0, lastSlashPos));
+    }
+  }
+
+  return std::vector<std::string>(paths.begin(), paths.end());
+}
+
+uint64_t GetActivePluginsFingerprint(
+    const std::vector<std::string>& activePluginNames) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for (const auto& name : activePluginNames) {
+    hashString(hash, name);
+  }
+
+  return hash;
+}
+
+uint64_t GetConditionFingerprint(const std::string& condition,
+                                 const std::filesystem::path& dataPath,
+                                 uint64_t activePluginsFingerprint) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+
+  for (const auto& path : GetConditionPaths(condition)) {
+    const auto fullPath = dataPath / std::filesystem::u8path(path);
+
+    hashString(hash, path);
+    hashPathState(hash, fullPath);
+
+    // Plugins may be ghosted.
+    auto ghostedPath = fullPath;
+    ghostedPath += ".ghost";
+    hashPathState(hash, ghostedPath);
+  }
+
+  // This also matches many_active().
+  if (condition.find("active(") != std::string::npos) {
+    hashValue(hash, activePluginsFingerprint);
+  }
+
+  return hash;
+}
+
+uint64_t GetPathsFingerprint(const std::vector<std::filesystem::path>& paths) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+
+  for (const auto& path : paths) {
+    hashString(hash, path.u8string());
+    hashPathState(hash, path);
+  }
+
+  return hash;
+}
+}
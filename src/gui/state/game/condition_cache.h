@@ -0,0 +1,84 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_CONDITION_CACHE
+#define LOOT_GUI_STATE_GAME_CONDITION_CACHE
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace loot {
+struct CachedConditionResult {
+  // A hash of the state of everything that the condition's result depends
+  // on, as given by GetConditionFingerprint().
+  uint64_t fingerprint{0};
+  bool result{false};
+};
+
+struct ConditionCache {
+  // Identifies the libloot build and game that the conditions were evaluated
+  // with, as results evaluated for a different build or game aren't reusable.
+  std::string signature;
+  std::unordered_map<std::string, CachedConditionResult> results;
+};
+
+ConditionCache LoadConditionCache(const std::filesystem::path& filePath);
+
+void SaveConditionCache(const std::filesystem::path& filePath,
+                        const ConditionCache& cache);
+
+// Get the paths, relative to the game's data path, that a condition reads. A
+// path that contains regex characters is replaced by its parent path, as the
+// condition depends on that directory's entries.
+std::vector<std::string> GetConditionPaths(const std::string& condition);
+
+uint64_t GetActivePluginsFingerprint(
+    const std::vector<std::string>& activePluginNames);
+
+// Hash the size and modification time of each path that the condition reads,
+// and the given active plugins fingerprint if the condition checks whether
+// plugins are active. A condition's result can be reused for as long as its
+// fingerprint stays the same.
+//
+// File contents aren't hashed, even for checksum() conditions, as that would
+// mean reading every file that a condition references (including large
+// archives) each time the cache is checked, which is about as expensive as
+// evaluating the condition. The trade-off is that an edit that keeps a file's
+// size and modification time unchanged leaves a stale checksum() result in
+// the cache until the file changes again or the cache is deleted.
+uint64_t GetConditionFingerprint(const std::string& condition,
+                                 const std::filesystem::path& dataPath,
+                                 uint64_t activePluginsFingerprint);
+
+// Hash the size and modification time of each of the given paths, so that
+// other cached state can be invalidated when the files it was built from
+// change.
+uint64_t GetPathsFingerprint(const std::vector<std::filesystem::path>& paths);
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/evaluation_costs.h"
+
+#include <toml++/toml.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace loot {
+int64_t toMicroseconds(std::chrono::nanoseconds duration) {
+  return static_cast<int64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+template<typename T, typename Compare>
+std::vector<T> getLargestValues(
+    const std::unordered_map<std::string, T>& costs,
+    size_t count,
+    Compare isLarger) {
+  std::vector<T> values;
+  values.reserve(costs.size());
+  for (const auto& [key, value] : costs) {
+    values.push_back(value);
+  }
+
+  // Only the largest values need to be in order.
+  const auto middle = values.begin() + std::min(count, values.size());
+  std::partial_sort(values.begin(), middle, values.end(), isLarger);
+  values.erase(middle, values.end());
+
+  return values;
+}
+
+std::chrono::nanoseconds PluginEvaluationCost::GetTotal() const {
+  return metadataEvaluation + installValidityCheck + bashTagsFileCheck +
+         messageConversion + tagCollection;
+}
+
+void EvaluationCostRecorder::RecordPlugin(const PluginEvaluationCost& cost) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  pluginCosts_.insert_or_assign(cost.pluginName, cost);
+}
+
+void EvaluationCostRecorder::RecordCondition(
+    const std::string& condition,
+    std::chrono::nanoseconds duration) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  auto& cost = conditionCosts_[condition];
+  cost.condition = condition;
+  cost.duration += duration;
+  cost.evaluationCount += 1;
+}
+
+void EvaluationCostRecorder::Clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  pluginCosts_.clear();
+  conditionCosts_.clear();
+}
+
+EvaluationCostReport EvaluationCostRecorder::GetReport(size_t count) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  EvaluationCostReport report;
+  report.slowestPlugins =
+      getLargestValues(pluginCosts_,
+                       count,
+                       [](const auto& lhs, const auto& rhs) {
+                         return lhs.GetTotal() > rhs.GetTotal();
+                       });
+  report.mostExpensiveConditions =
+      getLargestValues(conditionCosts_,
+                       count,
+                       [](const auto& lhs, const auto& rhs) {
+                         return lhs.duration > rhs.duration;
+                       });
+
+  return report;
+}
+
+void SaveEvaluationCostReport(const std::filesystem::path& filePath,
+                              const EvaluationCostReport& report) {
+  toml::array plugins;
+  for (const auto& cost : report.slowestPlugins) {
+    plugins.push_back(toml::table{
+        {"name", cost.pluginName},
+        {"totalMicroseconds", toMicroseconds(cost.GetTotal())},
+        {"metadataEvaluationMicroseconds",
+         toMicroseconds(cost.metadataEvaluation)},
+        {"installValidityCheckMicroseconds",
+         toMicroseconds(cost.installValidityCheck)},
+        {"bashTagsFileCheckMicroseconds",
+         toMicroseconds(cost.bashTagsFileCheck)},
+        {"messageConversionMicroseconds",
+         toMicroseconds(cost.messageConversion)},
+        {"tagCollectionMicroseconds", toMicroseconds(cost.tagCollection)},
+    });
+  }
+
+  toml::array conditions;
+  for (const auto& cost : report.mostExpensiveConditions) {
+    conditions.push_back(toml::table{
+        {"condition", cost.condition},
+        {"totalMicroseconds", toMicroseconds(cost.duration)},
+        {"evaluationCount", static_cast<int64_t>(cost.evaluationCount)},
+    });
+  }
+
+  const toml::table root{
+      {"slowestPlugins", plugins},
+      {"mostExpensiveConditions", conditions},
+  };
+
+  std::ofstream out(filePath);
+  if (!out.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  out << root;
+}
+}
@@ -0,0 +1,90 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_EVALUATION_COSTS
+#define LOOT_GUI_STATE_GAME_EVALUATION_COSTS
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace loot {
+// The time taken by each stage of evaluating a plugin's details.
+struct PluginEvaluationCost {
+  std::string pluginName;
+  std::chrono::nanoseconds metadataEvaluation{0};
+  std::chrono::nanoseconds installValidityCheck{0};
+  // Reading the plugin's BashTags file and checking it for conflicts.
+  std::chrono::nanoseconds bashTagsFileCheck{0};
+  std::chrono::nanoseconds messageConversion{0};
+  std::chrono::nanoseconds tagCollection{0};
+
+  std::chrono::nanoseconds GetTotal() const;
+};
+
+// The time spent evaluating a metadata condition, summed over all the times
+// it was evaluated.
+struct ConditionEvaluationCost {
+  std::string condition;
+  std::chrono::nanoseconds duration{0};
+  size_t evaluationCount{0};
+};
+
+struct EvaluationCostReport {
+  // Sorted by descending total duration.
+  std::vector<PluginEvaluationCost> slowestPlugins;
+  // Sorted by descending duration.
+  std::vector<ConditionEvaluationCost> mostExpensiveConditions;
+};
+
+// Records how long plugins' details and metadata conditions take to evaluate,
+// so that a slow refresh can be attributed to the plugins and conditions
+// responsible for it. Costs can be recorded from multiple threads at once.
+class EvaluationCostRecorder {
+public:
+  static constexpr size_t DEFAULT_REPORT_SIZE = 50;
+
+  // Replaces any cost previously recorded for the same plugin.
+  void RecordPlugin(const PluginEvaluationCost& cost);
+  void RecordCondition(const std::string& condition,
+                       std::chrono::nanoseconds duration);
+  void Clear();
+
+  EvaluationCostReport GetReport(size_t count = DEFAULT_REPORT_SIZE) const;
+
+private:
+  std::unordered_map<std::string, PluginEvaluationCost> pluginCosts_;
+  std::unordered_map<std::string, ConditionEvaluationCost> conditionCosts_;
+  mutable std::mutex mutex_;
+};
+
+void SaveEvaluationCostReport(const std::filesystem::path& filePath,
+                              const EvaluationCostReport& report);
+}
+
+#endif
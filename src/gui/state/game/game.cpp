@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <iterator>
 #include <thread>
 
 #ifdef _WIN32
@@ -55,6 +56,7 @@
 #include "gui/state/loot_paths.h"
 #include "loot/exception/file_access_error.h"
 #include "loot/exception/undefined_group_error.h"
+#include "loot/loot_version.h"
 
 using std::list;
 using std::lock_guard;
@@ -74,6 +76,17 @@ bool hasPluginFileExtension(const std::string& filename) {
          boost::iends_with(filename, ".esl");
 }
 
+std::string GetResidentMemoryUsageText() {
+  static constexpr size_t BYTES_PER_MIB = 1024 * 1024;
+
+  const auto usage = getResidentMemoryUsage();
+  if (!usage.has_value()) {
+    return "an unknown amount of";
+  }
+
+  return std::to_string(usage.value() / BYTES_PER_MIB) + " MiB of";
+}
+
 std::string GetDisplayName(const File& file) {
   if (file.GetDisplayName().empty()) {
     return EscapeMarkdownASCIIPunctuation(std::string(file.GetName()));
@@ -82,6 +95,39 @@ std::string GetDisplayName(const File& file) {
   return file.GetDisplayName();
 }
 
+template<typename T, typename F>
+std::vector<T> FilterByCondition(const std::vector<T>& items,
+                                 const F& evaluateCondition) {
+  std::vector<T> filtered;
+  std::copy_if(items.begin(),
+               items.end(),
+               std::back_inserter(filtered),
+               [&](const T& item) {
+                 return evaluateCondition(item.GetCondition());
+               });
+
+  return filtered;
+}
+
+template<typename F>
+std::vector<PluginCleaningData> FilterByChecksum(
+    const std::string& pluginName,
+    const std::vector<PluginCleaningData>& cleaningData,
+    const F& evaluateCondition) {
+  std::vector<PluginCleaningData> filtered;
+  std::copy_if(cleaningData.begin(),
+               cleaningData.end(),
+               std::back_inserter(filtered),
+               [&](const PluginCleaningData& data) {
+                 // This is the condition that libloot uses to evaluate
+                 // cleaning data.
+                 return evaluateCondition("checksum(\"" + pluginName + "\", " +
+                                          crcToString(data.GetCRC()) + ")");
+               });
+
+  return filtered;
+}
+
 Game::Game(const GameSettings& gameSettings,
            const std::filesystem::path& lootDataPath,
            const std::filesystem::path& preludePath) :
@@ -99,6 +145,12 @@ Game::Game(Game&& game) {
   preludePath_ = std::move(game.preludePath_);
   loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
   pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
+  fullPluginDataLoadDuration_ = std::move(game.fullPluginDataLoadDuration_);
+  conflictingPluginNames_ = std::move(game.conflictingPluginNames_);
+  conditionCache_ = std::move(game.conditionCache_);
+  evaluatedConditions_ = std::move(game.evaluatedConditions_);
+  activePluginsFingerprint_ = game.activePluginsFingerprint_;
+  std::atomic_store(&stateSnapshot_, std::atomic_load(&game.stateSnapshot_));
 }
 
 Game& Game::operator=(Game&& game) {
@@ -112,6 +164,12 @@ Game& Game::operator=(Game&& game) {
     preludePath_ = std::move(game.preludePath_);
     loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
     pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
+    fullPluginDataLoadDuration_ = std::move(game.fullPluginDataLoadDuration_);
+    conflictingPluginNames_ = std::move(game.conflictingPluginNames_);
+    conditionCache_ = std::move(game.conditionCache_);
+    evaluatedConditions_ = std::move(game.evaluatedConditions_);
+    activePluginsFingerprint_ = game.activePluginsFingerprint_;
+    std::atomic_store(&stateSnapshot_, std::atomic_load(&game.stateSnapshot_));
   }
 
   return *this;
@@ -132,6 +190,7 @@ void Game::Init() {
   messages_.clear();
   loadOrderSortCount_ = 0;
   pluginsFullyLoaded_ = false;
+  conflictingPluginNames_.clear();
 
   gameHandle_ = CreateGameHandle(
       settings_.Type(), settings_.GamePath(), settings_.GameLocalPath());
@@ -175,7 +234,11 @@ void Game::Init() {
 
       fs::create_directories(lootGamePath);
     }
+
+    LoadConditionResults();
   }
+
+  PublishStateSnapshot();
 }
 
 bool Game::IsInitialised() const { return gameHandle_ != nullptr; }
@@ -428,30 +491,6 @@ std::vector<Message> Game::CheckInstallValidity(
     }
   }
 
-  const auto lootTags = metadata.GetTags();
-  if (!lootTags.empty()) {
-    const auto bashTagFileTags =
-        ReadBashTagsFile(settings_.DataPath(), metadata.GetName());
-    const auto conflictingTags = GetTagConflicts(lootTags, bashTagFileTags);
-    if (!conflictingTags.empty()) {
-      const auto commaSeparatedTags = boost::join(conflictingTags, ", ");
-      if (logger) {
-        logger->info(
-            "\"{}\" has suggestions for the following Bash Tags that "
-            "conflict with the plugin's BashTags file: {}.",
-            plugin.GetName(),
-            commaSeparatedTags);
-      }
-      messages.push_back(PlainTextMessage(
-          MessageType::say,
-          (boost::format(boost::locale::translate(
-               "This plugin has a BashTags file that will override the "
-               "suggestions made by LOOT for the following Bash Tags: %1%.")) %
-           commaSeparatedTags)
-              .str()));
-    }
-  }
-
   // Also generate dirty messages.
   for (const auto& element : metadata.GetDirtyInfo()) {
     messages.push_back(ToMessage(element));
@@ -460,6 +499,40 @@ std::vector<Message> Game::CheckInstallValidity(
   return messages;
 }
 
+std::vector<Message> Game::CheckBashTagsFile(
+    const PluginInterface& plugin,
+    const PluginMetadata& metadata) const {
+  const auto lootTags = metadata.GetTags();
+  if (lootTags.empty()) {
+    return {};
+  }
+
+  const auto bashTagFileTags =
+      ReadBashTagsFile(settings_.DataPath(), metadata.GetName());
+  const auto conflictingTags = GetTagConflicts(lootTags, bashTagFileTags);
+  if (conflictingTags.empty()) {
+    return {};
+  }
+
+  const auto commaSeparatedTags = boost::join(conflictingTags, ", ");
+  auto logger = getLogger();
+  if (logger) {
+    logger->info(
+        "\"{}\" has suggestions for the following Bash Tags that "
+        "conflict with the plugin's BashTags file: {}.",
+        plugin.GetName(),
+        commaSeparatedTags);
+  }
+
+  return {PlainTextMessage(
+      MessageType::say,
+      (boost::format(boost::locale::translate(
+           "This plugin has a BashTags file that will override the "
+           "suggestions made by LOOT for the following Bash Tags: %1%.")) %
+       commaSeparatedTags)
+          .str())};
+}
+
 void Game::RedatePlugins() {
   auto logger = getLogger();
 
@@ -541,16 +614,36 @@ void Game::LoadAllInstalledPlugins(bool headersOnly) {
     if (logger) {
       logger->error("Failed to load current load order. Details: {}", e.what());
     }
-    AppendMessage(PlainTextMessage(
+    AppendMessages({PlainTextMessage(
         MessageType::error,
         boost::locale::translate("Failed to load the current load order, "
                                  "information displayed may be incorrect.")
-            .str()));
+            .str())});
   }
 
+  // Any plugin may have changed since conflicts were last checked.
+  conflictingPluginNames_.clear();
+  evaluationCosts_.Clear();
+
+  const auto startTime = std::chrono::steady_clock::now();
+
   auto installedPluginNames = GetInstalledPluginNames();
   gameHandle_->LoadPlugins(installedPluginNames, headersOnly);
 
+  if (!headersOnly) {
+    fullPluginDataLoadDuration_ =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime);
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->info(
+          "Fully loading plugins took {} ms, LOOT is now using {} memory",
+          fullPluginDataLoadDuration_.count(),
+          GetResidentMemoryUsageText());
+    }
+  }
+
   // Check if any plugins have been removed.
   std::vector<std::string> loadedPluginNames;
   for (auto plugin : gameHandle_->GetLoadedPlugins()) {
@@ -561,10 +654,64 @@ void Game::LoadAllInstalledPlugins(bool headersOnly) {
       CheckForRemovedPlugins(installedPluginNames, loadedPluginNames));
 
   pluginsFullyLoaded_ = !headersOnly;
+
+  // Any file may have changed since conditions were last evaluated.
+  ResetEvaluatedConditions();
+
+  PublishPluginStateSnapshot();
 }
 
 bool Game::ArePluginsFullyLoaded() const { return pluginsFullyLoaded_; }
 
+void Game::DiscardFullPluginData() {
+  if (!pluginsFullyLoaded_) {
+    return;
+  }
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->info(
+        "Discarding full plugin data, LOOT is currently using {} memory",
+        GetResidentMemoryUsageText());
+  }
+
+  // Reload the same plugins that are currently loaded, so that the set of
+  // loaded plugins doesn't change without the UI being updated.
+  std::vector<std::string> loadedPluginNames;
+  for (auto plugin : gameHandle_->GetLoadedPlugins()) {
+    loadedPluginNames.push_back(plugin->GetName());
+  }
+
+  gameHandle_->LoadPlugins(loadedPluginNames, true);
+
+  pluginsFullyLoaded_ = false;
+
+  if (logger) {
+    logger->info(
+        "Discarded full plugin data, LOOT is now using {} memory. Checking "
+        "for conflicts with a plugin that has not already been checked will "
+        "take about {} ms to load the data again",
+        GetResidentMemoryUsageText(),
+        fullPluginDataLoadDuration_.count());
+  }
+}
+
+std::optional<std::vector<std::string>> Game::GetCachedConflictingPluginNames(
+    const std::string& pluginName) const {
+  const auto it = conflictingPluginNames_.find(pluginName);
+  if (it == conflictingPluginNames_.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+
+void Game::CacheConflictingPluginNames(
+    const std::string& pluginName,
+    const std::vector<std::string>& conflictingPluginNames) {
+  conflictingPluginNames_.insert_or_assign(pluginName, conflictingPluginNames);
+}
+
 fs::path Game::MasterlistPath() const {
   return GetLOOTGamePath() / "masterlist.yaml";
 }
@@ -577,6 +724,14 @@ fs::path Game::GroupNodePositionsPath() const {
   return GetLOOTGamePath() / "group_node_positions.bin";
 }
 
+fs::path Game::CardSizesPath() const {
+  return GetLOOTGamePath() / "card_sizes.bin";
+}
+
+fs::path Game::ConditionCachePath() const {
+  return GetLOOTGamePath() / "condition_cache.bin";
+}
+
 std::vector<std::string> Game::GetLoadOrder() const {
   return gameHandle_->GetLoadOrder();
 }
@@ -584,6 +739,8 @@ std::vector<std::string> Game::GetLoadOrder() const {
 void Game::SetLoadOrder(const std::vector<std::string>& loadOrder) {
   BackupLoadOrder(GetLoadOrder(), GetLOOTGamePath());
   gameHandle_->SetLoadOrder(loadOrder);
+
+  PublishStateSnapshot();
 }
 
 bool Game::IsPluginActive(const std::string& pluginName) const {
@@ -629,18 +786,21 @@ std::vector<std::string> Game::SortPlugins() {
     if (logger) {
       logger->error("Failed to load current load order. Details: {}", e.what());
     }
-    AppendMessage(PlainTextMessage(
+    AppendMessages({PlainTextMessage(
         MessageType::error,
         boost::locale::translate("Failed to load the current load order, "
                                  "information displayed may be incorrect.")
-            .str()));
+            .str())});
   }
 
   std::vector<std::string> sortedPlugins;
   try {
     // Clear any existing game-specific messages, as these only relate to
     // state that has been changed by sorting.
-    ClearMessages();
+    {
+      lock_guard<mutex> guard(mutex_);
+      messages_.clear();
+    }
 
     auto currentLoadOrder = gameHandle_->GetLoadOrder();
 
@@ -648,29 +808,33 @@ std::vector<std::string> Game::SortPlugins() {
 
     AppendMessages(CheckForRemovedPlugins(currentLoadOrder, sortedPlugins));
 
-    IncrementLoadOrderSortCount();
+    {
+      lock_guard<mutex> guard(mutex_);
+      ++loadOrderSortCount_;
+    }
   } catch (CyclicInteractionError& e) {
     if (logger) {
       logger->error("Failed to sort plugins. Details: {}", e.what());
     }
-    AppendMessage(Message(
+    AppendMessages({Message(
         MessageType::error,
         (boost::format(boost::locale::translate(
              "Cyclic interaction detected between \"%1%\" and \"%2%\": %3%")) %
          EscapeMarkdownASCIIPunctuation(e.GetCycle().front().GetName()) %
          EscapeMarkdownASCIIPunctuation(e.GetCycle().back().GetName()) %
          DescribeCycle(e.GetCycle()))
-            .str()));
+            .str())});
     sortedPlugins.clear();
   } catch (UndefinedGroupError& e) {
     if (logger) {
       logger->error("Failed to sort plugins. Details: {}", e.what());
     }
-    AppendMessage(PlainTextMessage(MessageType::error,
-                                   (boost::format(boost::locale::translate(
-                                        "The group \"%1%\" does not exist.")) %
-                                    e.GetGroupName())
-                                       .str()));
+    AppendMessages({PlainTextMessage(
+        MessageType::error,
+        (boost::format(
+             boost::locale::translate("The group \"%1%\" does not exist.")) %
+         e.GetGroupName())
+            .str())});
     sortedPlugins.clear();
   } catch (const std::exception& e) {
     if (logger) {
@@ -679,20 +843,30 @@ std::vector<std::string> Game::SortPlugins() {
     sortedPlugins.clear();
   }
 
+  PublishStateSnapshot();
+
   return sortedPlugins;
 }
 
 void Game::IncrementLoadOrderSortCount() {
-  lock_guard<mutex> guard(mutex_);
+  {
+    lock_guard<mutex> guard(mutex_);
 
-  ++loadOrderSortCount_;
+    ++loadOrderSortCount_;
+  }
+
+  PublishStateSnapshot();
 }
 
 void Game::DecrementLoadOrderSortCount() {
-  lock_guard<mutex> guard(mutex_);
+  {
+    lock_guard<mutex> guard(mutex_);
 
-  if (loadOrderSortCount_ > 0)
-    --loadOrderSortCount_;
+    if (loadOrderSortCount_ > 0)
+      --loadOrderSortCount_;
+  }
+
+  PublishStateSnapshot();
 }
 
 std::vector<Message> Game::GetMessages() const {
@@ -753,18 +927,31 @@ std::vector<Message> Game::GetMessages() const {
 }
 
 void Game::AppendMessage(const Message& message) {
-  lock_guard<mutex> guard(mutex_);
+  AppendMessages({message});
 
-  messages_.push_back(message);
+  PublishStateSnapshot();
 }
 
 void Game::ClearMessages() {
-  lock_guard<mutex> guard(mutex_);
+  {
+    lock_guard<mutex> guard(mutex_);
 
-  messages_.clear();
+    messages_.clear();
+  }
+
+  PublishStateSnapshot();
 }
 
 void Game::LoadMetadata() {
+  const auto errorMessage = ParseMetadataLists();
+  if (errorMessage.has_value()) {
+    AppendMessages({errorMessage.value()});
+  }
+
+  PublishStateSnapshot();
+}
+
+std::optional<Message> Game::ParseMetadataLists() {
   auto logger = getLogger();
 
   std::filesystem::path masterlistPreludePath;
@@ -803,7 +990,7 @@ void Game::LoadMetadata() {
       logger->error("An error occurred while parsing the metadata list(s): {}",
                     e.what());
     }
-    AppendMessage(Message(
+    return Message(
         MessageType::error,
         (boost::format(boost::locale::translate(
              "An error occurred while parsing the metadata list(s): "
@@ -819,8 +1006,10 @@ void Game::LoadMetadata() {
              "thread, which is linked to on [LOOT's "
              "website](https://loot.github.io/).")) %
          EscapeMarkdownASCIIPunctuation(e.what()))
-            .str()));
+            .str());
   }
+
+  return std::nullopt;
 }
 
 std::vector<std::string> Game::GetKnownBashTags() const {
@@ -838,8 +1027,10 @@ std::vector<Group> Game::GetUserGroups() const {
 std::optional<PluginMetadata> Game::GetMasterlistMetadata(
     const std::string& pluginName,
     bool evaluateConditions) const {
-  return gameHandle_->GetDatabase().GetPluginMetadata(
-      pluginName, false, evaluateConditions);
+  auto metadata =
+      gameHandle_->GetDatabase().GetPluginMetadata(pluginName, false, false);
+
+  return evaluateConditions ? EvaluateConditions(metadata) : metadata;
 }
 
 std::optional<PluginMetadata> Game::GetNonUserMetadata(
@@ -865,8 +1056,10 @@ std::optional<PluginMetadata> Game::GetNonUserMetadata(
 std::optional<PluginMetadata> Game::GetUserMetadata(
     const std::string& pluginName,
     bool evaluateConditions) const {
-  return gameHandle_->GetDatabase().GetPluginUserMetadata(pluginName,
-                                                          evaluateConditions);
+  auto metadata =
+      gameHandle_->GetDatabase().GetPluginUserMetadata(pluginName, false);
+
+  return evaluateConditions ? EvaluateConditions(metadata) : metadata;
 }
 
 void Game::SetUserGroups(const std::vector<Group>& groups) {
@@ -889,10 +1082,153 @@ void Game::SaveUserMetadata() {
   gameHandle_->GetDatabase().WriteUserMetadata(UserlistPath(), true);
 }
 
+void Game::LoadConditionResults() {
+  ConditionCache cache;
+  try {
+    cache = LoadConditionCache(ConditionCachePath());
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to load the condition cache: {}", e.what());
+    }
+  }
+
+  const auto signature = GetConditionCacheSignature();
+
+  lock_guard<mutex> guard(conditionCacheMutex_);
+
+  if (cache.signature == signature) {
+    conditionCache_ = std::move(cache);
+  } else {
+    conditionCache_ = ConditionCache();
+    conditionCache_.signature = signature;
+  }
+
+  evaluatedConditions_.clear();
+}
+
+void Game::SaveConditionResults() const {
+  if (lootDataPath_.empty()) {
+    return;
+  }
+
+  ConditionCache cache;
+  {
+    lock_guard<mutex> guard(conditionCacheMutex_);
+    cache = conditionCache_;
+  }
+
+  SaveConditionCache(ConditionCachePath(), cache);
+}
+
 std::filesystem::path Game::GetLOOTGamePath() const {
   return lootDataPath_ / "games" / u8path(settings_.FolderName());
 }
 
+std::string Game::GetConditionCacheSignature() const {
+  return GetLiblootVersion() + "+" + GetLiblootRevision() + "\n" +
+         settings_.DataPath().u8string();
+}
+
+void Game::ResetEvaluatedConditions() {
+  std::vector<std::string> activePluginNames;
+  for (const auto& pluginName : GetLoadOrder()) {
+    if (IsPluginActive(pluginName)) {
+      activePluginNames.push_back(pluginName);
+    }
+  }
+
+  const auto fingerprint = GetActivePluginsFingerprint(activePluginNames);
+
+  lock_guard<mutex> guard(conditionCacheMutex_);
+  activePluginsFingerprint_ = fingerprint;
+  evaluatedConditions_.clear();
+}
+
+bool Game::EvaluateCondition(const std::string& condition) const {
+  if (condition.empty()) {
+    return true;
+  }
+
+  std::optional<CachedConditionResult> cachedResult;
+  uint64_t activePluginsFingerprint = 0;
+  {
+    lock_guard<mutex> guard(conditionCacheMutex_);
+
+    const auto it = evaluatedConditions_.find(condition);
+    if (it != evaluatedConditions_.end()) {
+      return it->second;
+    }
+
+    const auto cacheIt = conditionCache_.results.find(condition);
+    if (cacheIt != conditionCache_.results.end()) {
+      cachedResult = cacheIt->second;
+    }
+
+    activePluginsFingerprint = activePluginsFingerprint_;
+  }
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  // Fingerprint before evaluating so that a file that changes during
+  // evaluation invalidates the result next time.
+  const auto fingerprint = GetConditionFingerprint(
+      condition, settings_.DataPath(), activePluginsFingerprint);
+
+  bool result = false;
+  if (cachedResult.has_value() && cachedResult->fingerprint == fingerprint) {
+    result = cachedResult->result;
+  } else {
+    result = gameHandle_->GetDatabase().Evaluate(condition);
+  }
+
+  evaluationCosts_.RecordCondition(
+      condition, std::chrono::steady_clock::now() - startTime);
+
+  lock_guard<mutex> guard(conditionCacheMutex_);
+  conditionCache_.results.insert_or_assign(
+      condition, CachedConditionResult{fingerprint, result});
+  evaluatedConditions_.emplace(condition, result);
+
+  return result;
+}
+
+std::optional<PluginMetadata> Game::EvaluateConditions(
+    const std::optional<PluginMetadata>& metadata) const {
+  if (!metadata.has_value()) {
+    return std::nullopt;
+  }
+
+  const auto evaluate = [this](const std::string& condition) {
+    return EvaluateCondition(condition);
+  };
+
+  // This filters the same metadata as libloot does when it evaluates
+  // conditions itself.
+  auto evaluated = metadata.value();
+  evaluated.SetLoadAfterFiles(
+      FilterByCondition(metadata->GetLoadAfterFiles(), evaluate));
+  evaluated.SetRequirements(
+      FilterByCondition(metadata->GetRequirements(), evaluate));
+  evaluated.SetIncompatibilities(
+      FilterByCondition(metadata->GetIncompatibilities(), evaluate));
+  evaluated.SetMessages(FilterByCondition(metadata->GetMessages(), evaluate));
+  evaluated.SetTags(FilterByCondition(metadata->GetTags(), evaluate));
+
+  if (!metadata->IsRegexPlugin()) {
+    evaluated.SetDirtyInfo(FilterByChecksum(
+        metadata->GetName(), metadata->GetDirtyInfo(), evaluate));
+    evaluated.SetCleanInfo(FilterByChecksum(
+        metadata->GetName(), metadata->GetCleanInfo(), evaluate));
+  }
+
+  if (evaluated.HasNameOnly()) {
+    return std::nullopt;
+  }
+
+  return evaluated;
+}
+
 std::vector<std::string> Game::GetInstalledPluginNames() {
   std::vector<std::string> plugins;
 
@@ -921,13 +1257,83 @@ std::vector<std::string> Game::GetInstalledPluginNames() {
 }
 
 void Game::AppendMessages(std::vector<Message> messages) {
-  for (auto message : messages) {
-    AppendMessage(message);
-  }
+  lock_guard<mutex> guard(mutex_);
+
+  messages_.insert(messages_.end(),
+                   std::make_move_iterator(messages.begin()),
+                   std::make_move_iterator(messages.end()));
 }
 
 bool Game::IsCreationClubPlugin(const PluginInterface& plugin) const {
   return creationClubPlugins_.count(Filename(plugin.GetName())) != 0;
 }
+
+EvaluationCostRecorder& Game::GetEvaluationCosts() const {
+  return evaluationCosts_;
+}
+
+std::shared_ptr<const GameStateSnapshot> Game::GetStateSnapshot() const {
+  return std::atomic_load(&stateSnapshot_);
+}
+
+void Game::PublishStateSnapshot() {
+  auto snapshot = BuildStateSnapshot();
+  if (!snapshot) {
+    return;
+  }
+
+  snapshot->messages = GetMessages();
+
+  std::atomic_store(
+      &stateSnapshot_,
+      std::shared_ptr<const GameStateSnapshot>(std::move(snapshot)));
+}
+
+void Game::PublishPluginStateSnapshot() {
+  auto snapshot = BuildStateSnapshot();
+  if (!snapshot) {
+    return;
+  }
+
+  // Getting the general messages would read the metadata database, which may
+  // be being replaced on another thread.
+  snapshot->messages = GetStateSnapshot()->messages;
+
+  std::atomic_store(
+      &stateSnapshot_,
+      std::shared_ptr<const GameStateSnapshot>(std::move(snapshot)));
+}
+
+std::shared_ptr<GameStateSnapshot> Game::BuildStateSnapshot() const {
+  if (!gameHandle_) {
+    return nullptr;
+  }
+
+  auto snapshot = std::make_shared<GameStateSnapshot>();
+
+  snapshot->loadOrder = GetLoadOrder();
+
+  const auto plugins = GetPlugins();
+  for (const auto plugin : plugins) {
+    PluginState pluginState;
+    pluginState.isActive = IsPluginActive(plugin->GetName());
+    pluginState.isMaster = plugin->IsMaster();
+    pluginState.isLightPlugin = plugin->IsLightPlugin();
+
+    snapshot->plugins.emplace(plugin->GetName(), pluginState);
+  }
+
+  try {
+    snapshot->isLoadOrderAmbiguous = IsLoadOrderAmbiguous();
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to check if the load order is ambiguous: {}",
+                    e.what());
+    }
+  }
+
+  return snapshot;
+}
 }
 }
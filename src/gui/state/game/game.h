@@ -26,13 +26,20 @@
 #ifndef LOOT_GUI_STATE_GAME_GAME
 #define LOOT_GUI_STATE_GAME_GAME
 
+#include <chrono>
 #include <filesystem>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "gui/state/game/condition_cache.h"
+#include "gui/state/game/evaluation_costs.h"
 #include "gui/state/game/game_settings.h"
+#include "gui/state/game/game_state_snapshot.h"
 #include "loot/api.h"
 
 namespace loot {
@@ -61,20 +68,37 @@ public:
   std::vector<Message> CheckInstallValidity(const PluginInterface& plugin,
                                             const PluginMetadata& metadata,
                                             const std::string& language) const;
+  // Checks if the plugin's BashTags file overrides any of the Bash Tag
+  // suggestions in its metadata.
+  std::vector<Message> CheckBashTagsFile(const PluginInterface& plugin,
+                                         const PluginMetadata& metadata) const;
 
   void RedatePlugins();  // Change timestamps to match load order (Skyrim only).
 
   void LoadCreationClubPluginNames();
   bool IsCreationClubPlugin(const PluginInterface& plugin) const;
 
-  void LoadAllInstalledPlugins(
-      bool headersOnly);  // Loads all installed plugins.
+  // Loads all installed plugins. The state snapshot that this publishes keeps
+  // the previous snapshot's messages, as it doesn't read the metadata lists.
+  void LoadAllInstalledPlugins(bool headersOnly);
   bool ArePluginsFullyLoaded()
       const;  // Checks if the game's plugins have already been loaded.
 
+  // Reloads only the headers of the loaded plugins, to free the memory used by
+  // their record data. Cached conflicting plugin names are kept.
+  void DiscardFullPluginData();
+
+  std::optional<std::vector<std::string>> GetCachedConflictingPluginNames(
+      const std::string& pluginName) const;
+  void CacheConflictingPluginNames(
+      const std::string& pluginName,
+      const std::vector<std::string>& conflictingPluginNames);
+
   std::filesystem::path MasterlistPath() const;
   std::filesystem::path UserlistPath() const;
   std::filesystem::path GroupNodePositionsPath() const;
+  std::filesystem::path CardSizesPath() const;
+  std::filesystem::path ConditionCachePath() const;
 
   std::vector<std::string> GetLoadOrder() const;
   void SetLoadOrder(const std::vector<std::string>& loadOrder);
@@ -95,6 +119,11 @@ public:
   void ClearMessages();
 
   void LoadMetadata();
+  // Parses the metadata lists without reading the load order or publishing a
+  // state snapshot, so that it's safe to call while
+  // LoadAllInstalledPlugins() runs on another thread. Returns a message
+  // describing any parsing error instead of storing it.
+  std::optional<Message> ParseMetadataLists();
   std::vector<std::string> GetKnownBashTags() const;
 
   std::vector<Group> GetMasterlistGroups() const;
@@ -115,10 +144,40 @@ public:
   void ClearAllUserMetadata();
   void SaveUserMetadata();
 
+  // Evaluated condition results are stored between sessions so that
+  // conditions don't need to be evaluated again while the files they read
+  // are unchanged.
+  void LoadConditionResults();
+  void SaveConditionResults() const;
+
+  // Publishes a snapshot of the game's current state, including its messages.
+  // Call this once plugins have been loaded and the metadata lists have been
+  // parsed if they were parsed on another thread.
+  void PublishStateSnapshot();
+
+  // Returns the most recently published snapshot of the game's state. It's
+  // safe to call this while another thread is changing the game's state.
+  std::shared_ptr<const GameStateSnapshot> GetStateSnapshot() const;
+
+  // Records how long plugins' details and uncached metadata conditions took
+  // to evaluate. The costs are cleared whenever plugins are loaded.
+  EvaluationCostRecorder& GetEvaluationCosts() const;
+
 private:
   std::filesystem::path GetLOOTGamePath() const;
   std::vector<std::string> GetInstalledPluginNames();
+  // Stores the messages without publishing a new state snapshot, as
+  // publishing evaluates the general messages and reads the load order, so
+  // operations should publish once after all their changes have been made.
   void AppendMessages(std::vector<Message> messages);
+  void PublishPluginStateSnapshot();
+  std::shared_ptr<GameStateSnapshot> BuildStateSnapshot() const;
+
+  std::string GetConditionCacheSignature() const;
+  void ResetEvaluatedConditions();
+  bool EvaluateCondition(const std::string& condition) const;
+  std::optional<PluginMetadata> EvaluateConditions(
+      const std::optional<PluginMetadata>& metadata) const;
 
   GameSettings settings_;
   std::unique_ptr<GameInterface> gameHandle_;
@@ -127,10 +186,31 @@ private:
   std::filesystem::path preludePath_;
   unsigned short loadOrderSortCount_{0};
   bool pluginsFullyLoaded_{false};
+  std::chrono::milliseconds fullPluginDataLoadDuration_{0};
+
+  // Conflicts are cached so that they can still be looked up after full plugin
+  // data has been discarded. The cache is cleared whenever plugins are loaded.
+  std::map<std::string, std::vector<std::string>> conflictingPluginNames_;
 
   // Use Filename to benefit from libloot's case-insensitive comparisons.
   std::set<Filename> creationClubPlugins_;
 
+  // Results loaded from and saved to the condition cache file, which are only
+  // reused if the condition's fingerprint hasn't changed.
+  mutable ConditionCache conditionCache_;
+  // Results that have been fingerprinted or evaluated since plugins were last
+  // loaded, so they don't need to be fingerprinted again until then.
+  mutable std::unordered_map<std::string, bool> evaluatedConditions_;
+  uint64_t activePluginsFingerprint_{0};
+  mutable std::mutex conditionCacheMutex_;
+
+  // Not moved with the rest of the game's state, as it's only diagnostic.
+  mutable EvaluationCostRecorder evaluationCosts_;
+
+  // Only accessed using std::atomic_load and std::atomic_store.
+  std::shared_ptr<const GameStateSnapshot> stateSnapshot_{
+      std::make_shared<const GameStateSnapshot>()};
+
   mutable std::mutex mutex_;
 };
 }
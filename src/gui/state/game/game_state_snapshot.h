@@ -0,0 +1,66 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_GAME_STATE_SNAPSHOT
+#define LOOT_GUI_STATE_GAME_GAME_STATE_SNAPSHOT
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "loot/metadata/message.h"
+
+namespace loot {
+namespace gui {
+struct PluginState {
+  bool IsLightPlugin() const;
+
+  bool isActive{false};
+  bool isMaster{false};
+  bool isLightPlugin{false};
+};
+
+// Orders plugin names the same way that the game's own plugin lookups compare
+// them, i.e. case-insensitively.
+struct PluginNameLess {
+  bool operator()(const std::string& lhs, const std::string& rhs) const;
+};
+
+// A copy of game state that is derived from libloot. A new snapshot is
+// published whenever that state changes, and published snapshots are never
+// modified, so they can be read from any thread without locking.
+struct GameStateSnapshot {
+  const PluginState* GetPlugin(const std::string& pluginName) const;
+  bool IsPluginActive(const std::string& pluginName) const;
+
+  std::vector<std::string> loadOrder;
+  std::map<std::string, PluginState, PluginNameLess> plugins;
+  std::vector<Message> messages;
+  bool isLoadOrderAmbiguous{false};
+};
+}
+}
+
+#endif
@@ -184,6 +184,18 @@ public:
     return installedGames;
   }
 
+  // The returned settings have their game paths set.
+  std::vector<GameSettings> GetInstalledGameSettings() const {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    std::vector<GameSettings> gamesSettings;
+    for (const auto& game : installedGames_) {
+      gamesSettings.push_back(game.GetSettings());
+    }
+
+    return gamesSettings;
+  }
+
   std::optional<std::string> GetFirstInstalledGameFolderName() const {
     if (!installedGames_.empty()) {
       return installedGames_.front().GetSettings().FolderName();
@@ -656,6 +656,11 @@ void LootSettings::load(const std::filesystem::path& file) {
   theme_ = settings["theme"].value_or(theme_);
   lastGame_ = settings["lastGame"].value_or(lastGame_);
   lastVersion_ = settings["lastVersion"].value_or(lastVersion_);
+  fullPluginDataIdleTimeout_ = settings["fullPluginDataIdleTimeout"].value_or(
+      fullPluginDataIdleTimeout_);
+  fullPluginDataMemoryBudget_ = settings["fullPluginDataMemoryBudget"].value_or(
+      fullPluginDataMemoryBudget_);
+  sharedCachePath_ = settings["sharedCachePath"].value_or(sharedCachePath_);
 
   const auto preludeSource = settings["preludeSource"].value<std::string>();
   if (preludeSource.has_value()) {
@@ -764,6 +769,9 @@ void LootSettings::save(const std::filesystem::path& file) {
       {"lastGame", lastGame_},
       {"lastVersion", lastVersion_},
       {"preludeSource", preludeSource_},
+      {"fullPluginDataIdleTimeout", fullPluginDataIdleTimeout_},
+      {"fullPluginDataMemoryBudget", fullPluginDataMemoryBudget_},
+      {"sharedCachePath", sharedCachePath_},
       {"filters",
        toml::table{
            {"hideVersionNumbers", filters_.hideVersionNumbers},
@@ -901,6 +909,24 @@ std::string LootSettings::getPreludeSource() const {
   return preludeSource_;
 }
 
+int LootSettings::getFullPluginDataIdleTimeout() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return fullPluginDataIdleTimeout_;
+}
+
+int LootSettings::getFullPluginDataMemoryBudget() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return fullPluginDataMemoryBudget_;
+}
+
+std::string LootSettings::getSharedCachePath() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return sharedCachePath_;
+}
+
 std::optional<LootSettings::WindowPosition>
 LootSettings::getMainWindowPosition() const {
   lock_guard<recursive_mutex> guard(mutex_);
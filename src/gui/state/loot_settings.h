@@ -83,6 +83,16 @@ public:
   std::string getLanguage() const;
   std::string getTheme() const;
   std::string getPreludeSource() const;
+  // The number of seconds that fully-loaded plugin data is kept for after it
+  // was last used. Zero or less means that the data is kept indefinitely.
+  int getFullPluginDataIdleTimeout() const;
+  // The number of MiB of memory that LOOT can use before fully-loaded plugin
+  // data is discarded. Zero or less means there is no limit.
+  int getFullPluginDataMemoryBudget() const;
+  // A directory that downloaded masterlists and preludes are cached in so
+  // that LOOT instances with different data folders can share them. An empty
+  // path means that no shared cache is used.
+  std::string getSharedCachePath() const;
   std::optional<WindowPosition> getMainWindowPosition() const;
   std::optional<WindowPosition> getGroupsEditorWindowPosition() const;
   const std::vector<GameSettings>& getGameSettings() const;
@@ -118,6 +128,9 @@ private:
   std::string language_{"en"};
   std::string preludeSource_{getDefaultPreludeSource()};
   std::string theme_{"default"};
+  int fullPluginDataIdleTimeout_{300};
+  int fullPluginDataMemoryBudget_{0};
+  std::string sharedCachePath_;
   std::optional<WindowPosition> mainWindowPosition_;
   std::optional<WindowPosition> groupsEditorWindowPosition_;
   std::vector<GameSettings> gameSettings_{
@@ -25,6 +25,7 @@
 
 #include "gui/state/loot_state.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 #ifdef _WIN32
@@ -45,6 +46,7 @@
 #include <boost/locale.hpp>
 
 #include "gui/helpers.h"
+#include "gui/query/types/get_game_data_query.h"
 #include "gui/state/game/game_detection.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
@@ -146,27 +148,53 @@ void LootState::init(const std::string& cmdLineGame,
   setInitialGame(cmdLineGame);
 }
 
-void LootState::initCurrentGame() {
+void LootState::startLoadingCurrentGame() {
+  if (hasInitErrors() || startupGameData_.valid()) {
+    return;
+  }
+
+  std::promise<void> initialised;
+  currentGameInitialised_ = initialised.get_future();
+
+  startupGameData_ = std::async(
+      std::launch::async,
+      [this, initialised = std::move(initialised)]() mutable {
+        initialiseCurrentGame();
+        initialised.set_value();
+
+        // The UI doesn't load the game's data if there were any errors
+        // during initialisation, so don't load it here either.
+        if (hasInitErrors()) {
+          return std::vector<PluginItem>();
+        }
+
+        GetGameDataQuery<> query(GetCurrentGame(), [](std::string) {});
+
+        return std::get<PluginItems>(query.executeLogic());
+      });
+
   auto logger = getLogger();
+  if (logger) {
+    logger->debug("Started loading the current game in the background");
+  }
+}
 
-  try {
-    GetCurrentGame().Init();
-    if (logger) {
-      logger->debug("Game named {} has been initialsed",
-                    GetCurrentGame().GetSettings().Name());
-    }
-  } catch (const std::exception& e) {
-    if (logger) {
-      logger->error("Game-specific settings could not be initialised: {}",
-                    e.what());
-    }
-    initMessages_.push_back(PlainTextSimpleMessage(
-        MessageType::error,
-        (format(translate(
-             "Error: Game-specific settings could not be initialised. %1%")) %
-         e.what())
-            .str()));
+void LootState::initCurrentGame() {
+  if (currentGameInitialised_.valid()) {
+    currentGameInitialised_.get();
+    return;
   }
+
+  initialiseCurrentGame();
+}
+
+std::optional<std::future<std::vector<PluginItem>>>
+LootState::takeStartupGameData() {
+  if (!startupGameData_.valid()) {
+    return std::nullopt;
+  }
+
+  return std::move(startupGameData_);
 }
 
 const std::vector<SimpleMessage>& LootState::getInitMessages() const {
@@ -363,6 +391,37 @@ void LootState::setInitialGame(const std::string& preferredGame) {
   }
 }
 
+void LootState::initialiseCurrentGame() {
+  auto logger = getLogger();
+
+  try {
+    GetCurrentGame().Init();
+    if (logger) {
+      logger->debug("Game named {} has been initialsed",
+                    GetCurrentGame().GetSettings().Name());
+    }
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Game-specific settings could not be initialised: {}",
+                    e.what());
+    }
+    initMessages_.push_back(PlainTextSimpleMessage(
+        MessageType::error,
+        (format(translate(
+             "Error: Game-specific settings could not be initialised. %1%")) %
+         e.what())
+            .str()));
+  }
+}
+
+bool LootState::hasInitErrors() const {
+  return std::any_of(initMessages_.begin(),
+                     initMessages_.end(),
+                     [](const SimpleMessage& message) {
+                       return message.type == MessageType::error;
+                     });
+}
+
 std::optional<GamePaths> LootState::FindGamePaths(
     const GameSettings& gameSettings) const {
   return loot::FindGamePaths(gameSettings, xboxGamingRootPaths_);
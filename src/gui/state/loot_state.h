@@ -26,6 +26,9 @@
 #ifndef LOOT_GUI_STATE_LOOT_STATE
 #define LOOT_GUI_STATE_LOOT_STATE
 
+#include <future>
+
+#include "gui/plugin_item.h"
 #include "gui/state/game/games_manager.h"
 #include "gui/state/loot_settings.h"
 #include "gui/state/unapplied_change_counter.h"
@@ -41,7 +44,16 @@ public:
   void init(const std::string& cmdLineGame,
             const std::filesystem::path& cmdLineGamePath,
             bool autoSort);
+  // Initialises the current game and loads its plugins and metadata on a
+  // worker thread, so that the work overlaps with constructing the UI. Does
+  // nothing if init() recorded an error.
+  void startLoadingCurrentGame();
+  // Waits for the current game to finish initialising if it's being loaded
+  // in the background, otherwise initialises it now.
   void initCurrentGame();
+  // Returns the game data loaded in the background, if there is any that
+  // hasn't already been taken.
+  std::optional<std::future<std::vector<PluginItem>>> takeStartupGameData();
 
   const std::vector<SimpleMessage>& getInitMessages() const;
 
@@ -57,6 +69,8 @@ private:
   void overrideGamePath(const std::string& gameFolderName,
                         const std::filesystem::path& gamePath);
   void setInitialGame(const std::string& preferredGame);
+  void initialiseCurrentGame();
+  bool hasInitErrors() const;
 
   std::optional<GamePaths> FindGamePaths(
       const GameSettings& gameSettings) const override;
@@ -70,6 +84,12 @@ private:
 
   // Mutex used to protect access to member variables.
   std::mutex mutex_;
+
+  // These must stay declared last: members are destroyed in reverse order, so
+  // the std::async future's destructor waits for the worker thread to finish
+  // before anything it uses is destroyed.
+  std::future<void> currentGameInitialised_;
+  std::future<std::vector<PluginItem>> startupGameData_;
 };
 }
 
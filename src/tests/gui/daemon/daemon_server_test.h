@@ -0,0 +1,252 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_DAEMON_DAEMON_SERVER_TEST
+#define LOOT_TESTS_GUI_DAEMON_DAEMON_SERVER_TEST
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtNetwork/QLocalSocket>
+#include <chrono>
+#include <future>
+
+#include "gui/daemon/daemon_server.h"
+#include "tests/common_game_test_fixture.h"
+
+namespace loot {
+namespace test {
+struct DaemonResponse {
+  QJsonObject object;
+};
+
+class DaemonServerTest : public CommonGameTestFixture {
+protected:
+  DaemonServerTest() :
+      socketName_(QString::fromStdString(
+          "loot-daemon-test-" + boost::lexical_cast<std::string>(
+                                    boost::uuids::random_generator()()))),
+      handler_({GameSettings(GetParam(), gameFolder_.toStdString())
+                    .SetMinimumHeaderVersion(0.0f)
+                    .SetGamePath(dataPath.parent_path())
+                    .SetGameLocalPath(localPath)},
+               lootDataPath,
+               "",
+               "en"),
+      server_(handler_) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(server_.listen(socketName_))
+        << server_.errorString().toStdString();
+  }
+
+  static QByteArray createDaemonRequest(const QString& command,
+                                        const QString& game) {
+    const auto request = QJsonObject{{"command", command}, {"game", game}};
+
+    return QJsonDocument(request).toJson(QJsonDocument::Compact);
+  }
+
+  // The requests are sent from another thread, because the server needs
+  // this thread's events to be processed for it to respond.
+  std::vector<DaemonResponse> sendDaemonRequests(
+      const std::vector<QByteArray>& requests) {
+    auto responses = std::async(std::launch::async, [&]() {
+      QLocalSocket socket;
+      socket.connectToServer(socketName_);
+      if (!socket.waitForConnected(TIMEOUT_MS)) {
+        throw std::runtime_error("Failed to connect to the daemon");
+      }
+
+      std::vector<DaemonResponse> responses;
+      for (const auto& request : requests) {
+        socket.write(request + '\n');
+        socket.flush();
+
+        while (!socket.canReadLine()) {
+          if (!socket.waitForReadyRead(TIMEOUT_MS)) {
+            throw std::runtime_error("Timed out waiting for a response");
+          }
+        }
+
+        const auto response = QJsonDocument::fromJson(socket.readLine());
+
+        responses.push_back({response.object()});
+      }
+
+      return responses;
+    });
+
+    while (responses.wait_for(std::chrono::milliseconds(1)) !=
+           std::future_status::ready) {
+      QCoreApplication::processEvents();
+    }
+
+    return responses.get();
+  }
+
+  static std::vector<std::string> getDaemonPlugins(
+      const DaemonResponse& response) {
+    std::vector<std::string> plugins;
+    for (const auto& plugin : response.object.value("plugins").toArray()) {
+      plugins.push_back(plugin.toString().toStdString());
+    }
+
+    return plugins;
+  }
+
+  static constexpr int TIMEOUT_MS = 30000;
+
+  const QString gameFolder_{"daemonGame"};
+  const QString socketName_;
+
+private:
+  DaemonRequestHandler handler_;
+  DaemonServer server_;
+};
+
+// Pass an empty first argument, as it's a prefix for the test instantation,
+// but we only have the one so no prefix is necessary.
+INSTANTIATE_TEST_SUITE_P(,
+                         DaemonServerTest,
+                         ::testing::Values(GameType::tes4,
+                                           GameType::tes5,
+                                           GameType::fo4));
+
+TEST_P(DaemonServerTest, secondSortRequestShouldReuseTheFirstSortsResult) {
+  const auto request = createDaemonRequest("sort", gameFolder_);
+
+  const auto responses = sendDaemonRequests({request, request});
+
+  ASSERT_EQ(2, responses.size());
+  ASSERT_FALSE(responses[0].object.contains("error"));
+  ASSERT_FALSE(responses[1].object.contains("error"));
+
+  const auto plugins = getDaemonPlugins(responses[0]);
+  EXPECT_FALSE(plugins.empty());
+  EXPECT_EQ(plugins, getDaemonPlugins(responses[1]));
+
+  // The first request loads the game and sorts its plugins, but the second
+  // only needs to check that the game's files haven't changed.
+  EXPECT_FALSE(responses[0].object.value("cached").toBool(true));
+  EXPECT_TRUE(responses[1].object.value("cached").toBool(false));
+}
+
+TEST_P(DaemonServerTest, sortRequestShouldSortAgainIfAPluginIsRemoved) {
+  const auto request = createDaemonRequest("sort", gameFolder_);
+
+  auto responses = sendDaemonRequests({request});
+
+  ASSERT_FALSE(responses[0].object.contains("error"));
+  auto plugins = getDaemonPlugins(responses[0]);
+  ASSERT_NE(plugins.end(),
+            std::find(plugins.begin(),
+                      plugins.end(),
+                      blankDifferentPluginDependentEsp));
+
+  std::filesystem::remove(dataPath / blankDifferentPluginDependentEsp);
+
+  responses = sendDaemonRequests({request});
+
+  ASSERT_FALSE(responses[0].object.contains("error"));
+  EXPECT_FALSE(responses[0].object.value("cached").toBool(true));
+  plugins = getDaemonPlugins(responses[0]);
+  EXPECT_EQ(plugins.end(),
+            std::find(plugins.begin(),
+                      plugins.end(),
+                      blankDifferentPluginDependentEsp));
+}
+
+TEST_P(DaemonServerTest, getLoadOrderRequestShouldReturnTheCurrentLoadOrder) {
+  const auto responses =
+      sendDaemonRequests({createDaemonRequest("getLoadOrder", gameFolder_)});
+
+  ASSERT_FALSE(responses[0].object.contains("error"));
+
+  const auto plugins = getDaemonPlugins(responses[0]);
+  ASSERT_FALSE(plugins.empty());
+  EXPECT_EQ(masterFile, plugins[0]);
+}
+
+TEST_P(DaemonServerTest, getMessagesRequestShouldReturnAPluginsMessages) {
+  auto request = QJsonObject{{"command", "getMessages"},
+                             {"game", gameFolder_},
+                             {"plugin", QString::fromStdString(blankEsp)}};
+
+  const auto responses = sendDaemonRequests(
+      {QJsonDocument(request).toJson(QJsonDocument::Compact)});
+
+  EXPECT_FALSE(responses[0].object.contains("error"));
+  EXPECT_TRUE(responses[0].object.value("messages").isArray());
+}
+
+TEST_P(DaemonServerTest,
+       getMessagesRequestShouldReturnAnErrorIfThePluginIsNotInstalled) {
+  auto request = QJsonObject{{"command", "getMessages"},
+                             {"game", gameFolder_},
+                             {"plugin", QString::fromStdString(missingEsp)}};
+
+  const auto responses = sendDaemonRequests(
+      {QJsonDocument(request).toJson(QJsonDocument::Compact)});
+
+  EXPECT_TRUE(responses[0].object.value("error").isString());
+}
+
+TEST_P(DaemonServerTest, refreshRequestShouldSucceed) {
+  const auto refreshRequest = createDaemonRequest("refresh", gameFolder_);
+
+  const auto responses = sendDaemonRequests({refreshRequest, refreshRequest});
+
+  EXPECT_FALSE(responses[0].object.contains("error"));
+  EXPECT_FALSE(responses[1].object.contains("error"));
+}
+
+TEST_P(DaemonServerTest, requestShouldReturnAnErrorIfTheGameIsNotInstalled) {
+  auto request = QJsonObject{{"id", 5}, {"command", "sort"}, {"game", "foo"}};
+
+  const auto responses = sendDaemonRequests(
+      {QJsonDocument(request).toJson(QJsonDocument::Compact)});
+
+  EXPECT_TRUE(responses[0].object.value("error").isString());
+  EXPECT_EQ(5, responses[0].object.value("id").toInt());
+}
+
+TEST_P(DaemonServerTest, requestShouldReturnAnErrorIfTheCommandIsUnrecognised) {
+  const auto responses =
+      sendDaemonRequests({createDaemonRequest("foo", gameFolder_)});
+
+  EXPECT_TRUE(responses[0].object.value("error").isString());
+}
+
+TEST_P(DaemonServerTest, requestShouldReturnAnErrorIfItIsNotJson) {
+  const auto responses = sendDaemonRequests({"not json"});
+
+  EXPECT_TRUE(responses[0].object.value("error").isString());
+}
+}
+}
+
+#endif
@@ -34,13 +34,29 @@
 #include <spdlog/spdlog.h>
 #endif
 
-#include <QtCore/QCoreApplication>
+#include <QtWidgets/QApplication>
 #include <boost/locale.hpp>
 
 #include "tests/gui/backup_test.h"
+#include "tests/gui/daemon/daemon_server_test.h"
 #include "tests/gui/helpers_test.h"
+#include "tests/gui/qt/groups_editor/group_graph_diff_test.h"
+#include "tests/gui/qt/groups_editor/group_graph_order_test.h"
+#include "tests/gui/qt/groups_editor/group_graph_reduction_test.h"
+#include "tests/gui/qt/completion_index_test.h"
+#include "tests/gui/qt/group_plugins_index_test.h"
 #include "tests/gui/qt/helpers_test.h"
+#include "tests/gui/qt/plugin_editor/column_width_cache_test.h"
+#include "tests/gui/qt/plugin_item_display_strings_test.h"
+#include "tests/gui/qt/report_writer_test.h"
+#include "tests/gui/qt/session_snapshot_test.h"
+#include "tests/gui/qt/shared_file_cache_test.h"
 #include "tests/gui/qt/tasks/tasks_test.h"
+#include "tests/gui/query/game_queries_test.h"
+#include "tests/gui/query/get_game_data_query_test.h"
+#include "tests/gui/state/game/card_sizes_test.h"
+#include "tests/gui/state/game/condition_cache_test.h"
+#include "tests/gui/state/game/evaluation_costs_test.h"
 #include "tests/gui/state/game/game_detection_test.h"
 #include "tests/gui/state/game/game_settings_test.h"
 #include "tests/gui/state/game/game_test.h"
@@ -49,6 +65,7 @@
 #include "tests/gui/state/game/helpers_test.h"
 #include "tests/gui/state/loot_paths_test.h"
 #include "tests/gui/state/loot_settings_test.h"
+#include "tests/gui/state/loot_state_test.h"
 #include "tests/gui/state/unapplied_change_counter_test.h"
 
 int main(int argc, char **argv) {
@@ -61,8 +78,15 @@ int main(int argc, char **argv) {
   // Register a few meta types for when running with Qt 5.
   qRegisterMetaType<loot::QueryResult>("QueryResult");
   qRegisterMetaType<std::string>("std::string");
+  qRegisterMetaType<loot::QueryTiming>("QueryTiming");
 
-  QCoreApplication app(argc, argv);
+  // Some tests use widgets, so default to a platform that doesn't need a
+  // display.
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
 
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,208 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_COMPLETION_INDEX_TEST
+#define LOOT_TESTS_GUI_QT_COMPLETION_INDEX_TEST
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+#include "gui/qt/completion_index.h"
+
+namespace loot {
+namespace test {
+class CompletionIndexTest : public ::testing::Test {
+protected:
+  static constexpr size_t NAME_COUNT = 50000;
+  static constexpr size_t MAX_RESULTS = 20;
+
+  CompletionIndexTest() {
+    const std::vector<std::string> words{
+        "Unofficial", "Skyrim",   "Patch",     "Dragonborn", "Dawnguard",
+        "Hearthfire", "Immersive", "Armors",   "Weapons",    "Lighting",
+        "Overhaul",   "Realistic", "Water",    "Textures",   "Enhanced",
+        "Landscapes", "Alternate", "Start",    "Frostfall",  "Campfire",
+        "Ordinator",  "Perks",     "Apocalypse", "Spells",   "Wildcat",
+        "Combat",     "Cutting",   "Room",     "Floor",      "Relationship",
+        "Dialogue",   "Expansion"};
+
+    // Keep a few well-known names among the synthetic ones.
+    names = {"SkyUI_SE.esp",
+             "Unofficial Skyrim Special Edition Patch.esp",
+             "Frostfall.esp"};
+
+    for (size_t i = names.size(); i < NAME_COUNT; i += 1) {
+      const auto& first = words[i % words.size()];
+      const auto& second = words[(i / words.size()) % words.size()];
+      names.push_back(first + " " + second + " " + std::to_string(i) +
+                      (i % 2 == 0 ? ".esp" : ".esm"));
+    }
+  }
+
+  std::vector<std::string> findNames(const CompletionIndex& index,
+                                     const std::string& text) {
+    std::vector<std::string> results;
+    for (const auto nameIndex : index.find(text, MAX_RESULTS)) {
+      results.push_back(index.getName(nameIndex));
+    }
+    return results;
+  }
+
+  std::vector<std::string> names;
+};
+
+TEST_F(CompletionIndexTest, findShouldReturnNothingIfDefaultConstructed) {
+  const CompletionIndex index;
+
+  EXPECT_EQ(0, index.size());
+  EXPECT_TRUE(index.find("skyui", MAX_RESULTS).empty());
+}
+
+TEST_F(CompletionIndexTest, findShouldReturnNothingForEmptyText) {
+  const CompletionIndex index(names);
+
+  EXPECT_TRUE(index.find("", MAX_RESULTS).empty());
+}
+
+TEST_F(CompletionIndexTest, findShouldReturnNoMoreThanTheMaximumResults) {
+  const CompletionIndex index(names);
+
+  EXPECT_EQ(MAX_RESULTS, index.find("skyrim", MAX_RESULTS).size());
+  EXPECT_EQ(3, index.find("skyrim", 3).size());
+  EXPECT_TRUE(index.find("skyrim", 0).empty());
+}
+
+TEST_F(CompletionIndexTest, findShouldMatchCaseInsensitively) {
+  const CompletionIndex index(names);
+
+  EXPECT_EQ("SkyUI_SE.esp", findNames(index, "SKYUI").at(0));
+  EXPECT_EQ("SkyUI_SE.esp", findNames(index, "skyui").at(0));
+}
+
+TEST_F(CompletionIndexTest, findShouldRankPrefixMatchesAboveSubstringMatches) {
+  const CompletionIndex index({"Armors Frostfall.esp", "Frostfall.esp"});
+
+  const auto results = findNames(index, "frostfall");
+
+  ASSERT_EQ(2, results.size());
+  EXPECT_EQ("Frostfall.esp", results[0]);
+  EXPECT_EQ("Armors Frostfall.esp", results[1]);
+}
+
+TEST_F(CompletionIndexTest,
+       findShouldRankEquallyGoodMatchesInTheOrderTheyWereIndexed) {
+  const std::vector<std::string> sameNames{
+      "FROSTFALL.esp", "Frostfall.esp", "frostfall.esp"};
+  const CompletionIndex index(sameNames);
+
+  EXPECT_EQ(sameNames, findNames(index, "frostfall"));
+}
+
+TEST_F(CompletionIndexTest, findShouldMatchTextInTheMiddleOfNames) {
+  const CompletionIndex index(names);
+
+  const auto results = findNames(index, "special edition");
+
+  ASSERT_FALSE(results.empty());
+  EXPECT_EQ("Unofficial Skyrim Special Edition Patch.esp", results[0]);
+}
+
+TEST_F(CompletionIndexTest, findShouldMatchTextWithTypos) {
+  const CompletionIndex index(names);
+
+  EXPECT_EQ("SkyUI_SE.esp", findNames(index, "skiui").at(0));
+  EXPECT_EQ("Unofficial Skyrim Special Edition Patch.esp",
+            findNames(index, "unoficial skyrim special").at(0));
+}
+
+TEST_F(CompletionIndexTest, findShouldNotMatchNamesThatShareTooFewTrigrams) {
+  const CompletionIndex index({"Frostfall.esp", "Campfire.esp"});
+
+  EXPECT_EQ(std::vector<std::string>{"Frostfall.esp"},
+            findNames(index, "frostfal.esp"));
+}
+
+TEST_F(CompletionIndexTest, findShouldOnlyMatchPrefixesOfTextShorterThan3) {
+  const CompletionIndex index({"Armors.esp", "Landscapes.esp", "arcane.esp"});
+
+  const auto results = findNames(index, "ar");
+
+  EXPECT_EQ(std::vector<std::string>({"arcane.esp", "Armors.esp"}), results);
+}
+
+TEST_F(CompletionIndexTest, findShouldTakeLessThanAMillisecondFor50kNames) {
+  static constexpr size_t ITERATIONS = 20;
+  const std::vector<std::string> queries{
+      "sky", "skyui", "unoficial skyrim", "dawnguard 123", "frostfal"};
+
+  const CompletionIndex index(names);
+
+  using std::chrono::steady_clock;
+
+  size_t resultsCount = 0;
+  const auto indexStart = steady_clock::now();
+  for (size_t i = 0; i < ITERATIONS; i += 1) {
+    for (const auto& query : queries) {
+      resultsCount += index.find(query, MAX_RESULTS).size();
+    }
+  }
+  const auto indexDuration = steady_clock::now() - indexStart;
+
+  // Compare against the case-insensitive substring scan of every name that
+  // QCompleter performs for each keystroke.
+  const auto toLower = [](std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) {
+      return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    return text;
+  };
+  const auto scanStart = steady_clock::now();
+  for (size_t i = 0; i < ITERATIONS; i += 1) {
+    for (const auto& query : queries) {
+      const auto lowercaseQuery = toLower(query);
+      for (const auto& name : names) {
+        if (toLower(name).find(lowercaseQuery) != std::string::npos) {
+          resultsCount += 1;
+        }
+      }
+    }
+  }
+  const auto scanDuration = steady_clock::now() - scanStart;
+
+  const auto averageDuration = indexDuration / (ITERATIONS * queries.size());
+
+  EXPECT_LT(0, resultsCount);
+  EXPECT_LT(indexDuration, scanDuration);
+#ifdef NDEBUG
+  EXPECT_LT(averageDuration, std::chrono::milliseconds(1));
+#endif
+}
+}
+}
+
+#endif
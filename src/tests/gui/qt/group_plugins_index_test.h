@@ -0,0 +1,142 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUP_PLUGINS_INDEX_TEST
+#define LOOT_TESTS_GUI_QT_GROUP_PLUGINS_INDEX_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/group_plugins_index.h"
+
+namespace loot {
+namespace test {
+class GroupPluginsIndexTest : public ::testing::Test {
+protected:
+  static constexpr size_t PLUGIN_COUNT = 10000;
+  static constexpr size_t GROUP_COUNT = 1000;
+
+  GroupPluginsIndexTest() {
+    for (size_t i = 0; i < PLUGIN_COUNT; i += 1) {
+      PluginItem item;
+      item.name = "plugin" + std::to_string(i) + ".esp";
+      item.group = getIndexedGroup(i % GROUP_COUNT);
+      items.push_back(item);
+    }
+  }
+
+  static std::string getIndexedGroup(size_t index) {
+    return "group" + std::to_string(index);
+  }
+
+  std::vector<PluginItem> items;
+};
+
+TEST_F(GroupPluginsIndexTest, shouldHaveNoPluginsIfDefaultConstructed) {
+  const GroupPluginsIndex index;
+
+  EXPECT_TRUE(index.getPluginIndexes(Group::DEFAULT_NAME).empty());
+  EXPECT_EQ(0, index.countPlugins(Group::DEFAULT_NAME));
+}
+
+TEST_F(GroupPluginsIndexTest, shouldPutPluginsWithNoGroupInTheDefaultGroup) {
+  items.at(5).group = std::nullopt;
+  items.at(7).group = Group::DEFAULT_NAME;
+
+  const GroupPluginsIndex index(items);
+
+  EXPECT_EQ(std::vector<size_t>({5, 7}),
+            index.getPluginIndexes(Group::DEFAULT_NAME));
+}
+
+TEST_F(GroupPluginsIndexTest, shouldIndexEveryPluginInAscendingOrder) {
+  const GroupPluginsIndex index(items);
+
+  size_t total = 0;
+  for (size_t i = 0; i < GROUP_COUNT; i += 1) {
+    const auto& indexes = index.getPluginIndexes(getIndexedGroup(i));
+
+    ASSERT_EQ(PLUGIN_COUNT / GROUP_COUNT, indexes.size());
+    EXPECT_EQ(PLUGIN_COUNT / GROUP_COUNT,
+              index.countPlugins(getIndexedGroup(i)));
+    EXPECT_TRUE(std::is_sorted(indexes.begin(), indexes.end()));
+
+    for (const auto pluginIndex : indexes) {
+      EXPECT_EQ(getIndexedGroup(i), items.at(pluginIndex).group.value());
+    }
+
+    total += indexes.size();
+  }
+
+  EXPECT_EQ(PLUGIN_COUNT, total);
+}
+
+TEST_F(GroupPluginsIndexTest, shouldReturnNoIndexesForAGroupWithNoPlugins) {
+  const GroupPluginsIndex index(items);
+
+  EXPECT_TRUE(index.getPluginIndexes("missing").empty());
+  EXPECT_EQ(0, index.countPlugins("missing"));
+}
+
+TEST_F(GroupPluginsIndexTest, updateShouldMoveAPluginToItsNewGroup) {
+  GroupPluginsIndex index(items);
+
+  // Plugin 5005 is in group5, and group6 has plugins 6, 1006, ..., 9006.
+  items.at(5005).group = getIndexedGroup(6);
+  index.update(5005, items.at(5005));
+
+  EXPECT_EQ(9, index.countPlugins(getIndexedGroup(5)));
+
+  const auto& indexes = index.getPluginIndexes(getIndexedGroup(6));
+  ASSERT_EQ(11, indexes.size());
+  EXPECT_EQ(5005, indexes.at(5));
+  EXPECT_TRUE(std::is_sorted(indexes.begin(), indexes.end()));
+}
+
+TEST_F(GroupPluginsIndexTest, updateShouldDoNothingIfTheGroupIsUnchanged) {
+  GroupPluginsIndex index(items);
+
+  items.at(42).version = "1.0";
+  index.update(42, items.at(42));
+
+  const auto& indexes = index.getPluginIndexes(getIndexedGroup(42));
+  ASSERT_EQ(10, indexes.size());
+  EXPECT_EQ(42, indexes.at(0));
+}
+
+TEST_F(GroupPluginsIndexTest, updateShouldRemoveAGroupWhenItsLastPluginLeaves) {
+  GroupPluginsIndex index(items);
+
+  for (size_t i = 3; i < PLUGIN_COUNT; i += GROUP_COUNT) {
+    items.at(i).group = std::nullopt;
+    index.update(i, items.at(i));
+  }
+
+  EXPECT_TRUE(index.getPluginIndexes(getIndexedGroup(3)).empty());
+  EXPECT_EQ(10, index.countPlugins(Group::DEFAULT_NAME));
+}
+}
+}
+
+#endif
@@ -0,0 +1,279 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_DIFF_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_DIFF_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtWidgets/QGraphicsScene>
+#include <set>
+
+#include "gui/qt/groups_editor/edge.h"
+#include "gui/qt/groups_editor/graph_view.h"
+#include "gui/qt/groups_editor/group_graph_diff.h"
+#include "gui/qt/groups_editor/node.h"
+
+namespace loot {
+namespace test {
+static constexpr size_t LARGE_GROUP_GRAPH_SIZE = 2000;
+
+std::string getGroupName(size_t index) {
+  return "group" + std::to_string(index);
+}
+
+// Each group loads after the previous group, and after the group at half its
+// index, so that the graph has a realistic mix of long and short edges.
+std::vector<Group> getGroupGraphGroups(size_t count) {
+  std::vector<Group> groups{Group(getGroupName(0))};
+  for (size_t i = 1; i < count; i += 1) {
+    std::vector<std::string> afterGroups{getGroupName(i - 1)};
+    if (i / 2 != i - 1) {
+      afterGroups.push_back(getGroupName(i / 2));
+    }
+
+    groups.push_back(Group(getGroupName(i), afterGroups));
+  }
+
+  return groups;
+}
+
+std::vector<Group> getLargeGroupGraphGroups() {
+  return getGroupGraphGroups(LARGE_GROUP_GRAPH_SIZE);
+}
+
+GroupPluginsIndex getGroupPluginsIndex(
+    const std::vector<std::string>& pluginGroups) {
+  std::vector<PluginItem> items;
+  for (const auto& group : pluginGroups) {
+    PluginItem item;
+    item.name = "plugin" + std::to_string(items.size()) + ".esp";
+    item.group = group;
+    items.push_back(item);
+  }
+
+  return GroupPluginsIndex(items);
+}
+
+std::set<QGraphicsItem*> getGraphItems(const GraphView& view) {
+  std::set<QGraphicsItem*> items;
+  for (const auto item : view.scene()->items()) {
+    if (item->type() == Node::Type || item->type() == Edge::Type) {
+      items.insert(item);
+    }
+  }
+
+  return items;
+}
+
+TEST(BuildGroupGraph, shouldKeepAGroupInBothMasterlistAndUserMetadataAsMaster) {
+  const auto graph = buildGroupGraph(
+      {Group("a")}, {Group("a", {"default"})}, GroupPluginsIndex());
+
+  EXPECT_FALSE(graph.nodes.at("a").isUserMetadata);
+  ASSERT_EQ(1, graph.edges.size());
+  EXPECT_TRUE(graph.edges.begin()->isUserMetadata);
+}
+
+TEST(BuildGroupGraph, shouldAddGroupsOnlyNamedInLoadAfterMetadataAsUserNodes) {
+  const auto graph = buildGroupGraph(
+      {Group("a", {"b"})}, {}, getGroupPluginsIndex({"b", "b"}));
+
+  ASSERT_EQ(2, graph.nodes.size());
+  EXPECT_FALSE(graph.nodes.at("a").isUserMetadata);
+  EXPECT_EQ(0, graph.nodes.at("a").installedPluginCount);
+  EXPECT_TRUE(graph.nodes.at("b").isUserMetadata);
+  EXPECT_EQ(2, graph.nodes.at("b").installedPluginCount);
+
+  ASSERT_EQ(1, graph.edges.size());
+  EXPECT_EQ("b", graph.edges.begin()->fromName);
+  EXPECT_EQ("a", graph.edges.begin()->toName);
+  EXPECT_FALSE(graph.edges.begin()->isUserMetadata);
+}
+
+TEST(DiffGroupGraphs, shouldAddEverythingWhenTheCurrentGraphIsEmpty) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto graph = buildGroupGraph(groups, {}, {});
+
+  const auto diff = diffGroupGraphs(GroupGraph(), graph);
+
+  EXPECT_EQ(LARGE_GROUP_GRAPH_SIZE, diff.addedNodes.size());
+  EXPECT_EQ(graph.edges.size(), diff.addedEdges.size());
+  EXPECT_TRUE(diff.removedNodes.empty());
+  EXPECT_TRUE(diff.removedEdges.empty());
+}
+
+TEST(DiffGroupGraphs, shouldAllocateNothingIfALargeGraphIsUnchanged) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto graph = buildGroupGraph(groups, {}, {});
+
+  const auto diff = diffGroupGraphs(graph, buildGroupGraph(groups, {}, {}));
+
+  EXPECT_TRUE(diff.empty());
+}
+
+TEST(DiffGroupGraphs, shouldAllocateOnlyANewGroupAndItsEdgeInALargeGraph) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto current = buildGroupGraph(groups, {}, {});
+
+  const auto target = buildGroupGraph(
+      groups, {Group("new group", {getGroupName(1000)})}, {});
+  const auto diff = diffGroupGraphs(current, target);
+
+  ASSERT_EQ(1, diff.addedNodes.size());
+  EXPECT_EQ("new group", diff.addedNodes[0].first);
+  EXPECT_TRUE(diff.addedNodes[0].second.isUserMetadata);
+  ASSERT_EQ(1, diff.addedEdges.size());
+  EXPECT_EQ(getGroupName(1000), diff.addedEdges[0].fromName);
+  EXPECT_TRUE(diff.removedNodes.empty());
+  EXPECT_TRUE(diff.removedEdges.empty());
+}
+
+TEST(DiffGroupGraphs, shouldAllocateOnlyAnAddedLoadAfterEdgeInALargeGraph) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto current = buildGroupGraph(groups, {}, {});
+
+  const auto target = buildGroupGraph(
+      groups, {Group(getGroupName(1500), {getGroupName(10)})}, {});
+  const auto diff = diffGroupGraphs(current, target);
+
+  // The group is already a masterlist node, so only the edge is new.
+  EXPECT_TRUE(diff.addedNodes.empty());
+  ASSERT_EQ(1, diff.addedEdges.size());
+  EXPECT_EQ(getGroupName(10), diff.addedEdges[0].fromName);
+  EXPECT_EQ(getGroupName(1500), diff.addedEdges[0].toName);
+  EXPECT_TRUE(diff.addedEdges[0].isUserMetadata);
+  EXPECT_TRUE(diff.removedNodes.empty());
+  EXPECT_TRUE(diff.removedEdges.empty());
+}
+
+TEST(DiffGroupGraphs, shouldOnlyRemoveARemovedGroupAndItsEdgesInALargeGraph) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto current = buildGroupGraph(
+      groups, {Group("new group", {getGroupName(1000)})}, {});
+
+  const auto diff = diffGroupGraphs(current, buildGroupGraph(groups, {}, {}));
+
+  EXPECT_TRUE(diff.addedNodes.empty());
+  EXPECT_TRUE(diff.addedEdges.empty());
+  EXPECT_EQ(std::vector<std::string>{"new group"}, diff.removedNodes);
+  ASSERT_EQ(1, diff.removedEdges.size());
+  EXPECT_EQ("new group", diff.removedEdges[0].toName);
+}
+
+TEST(DiffGroupGraphs, shouldReplaceANodeWithChangedPropertiesAndItsEdges) {
+  const auto groups = getLargeGroupGraphGroups();
+  const auto current = buildGroupGraph(groups, {}, {});
+
+  const auto target =
+      buildGroupGraph(groups, {}, getGroupPluginsIndex({getGroupName(1000)}));
+  const auto diff = diffGroupGraphs(current, target);
+
+  // group1000 loads after group999 and group500, and group1001 loads after
+  // group1000.
+  size_t edgeCount = 0;
+  for (const auto& edge : current.edges) {
+    if (edge.fromName == getGroupName(1000) ||
+        edge.toName == getGroupName(1000)) {
+      edgeCount += 1;
+    }
+  }
+
+  EXPECT_EQ(3, edgeCount);
+  EXPECT_EQ(std::vector<std::string>{getGroupName(1000)}, diff.removedNodes);
+  ASSERT_EQ(1, diff.addedNodes.size());
+  EXPECT_EQ(1, diff.addedNodes[0].second.installedPluginCount);
+  EXPECT_EQ(edgeCount, diff.removedEdges.size());
+  EXPECT_EQ(edgeCount, diff.addedEdges.size());
+}
+
+TEST(DiffGroupGraphs, shouldListAddedMasterlistEdgesBeforeUserEdges) {
+  const auto target = buildGroupGraph(
+      {Group("b", {"c"})}, {Group("a", {"b"}), Group("c", {"a"})}, {});
+
+  const auto diff = diffGroupGraphs(GroupGraph(), target);
+
+  ASSERT_EQ(3, diff.addedEdges.size());
+  EXPECT_FALSE(diff.addedEdges[0].isUserMetadata);
+  EXPECT_TRUE(diff.addedEdges[1].isUserMetadata);
+  EXPECT_TRUE(diff.addedEdges[2].isUserMetadata);
+}
+
+// Enough groups to have a mix of edge lengths, without making the initial
+// layout slow.
+static constexpr size_t GRAPH_VIEW_GROUP_COUNT = 100;
+
+TEST(GraphView, applyGroupsShouldKeepAllItemsIfTheGroupsAreUnchanged) {
+  const auto groups = getGroupGraphGroups(GRAPH_VIEW_GROUP_COUNT);
+  GraphView view;
+
+  view.applyGroups(groups, {}, GroupPluginsIndex(), {});
+  const auto items = getGraphItems(view);
+
+  view.applyGroups(groups, {}, GroupPluginsIndex(), {});
+
+  EXPECT_EQ(items, getGraphItems(view));
+}
+
+TEST(GraphView, applyGroupsShouldOnlyAddTheItemsForANewGroup) {
+  const auto groups = getGroupGraphGroups(GRAPH_VIEW_GROUP_COUNT);
+  const auto userGroups = std::vector<Group>{
+      Group("new group", {getGroupName(GRAPH_VIEW_GROUP_COUNT / 2)})};
+  GraphView view;
+
+  view.applyGroups(groups, {}, GroupPluginsIndex(), {});
+  const auto items = getGraphItems(view);
+
+  view.applyGroups(groups, userGroups, GroupPluginsIndex(), {});
+  const auto newItems = getGraphItems(view);
+
+  // The new group's node and its edge are the only new items.
+  ASSERT_EQ(items.size() + 2, newItems.size());
+  for (const auto item : items) {
+    EXPECT_EQ(1, newItems.count(item));
+  }
+}
+
+TEST(GraphView, applyGroupsShouldOnlyRemoveTheItemsForARemovedGroup) {
+  const auto groups = getGroupGraphGroups(GRAPH_VIEW_GROUP_COUNT);
+  const auto userGroups = std::vector<Group>{
+      Group("new group", {getGroupName(GRAPH_VIEW_GROUP_COUNT / 2)})};
+  GraphView view;
+
+  view.applyGroups(groups, userGroups, GroupPluginsIndex(), {});
+  const auto items = getGraphItems(view);
+
+  view.applyGroups(groups, {}, GroupPluginsIndex(), {});
+  const auto newItems = getGraphItems(view);
+
+  ASSERT_EQ(items.size() - 2, newItems.size());
+  for (const auto item : newItems) {
+    EXPECT_EQ(1, items.count(item));
+  }
+}
+}
+}
+
+#endif
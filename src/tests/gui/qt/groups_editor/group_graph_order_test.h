@@ -0,0 +1,192 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_ORDER_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_ORDER_TEST
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "gui/qt/groups_editor/group_graph_order.h"
+
+namespace loot {
+namespace test {
+size_t getOrderIndex(const std::vector<std::string>& order,
+                     const std::string& name) {
+  const auto it = std::find(order.begin(), order.end(), name);
+  EXPECT_NE(order.end(), it);
+
+  return std::distance(order.begin(), it);
+}
+
+TEST(GroupGraphOrder, addEdgeShouldAddMissingNodes) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+
+  EXPECT_TRUE(order.containsNode("a"));
+  EXPECT_TRUE(order.containsNode("b"));
+}
+
+TEST(GroupGraphOrder, addEdgeShouldRejectAnEdgeFromANodeToItself) {
+  GroupGraphOrder order;
+
+  EXPECT_FALSE(order.addEdge("a", "a"));
+  EXPECT_FALSE(order.containsNode("a"));
+}
+
+TEST(GroupGraphOrder, addEdgeShouldRejectAnEdgeThatWouldCreateACycle) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("b", "c"));
+  EXPECT_FALSE(order.addEdge("c", "a"));
+  EXPECT_FALSE(order.addEdge("b", "a"));
+}
+
+TEST(GroupGraphOrder, addEdgeShouldLeaveTheGraphUnchangedIfItRejectsAnEdge) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("b", "c"));
+  const auto expectedOrder = order.getOrder();
+
+  EXPECT_FALSE(order.addEdge("c", "a"));
+  EXPECT_FALSE(order.addEdge("d", "d"));
+
+  EXPECT_FALSE(order.containsNode("d"));
+  EXPECT_EQ(expectedOrder, order.getOrder());
+
+  // If the rejected edge had been added, this would create a cycle.
+  order.removeEdge("a", "b");
+  EXPECT_TRUE(order.addEdge("a", "c"));
+}
+
+TEST(GroupGraphOrder, addEdgeShouldAllowParallelEdges) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("a", "b"));
+}
+
+TEST(GroupGraphOrder, addEdgeShouldReorderNodesWhenAnEdgeGoesAgainstTheOrder) {
+  GroupGraphOrder order;
+  order.addNode("c");
+  order.addNode("b");
+  order.addNode("a");
+
+  EXPECT_TRUE(order.addEdge("b", "c"));
+  EXPECT_TRUE(order.addEdge("a", "b"));
+
+  EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), order.getOrder());
+}
+
+TEST(GroupGraphOrder, removeEdgeShouldAllowAPreviouslyCyclicEdgeToBeAdded) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("b", "c"));
+
+  order.removeEdge("b", "c");
+
+  EXPECT_TRUE(order.addEdge("c", "a"));
+}
+
+TEST(GroupGraphOrder, removeEdgeShouldOnlyRemoveOneOfAPairOfParallelEdges) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("a", "b"));
+
+  order.removeEdge("a", "b");
+
+  EXPECT_FALSE(order.addEdge("b", "a"));
+}
+
+TEST(GroupGraphOrder, removeNodeShouldRemoveTheNodeAndItsEdges) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+  EXPECT_TRUE(order.addEdge("b", "c"));
+
+  order.removeNode("b");
+
+  EXPECT_FALSE(order.containsNode("b"));
+  EXPECT_EQ(std::vector<std::string>({"a", "c"}), order.getOrder());
+  EXPECT_TRUE(order.addEdge("c", "a"));
+}
+
+TEST(GroupGraphOrder, clearShouldRemoveAllNodes) {
+  GroupGraphOrder order;
+
+  EXPECT_TRUE(order.addEdge("a", "b"));
+
+  order.clear();
+
+  EXPECT_FALSE(order.containsNode("a"));
+  EXPECT_TRUE(order.getOrder().empty());
+  EXPECT_TRUE(order.addEdge("b", "a"));
+}
+
+TEST(GroupGraphOrder,
+     getOrderShouldBeATopologicalOrderAfterAddingEdgesInReverseOrder) {
+  static constexpr size_t GROUP_COUNT = 500;
+
+  GroupGraphOrder order;
+  std::vector<std::pair<std::string, std::string>> edges;
+
+  // Add the nodes in reverse so that every edge goes against the order that
+  // the nodes were added in. Each group loads after the previous two groups.
+  for (size_t i = GROUP_COUNT; i > 0; i -= 1) {
+    order.addNode("group" + std::to_string(i - 1));
+  }
+
+  for (size_t i = 1; i < GROUP_COUNT; i += 1) {
+    const auto name = "group" + std::to_string(i);
+
+    edges.push_back({"group" + std::to_string(i - 1), name});
+    if (i > 1) {
+      edges.push_back({"group" + std::to_string(i - 2), name});
+    }
+  }
+
+  for (const auto& [from, to] : edges) {
+    EXPECT_TRUE(order.addEdge(from, to));
+  }
+
+  const auto nodes = order.getOrder();
+  ASSERT_EQ(GROUP_COUNT, nodes.size());
+  for (const auto& [from, to] : edges) {
+    EXPECT_LT(getOrderIndex(nodes, from), getOrderIndex(nodes, to));
+  }
+
+  EXPECT_FALSE(order.addEdge("group" + std::to_string(GROUP_COUNT - 1),
+                             "group0"));
+}
+}
+}
+
+#endif
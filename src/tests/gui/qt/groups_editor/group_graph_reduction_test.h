@@ -0,0 +1,185 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_REDUCTION_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GROUP_GRAPH_REDUCTION_TEST
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <unordered_map>
+
+#include "gui/qt/groups_editor/group_graph_reduction.h"
+#include "gui/qt/groups_editor/layout.h"
+
+namespace loot {
+namespace test {
+typedef std::set<std::pair<std::string, std::string>> RedundantEdges;
+
+// The groups are arranged in layers of three, and each group loads after two
+// groups in the previous layer and the group at the same position two layers
+// back. The last of those edges is always redundant, but spans a layer, so
+// that it adds work for the layout algorithm.
+std::vector<Group> getLayeredGroups(size_t groupCount) {
+  static constexpr size_t LAYER_WIDTH = 3;
+
+  const auto getName = [](size_t index) {
+    return "layered group " + std::to_string(index);
+  };
+
+  std::vector<Group> groups;
+  for (size_t i = 0; i < groupCount; i += 1) {
+    std::vector<std::string> afterGroups;
+    if (i >= LAYER_WIDTH) {
+      const auto layerStart = i - i % LAYER_WIDTH;
+      const auto nextInLayer = layerStart + (i + 1) % LAYER_WIDTH;
+
+      afterGroups.push_back(getName(i - LAYER_WIDTH));
+      afterGroups.push_back(getName(nextInLayer - LAYER_WIDTH));
+    }
+    if (i >= 2 * LAYER_WIDTH) {
+      afterGroups.push_back(getName(i - 2 * LAYER_WIDTH));
+    }
+
+    groups.push_back(Group(getName(i), afterGroups));
+  }
+
+  return groups;
+}
+
+std::chrono::milliseconds timeGroupGraphLayout(
+    const GroupGraph& graph,
+    const RedundantEdges& hiddenEdges) {
+  static const QSizeF NODE_SIZE(100, 20);
+
+  std::unordered_map<std::string, size_t> nodeIndexes;
+  for (const auto& [name, node] : graph.nodes) {
+    nodeIndexes.emplace(name, nodeIndexes.size());
+  }
+
+  std::vector<std::pair<size_t, size_t>> edges;
+  for (const auto& edge : graph.edges) {
+    if (hiddenEdges.count({edge.fromName, edge.toName}) == 0) {
+      edges.emplace_back(nodeIndexes.at(edge.fromName),
+                         nodeIndexes.at(edge.toName));
+    }
+  }
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  const auto positions = calculateGraphLayout(
+      std::vector<QSizeF>(nodeIndexes.size(), NODE_SIZE), edges);
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - startTime);
+
+  EXPECT_EQ(nodeIndexes.size(), positions.size());
+
+  return duration;
+}
+
+TEST(GetRedundantGroupEdges, shouldReturnNothingForAGraphWithNoEdges) {
+  const auto graph =
+      buildGroupGraph({Group("a"), Group("b")}, {}, GroupPluginsIndex());
+
+  EXPECT_TRUE(getRedundantGroupEdges(graph).empty());
+}
+
+TEST(GetRedundantGroupEdges, shouldReturnAnEdgeThatBypassesAPath) {
+  const auto graph = buildGroupGraph(
+      {Group("a"), Group("b", {"a"}), Group("c", {"a", "b"})},
+      {},
+      GroupPluginsIndex());
+
+  EXPECT_EQ(RedundantEdges({{"a", "c"}}), getRedundantGroupEdges(graph));
+}
+
+TEST(GetRedundantGroupEdges, shouldNotReturnEdgesOfADiamond) {
+  const auto graph = buildGroupGraph({Group("a"),
+                                      Group("b", {"a"}),
+                                      Group("c", {"a"}),
+                                      Group("d", {"b", "c"})},
+                                     {},
+                                     GroupPluginsIndex());
+
+  EXPECT_TRUE(getRedundantGroupEdges(graph).empty());
+}
+
+TEST(GetRedundantGroupEdges, shouldTreatParallelEdgesAsOneEdge) {
+  const auto graph = buildGroupGraph({Group("a"), Group("b", {"a"})},
+                                     {Group("b", {"a"})},
+                                     GroupPluginsIndex());
+
+  ASSERT_EQ(2, graph.edges.size());
+  EXPECT_TRUE(getRedundantGroupEdges(graph).empty());
+}
+
+TEST(GetRedundantGroupEdges, shouldFindEdgesMadeRedundantByUserMetadata) {
+  const auto graph = buildGroupGraph({Group("a"), Group("c", {"a"})},
+                                     {Group("b", {"a"}), Group("c", {"b"})},
+                                     GroupPluginsIndex());
+
+  EXPECT_EQ(RedundantEdges({{"a", "c"}}), getRedundantGroupEdges(graph));
+}
+
+TEST(GetRedundantGroupEdges, shouldThrowIfTheGraphIsCyclic) {
+  const auto graph = buildGroupGraph(
+      {Group("a", {"b"}), Group("b", {"a"})}, {}, GroupPluginsIndex());
+
+  EXPECT_THROW(getRedundantGroupEdges(graph), std::invalid_argument);
+}
+
+TEST(GetRedundantGroupEdges,
+     shouldReduceTheEdgesToRenderAndLayOutForALargeGraph) {
+  static constexpr size_t GROUP_COUNT = 1500;
+
+  const auto graph = buildGroupGraph(
+      getLayeredGroups(GROUP_COUNT), {}, GroupPluginsIndex());
+
+  const auto redundantEdges = getRedundantGroupEdges(graph);
+
+  // Every group after the first two layers has one redundant edge.
+  EXPECT_EQ(GROUP_COUNT - 6, redundantEdges.size());
+  for (const auto& [fromName, toName] : redundantEdges) {
+    EXPECT_EQ(1, graph.edges.count(GroupGraphEdge{fromName, toName, false}));
+  }
+
+  const auto renderedEdgesBefore = graph.edges.size();
+  const auto renderedEdgesAfter = graph.edges.size() - redundantEdges.size();
+  const auto layoutTimeBefore = timeGroupGraphLayout(graph, {});
+  const auto layoutTimeAfter = timeGroupGraphLayout(graph, redundantEdges);
+
+  EXPECT_LT(renderedEdgesAfter, renderedEdgesBefore);
+
+  RecordProperty("renderedEdgesBefore", std::to_string(renderedEdgesBefore));
+  RecordProperty("renderedEdgesAfter", std::to_string(renderedEdgesAfter));
+  RecordProperty("layoutTimeBeforeMs",
+                 std::to_string(layoutTimeBefore.count()));
+  RecordProperty("layoutTimeAfterMs", std::to_string(layoutTimeAfter.count()));
+}
+}
+}
+
+#endif
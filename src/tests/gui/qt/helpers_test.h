@@ -339,6 +339,23 @@ TEST(isValidUrl, shouldBeTrueForAHttpsUrl) {
 
   EXPECT_TRUE(result);
 }
+
+TEST(getRowsInPriorityOrder, shouldReturnAnEmptyVectorIfThereAreNoRows) {
+  EXPECT_TRUE(getRowsInPriorityOrder(0, 0, 0).empty());
+}
+
+TEST(getRowsInPriorityOrder,
+     shouldReturnVisibleRowsFirstThenAlternateBetweenRowsBelowAndAbove) {
+  const auto rows = getRowsInPriorityOrder(8, 2, 3);
+
+  EXPECT_EQ(std::vector<int>({2, 3, 4, 1, 5, 0, 6, 7}), rows);
+}
+
+TEST(getRowsInPriorityOrder, shouldClampVisibleRowsToTheRowCount) {
+  const auto rows = getRowsInPriorityOrder(3, -1, 5);
+
+  EXPECT_EQ(std::vector<int>({0, 1, 2}), rows);
+}
 }
 }
 
@@ -0,0 +1,191 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_EDITOR_COLUMN_WIDTH_CACHE_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_EDITOR_COLUMN_WIDTH_CACHE_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QStyledItemDelegate>
+
+#include "gui/qt/plugin_editor/column_width_cache.h"
+#include "gui/qt/plugin_editor/models/tag_table_model.h"
+#include "gui/qt/plugin_editor/table_tabs.h"
+
+namespace loot {
+namespace test {
+class ColumnWidthCacheTest : public ::testing::Test {
+protected:
+  static constexpr int ROW_COUNT = 2000;
+  static constexpr int CHARACTER_WIDTH = 7;
+
+  ColumnWidthCacheTest() :
+      cache(nullptr, [this](const QModelIndex& index) {
+        measuredItemCount += 1;
+        return static_cast<int>(index.data().toString().size()) *
+               CHARACTER_WIDTH;
+      }) {
+    std::vector<Tag> tags;
+    for (int i = 0; i < ROW_COUNT; i += 1) {
+      tags.push_back(Tag("Tag" + std::to_string(i % 100), i % 2 == 0));
+    }
+
+    const std::map<bool, std::pair<QString, QVariant>> suggestionTypeMap{
+        {true, {"Add", true}}, {false, {"Remove", false}}};
+
+    model = new TagTableModel(nullptr, tags, {}, suggestionTypeMap);
+  }
+
+  ~ColumnWidthCacheTest() { delete model; }
+
+  TagTableModel* model{nullptr};
+  int measuredItemCount{0};
+  ColumnWidthCache cache;
+};
+
+TEST_F(ColumnWidthCacheTest, shouldMeasureEveryItemWhenTheModelIsSet) {
+  cache.setModel(model);
+
+  EXPECT_EQ(ROW_COUNT * model->columnCount(), measuredItemCount);
+  EXPECT_EQ(6 * CHARACTER_WIDTH,
+            cache.getMaxContentWidth(TagTableModel::TYPE_COLUMN));
+  EXPECT_EQ(5 * CHARACTER_WIDTH,
+            cache.getMaxContentWidth(TagTableModel::NAME_COLUMN));
+  EXPECT_EQ(0, cache.getMaxContentWidth(TagTableModel::CONDITION_COLUMN));
+}
+
+TEST_F(ColumnWidthCacheTest, shouldReturnZeroForAnInvalidColumn) {
+  cache.setModel(model);
+
+  EXPECT_EQ(0, cache.getMaxContentWidth(-1));
+  EXPECT_EQ(0, cache.getMaxContentWidth(model->columnCount()));
+}
+
+TEST_F(ColumnWidthCacheTest, shouldOnlyMeasureInsertedAndChangedItems) {
+  cache.setModel(model);
+  measuredItemCount = 0;
+
+  ASSERT_TRUE(model->insertRow(ROW_COUNT));
+  EXPECT_EQ(model->columnCount(), measuredItemCount);
+
+  const auto index = model->index(ROW_COUNT, TagTableModel::CONDITION_COLUMN);
+  ASSERT_TRUE(model->setData(index, "file(\"Example.esp\")", Qt::EditRole));
+
+  EXPECT_EQ(model->columnCount() + 1, measuredItemCount);
+  EXPECT_EQ(19 * CHARACTER_WIDTH,
+            cache.getMaxContentWidth(TagTableModel::CONDITION_COLUMN));
+}
+
+TEST_F(ColumnWidthCacheTest, shouldUpdateTheMaximumWidthWhenRowsAreRemoved) {
+  cache.setModel(model);
+
+  static constexpr int NAME_COLUMN = TagTableModel::NAME_COLUMN;
+
+  ASSERT_TRUE(model->insertRows(ROW_COUNT, 2));
+  for (const auto row : {ROW_COUNT, ROW_COUNT + 1}) {
+    ASSERT_TRUE(model->setData(
+        model->index(row, NAME_COLUMN), "LongTagName", Qt::EditRole));
+  }
+  EXPECT_EQ(11 * CHARACTER_WIDTH, cache.getMaxContentWidth(NAME_COLUMN));
+
+  ASSERT_TRUE(model->removeRow(ROW_COUNT));
+  EXPECT_EQ(11 * CHARACTER_WIDTH, cache.getMaxContentWidth(NAME_COLUMN));
+
+  ASSERT_TRUE(model->removeRow(ROW_COUNT));
+  EXPECT_EQ(5 * CHARACTER_WIDTH, cache.getMaxContentWidth(NAME_COLUMN));
+}
+
+// Counts the items that it's asked to measure.
+class CountingItemDelegate : public QStyledItemDelegate {
+public:
+  using QStyledItemDelegate::QStyledItemDelegate;
+
+  QSize sizeHint(const QStyleOptionViewItem& option,
+                 const QModelIndex& index) const override {
+    sizeHintCount += 1;
+    return QStyledItemDelegate::sizeHint(option, index);
+  }
+
+  mutable int sizeHintCount{0};
+};
+
+class ColumnWidthTestTableTab : public BaseTableTab {
+public:
+  ColumnWidthTestTableTab(QAbstractItemModel* model,
+                          CountingItemDelegate* delegate) :
+      BaseTableTab(nullptr) {
+    setTableModel(model);
+    for (int column = 0; column < model->columnCount(); column += 1) {
+      setItemDelegateForColumn(column, delegate);
+    }
+  }
+
+protected:
+  bool hasUserMetadata() const override { return true; }
+};
+
+TEST_F(ColumnWidthCacheTest, shouldNotMeasureItemsWhenATableTabIsResized) {
+  static constexpr int RESIZE_COUNT = 100;
+  static constexpr int INITIAL_TAB_WIDTH = 400;
+  static constexpr int TAB_HEIGHT = 300;
+
+  CountingItemDelegate delegate;
+  ColumnWidthTestTableTab tab(model, &delegate);
+
+  tab.resize(INITIAL_TAB_WIDTH, TAB_HEIGHT);
+  tab.show();
+  QApplication::processEvents();
+
+  const auto tableView = tab.findChild<QTableView*>();
+  ASSERT_NE(nullptr, tableView);
+
+  const auto initialColumnWidth = tableView->columnWidth(0);
+  delegate.sizeHintCount = 0;
+
+  for (int i = 1; i <= RESIZE_COUNT; i += 1) {
+    tab.resize(INITIAL_TAB_WIDTH + 4 * i, TAB_HEIGHT);
+    QApplication::processEvents();
+  }
+
+  // The columns are scaled to fit the table, so check that they were resized
+  // to be sure that the tab handled the resize events.
+  EXPECT_LT(initialColumnWidth, tableView->columnWidth(0));
+  EXPECT_GE(tableView->width(), tableView->horizontalHeader()->length());
+  EXPECT_EQ(0, delegate.sizeHintCount);
+}
+
+TEST(ScaleColumnWidths, shouldKeepTheWidthsProportions) {
+  EXPECT_EQ(std::vector<int>({100, 300}), scaleColumnWidths({50, 150}, 400));
+}
+
+TEST(ScaleColumnWidths, shouldReturnZeroWidthsUnchanged) {
+  EXPECT_EQ(std::vector<int>({0, 0}), scaleColumnWidths({0, 0}, 400));
+}
+}
+}
+
+#endif
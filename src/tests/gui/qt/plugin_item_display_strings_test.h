@@ -0,0 +1,117 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_ITEM_DISPLAY_STRINGS_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_ITEM_DISPLAY_STRINGS_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/plugin_item_display_strings.h"
+
+namespace loot {
+namespace test {
+TEST(PluginItemDisplayStrings, shouldBeEmptyForAnItemWithNoOptionalData) {
+  PluginItem item;
+  item.name = "Blank.esp";
+
+  const PluginItemDisplayStrings strings(item);
+
+  EXPECT_EQ(QString("Blank.esp"), strings.name);
+  EXPECT_TRUE(strings.group.isEmpty());
+  EXPECT_TRUE(strings.loadOrderIndex.isEmpty());
+  EXPECT_TRUE(strings.crc.isEmpty());
+  EXPECT_TRUE(strings.version.isEmpty());
+  EXPECT_TRUE(strings.currentTags.isEmpty());
+  EXPECT_TRUE(strings.addTags.isEmpty());
+  EXPECT_TRUE(strings.removeTags.isEmpty());
+  EXPECT_TRUE(strings.locations.isEmpty());
+  EXPECT_TRUE(strings.cleaningUtilityToolTip.isEmpty());
+}
+
+TEST(PluginItemDisplayStrings, shouldFormatTheItemsOptionalData) {
+  PluginItem item;
+  item.name = "Blank.esp";
+  item.group = "group1";
+  item.loadOrderIndex = 10;
+  item.crc = 0xDEADBEEF;
+  item.version = "1.0";
+  item.cleaningUtility = "TES5Edit";
+  item.currentTags = {"Relev", "Delev"};
+  item.addTags = {"C.Climate"};
+  item.removeTags = {"Names"};
+
+  const PluginItemDisplayStrings strings(item);
+
+  EXPECT_EQ(QString("group1"), strings.group);
+  EXPECT_EQ(QString("0A"), strings.loadOrderIndex);
+  EXPECT_EQ(QString("DEADBEEF"), strings.crc);
+  EXPECT_EQ(QString("1.0"), strings.version);
+  EXPECT_EQ(QString("Relev, Delev"), strings.currentTags);
+  EXPECT_EQ(QString("C.Climate"), strings.addTags);
+  EXPECT_EQ(QString("Names"), strings.removeTags);
+  EXPECT_EQ(QString("Verified clean by TES5Edit"),
+            strings.cleaningUtilityToolTip);
+}
+
+TEST(PluginItemDisplayStrings, shouldJoinLocationLinksAsHtml) {
+  PluginItem item;
+  item.locations = {Location("https://www.example.com/1", "First"),
+                    Location("https://www.example.com/2", "Second")};
+
+  const PluginItemDisplayStrings strings(item);
+
+  EXPECT_EQ(QString::fromUtf8(
+                u8"Sources: <a href=\"https://www.example.com/1\">First</a>"
+                u8" \uFF5C <a href=\"https://www.example.com/2\">Second</a>"),
+            strings.locations);
+}
+
+TEST(PluginItemDisplayStrings,
+     shouldUseTheSingularLabelAndEscapeTextForASingleLocation) {
+  PluginItem item;
+  item.locations = {
+      Location("https://www.example.com/?a=1&b=2", "<Example> & Co")};
+
+  const PluginItemDisplayStrings strings(item);
+
+  EXPECT_EQ(QString("Source: <a href=\"https://www.example.com/?a=1&amp;b=2\">"
+                    "&lt;Example&gt; &amp; Co</a>"),
+            strings.locations);
+}
+
+TEST(PluginItemDisplayStrings, shouldMatchTheItemsContentToSearch) {
+  PluginItem item;
+  item.name = "Blank.esp";
+  item.version = "1.0";
+
+  const PluginItemDisplayStrings strings(item);
+
+  EXPECT_EQ(QString::fromStdString(item.contentToSearch()),
+            strings.contentToSearch);
+}
+}
+}
+
+#endif
@@ -0,0 +1,288 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_REPORT_WRITER_TEST
+#define LOOT_TESTS_GUI_QT_REPORT_WRITER_TEST
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+
+#include "gui/qt/report_writer.h"
+#include "gui/query/types/export_report_query.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+// Discards everything written to it, but records how it was written.
+class CountingStreamBuffer : public std::streambuf {
+public:
+  size_t bytesWritten{0};
+  size_t writeCount{0};
+  size_t largestWrite{0};
+
+protected:
+  int_type overflow(int_type character) override {
+    if (!traits_type::eq_int_type(character, traits_type::eof())) {
+      recordWrite(1);
+    }
+
+    return traits_type::not_eof(character);
+  }
+
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    recordWrite(static_cast<size_t>(count));
+    return count;
+  }
+
+private:
+  void recordWrite(size_t count) {
+    bytesWritten += count;
+    writeCount += 1;
+    largestWrite = std::max(largestWrite, count);
+  }
+};
+
+class ReportWriterTest : public ::testing::TestWithParam<ReportFormat> {
+protected:
+  static constexpr size_t PLUGIN_COUNT = 20000;
+
+  ReportWriterTest() : out_(&streamBuffer_) {}
+
+  static void SetUpTestSuite() {
+    generalInformation_ = new GeneralInformation();
+    generalInformation_->masterlistRevision =
+        FileRevisionSummary("abcdef", "2021-01-01");
+    generalInformation_->preludeRevision =
+        FileRevisionSummary("123456", "2021-01-02");
+    generalInformation_->generalMessages = {
+        PlainTextSimpleMessage(MessageType::say, "A general message")};
+
+    pluginItems_ = new std::vector<PluginItem>();
+    pluginItems_->reserve(PLUGIN_COUNT);
+    for (size_t i = 0; i < PLUGIN_COUNT; i += 1) {
+      PluginItem item;
+      item.name = "Plugin " + std::to_string(i) + ".esp";
+      item.loadOrderIndex = static_cast<short>(i % 255);
+      item.crc = static_cast<uint32_t>(i);
+      item.version = "1." + std::to_string(i);
+      item.group = "group" + std::to_string(i % 100);
+      item.isActive = i % 2 == 0;
+      item.currentTags = {"Delev", "Relev", "Names"};
+      item.messages = {PlainTextSimpleMessage(
+          MessageType::warn,
+          "This plugin has a \"quoted\", multi-line\nmessage.")};
+      item.locations = {Location("https://www.example.com/" + item.name)};
+      pluginItems_->push_back(item);
+    }
+  }
+
+  static void TearDownTestSuite() {
+    delete generalInformation_;
+    delete pluginItems_;
+  }
+
+  static GeneralInformation* generalInformation_;
+  static std::vector<PluginItem>* pluginItems_;
+
+  CountingStreamBuffer streamBuffer_;
+  std::ostream out_;
+};
+
+GeneralInformation* ReportWriterTest::generalInformation_ = nullptr;
+std::vector<PluginItem>* ReportWriterTest::pluginItems_ = nullptr;
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ReportWriterTest,
+                         ::testing::Values(ReportFormat::Markdown,
+                                           ReportFormat::Json,
+                                           ReportFormat::Csv));
+
+TEST_P(ReportWriterTest,
+       writingAReportShouldStreamItInChunksNoLargerThanTheBuffer) {
+  ReportWriter writer(out_, GetParam());
+
+  writer.writeGeneralInformation(*generalInformation_);
+  for (const auto& plugin : *pluginItems_) {
+    EXPECT_TRUE(writer.writePlugin(plugin));
+  }
+  writer.finish();
+
+  EXPECT_FALSE(writer.isTruncated());
+  EXPECT_EQ(PLUGIN_COUNT, writer.getPluginsWritten());
+  EXPECT_GT(streamBuffer_.bytesWritten, 20 * ReportWriter::BUFFER_SIZE);
+  EXPECT_LE(streamBuffer_.largestWrite, ReportWriter::BUFFER_SIZE);
+  EXPECT_GE(streamBuffer_.writeCount,
+            streamBuffer_.bytesWritten / ReportWriter::BUFFER_SIZE);
+}
+
+TEST_P(ReportWriterTest,
+       bufferedContentShouldNotGrowWithThePluginCount) {
+  ReportWriter writer(out_, GetParam());
+
+  writer.writeGeneralInformation(*generalInformation_);
+  size_t peakBufferedSize = writer.getBufferedSize();
+  for (const auto& plugin : *pluginItems_) {
+    writer.writePlugin(plugin);
+    peakBufferedSize = std::max(peakBufferedSize, writer.getBufferedSize());
+  }
+
+  const auto bytesWrittenBeforeFinish = streamBuffer_.bytesWritten;
+  writer.finish();
+
+  // Everything except the last buffer's worth of content should have been
+  // streamed out while the plugins were being written.
+  EXPECT_LE(peakBufferedSize, ReportWriter::BUFFER_SIZE);
+  EXPECT_EQ(0, writer.getBufferedSize());
+  EXPECT_LE(streamBuffer_.bytesWritten - bytesWrittenBeforeFinish,
+            ReportWriter::BUFFER_SIZE);
+  EXPECT_GT(streamBuffer_.bytesWritten, 20 * ReportWriter::BUFFER_SIZE);
+}
+
+TEST_P(ReportWriterTest, writePluginShouldStopAtTheSizeLimit) {
+  static constexpr size_t SIZE_LIMIT = 10000;
+  ReportWriter writer(out_, GetParam(), SIZE_LIMIT);
+
+  writer.writeGeneralInformation(*generalInformation_);
+  size_t pluginsWritten = 0;
+  for (const auto& plugin : *pluginItems_) {
+    if (!writer.writePlugin(plugin)) {
+      break;
+    }
+    pluginsWritten += 1;
+  }
+  writer.finish();
+
+  EXPECT_TRUE(writer.isTruncated());
+  EXPECT_LT(0, pluginsWritten);
+  EXPECT_EQ(pluginsWritten, writer.getPluginsWritten());
+  EXPECT_FALSE(writer.writePlugin(pluginItems_->front()));
+  EXPECT_LT(streamBuffer_.bytesWritten, 2 * SIZE_LIMIT);
+}
+
+TEST(ReportWriter, markdownReportShouldMatchTheCardsMarkdownContent) {
+  GeneralInformation generalInformation;
+  PluginItem plugin;
+  plugin.name = "Blank.esp";
+  plugin.version = "1.0";
+
+  std::ostringstream out;
+  ReportWriter writer(out, ReportFormat::Markdown);
+  writer.writeGeneralInformation(generalInformation);
+  writer.writePlugin(plugin);
+  writer.finish();
+
+  EXPECT_EQ(generalInformation.getMarkdownContent() + "\n\n" +
+                plugin.getMarkdownContent() + "\n\n",
+            out.str());
+}
+
+TEST(ReportWriter, jsonReportShouldEscapeStringsAndListPlugins) {
+  PluginItem plugin1;
+  plugin1.name = "A \"quoted\"\\name\n.esp";
+  plugin1.loadOrderIndex = 2;
+  PluginItem plugin2;
+  plugin2.name = "B.esp";
+  plugin2.currentTags = {"Delev"};
+
+  std::ostringstream out;
+  ReportWriter writer(out, ReportFormat::Json);
+  writer.writePlugin(plugin1);
+  writer.writePlugin(plugin2);
+  writer.finish();
+
+  const auto json = out.str();
+  EXPECT_EQ(0, json.find("{\n  \"plugins\": [\n    {\"name\":"
+                         "\"A \\\"quoted\\\"\\\\name\\n.esp\","
+                         "\"loadOrderIndex\":2,\"crc\":null,"));
+  EXPECT_NE(std::string::npos,
+            json.find("},\n    {\"name\":\"B.esp\",\"loadOrderIndex\":null,"));
+  EXPECT_NE(std::string::npos, json.find("\"currentTags\":[\"Delev\"]"));
+  EXPECT_EQ(json.size() - 7, json.rfind("\n  ]\n}\n"));
+}
+
+TEST(ReportWriter, csvReportShouldHaveAHeaderRowAndQuoteFieldsWhenNeeded) {
+  PluginItem plugin;
+  plugin.name = "A, \"quoted\" name.esp";
+  plugin.isActive = true;
+  plugin.currentTags = {"Delev", "Relev"};
+
+  std::ostringstream out;
+  ReportWriter writer(out, ReportFormat::Csv);
+  writer.writeGeneralInformation(GeneralInformation());
+  writer.writePlugin(plugin);
+  writer.finish();
+
+  const auto csv = out.str();
+  const auto headerEnd = csv.find("\r\n");
+  ASSERT_NE(std::string::npos, headerEnd);
+  EXPECT_EQ(0, csv.find("Name,Load Order Index,"));
+  EXPECT_EQ(
+      "\"A, \"\"quoted\"\" name.esp\",,,,,,true,false,false,false,false,false,"
+      "false,\"Delev, Relev\",,,\r\n",
+      csv.substr(headerEnd + 2));
+}
+
+TEST(ExportReportQuery, executeLogicShouldWriteTheReportAndSendProgress) {
+  const auto rootPath = getTempPath();
+  std::filesystem::create_directories(rootPath);
+  const auto reportPath = rootPath / "report.md";
+
+  auto plugins = std::make_shared<std::vector<PluginItem>>(
+      2 * ExportReportQuery::PROGRESS_UPDATE_INTERVAL);
+  for (size_t i = 0; i < plugins->size(); i += 1) {
+    plugins->at(i).name = std::to_string(i) + ".esp";
+  }
+
+  std::vector<std::string> progressMessages;
+  ExportReportQuery query(GeneralInformation(),
+                          plugins,
+                          reportPath,
+                          ReportFormat::Markdown,
+                          [&](std::string message) {
+                            progressMessages.push_back(message);
+                          });
+
+  query.executeLogic();
+
+  std::ifstream in(reportPath, std::ios::binary);
+  std::stringstream content;
+  content << in.rdbuf();
+  in.close();
+
+  EXPECT_NE(std::string::npos, content.str().find("# 999.esp\n"));
+  EXPECT_EQ(3, progressMessages.size());
+
+  std::filesystem::remove_all(rootPath);
+}
+}
+}
+
+#endif
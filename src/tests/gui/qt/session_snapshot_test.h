@@ -0,0 +1,208 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_SESSION_SNAPSHOT_TEST
+#define LOOT_TESTS_GUI_QT_SESSION_SNAPSHOT_TEST
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "gui/qt/session_snapshot.h"
+#include "gui/state/game/helpers.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class SessionSnapshotTest : public ::testing::Test {
+protected:
+  SessionSnapshotTest() :
+      rootPath_(getTempPath()), snapshotPath_(rootPath_ / "snapshot.toml") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  const std::filesystem::path rootPath_;
+  const std::filesystem::path snapshotPath_;
+};
+
+TEST_F(SessionSnapshotTest, loadingASavedSnapshotShouldRoundTripPluginItems) {
+  PluginItem item;
+  item.name = "Blank.esm";
+  item.loadOrderIndex = 3;
+  item.crc = 0xDEADBEEF;
+  item.version = "1.0";
+  item.group = "group1";
+  item.cleaningUtility = "TES5Edit";
+  item.isActive = true;
+  item.isDirty = true;
+  item.isMaster = true;
+  item.currentTags = {"Relev"};
+  item.addTags = {"Delev"};
+  item.removeTags = {"Names"};
+  item.messages = {PlainTextSimpleMessage(MessageType::warn, "a warning")};
+  item.locations = {Location("https://www.example.com", "example")};
+  item.detailsEvaluated = true;
+
+  PluginItem minimalItem;
+  minimalItem.name = "Blank.esp";
+
+  SessionSnapshot snapshot;
+  snapshot.pluginItems = {item, minimalItem};
+
+  saveSessionSnapshot(snapshot, snapshotPath_);
+  const auto loaded = loadSessionSnapshot(snapshotPath_);
+
+  ASSERT_EQ(2, loaded.pluginItems.size());
+
+  const auto& loadedItem = loaded.pluginItems[0];
+  EXPECT_EQ(item.name, loadedItem.name);
+  EXPECT_EQ(item.loadOrderIndex, loadedItem.loadOrderIndex);
+  EXPECT_EQ(item.crc, loadedItem.crc);
+  EXPECT_EQ(item.version, loadedItem.version);
+  EXPECT_EQ(item.group, loadedItem.group);
+  EXPECT_EQ(item.cleaningUtility, loadedItem.cleaningUtility);
+  EXPECT_TRUE(loadedItem.isActive);
+  EXPECT_TRUE(loadedItem.isDirty);
+  EXPECT_FALSE(loadedItem.isEmpty);
+  EXPECT_TRUE(loadedItem.isMaster);
+  EXPECT_EQ(item.currentTags, loadedItem.currentTags);
+  EXPECT_EQ(item.addTags, loadedItem.addTags);
+  EXPECT_EQ(item.removeTags, loadedItem.removeTags);
+  ASSERT_EQ(1, loadedItem.messages.size());
+  EXPECT_EQ(MessageType::warn, loadedItem.messages[0].type);
+  EXPECT_EQ(item.messages[0].text, loadedItem.messages[0].text);
+  EXPECT_EQ(item.locations, loadedItem.locations);
+  EXPECT_TRUE(loadedItem.detailsEvaluated);
+
+  const auto& loadedMinimalItem = loaded.pluginItems[1];
+  EXPECT_EQ(minimalItem.name, loadedMinimalItem.name);
+  EXPECT_FALSE(loadedMinimalItem.loadOrderIndex.has_value());
+  EXPECT_FALSE(loadedMinimalItem.crc.has_value());
+  EXPECT_FALSE(loadedMinimalItem.version.has_value());
+  EXPECT_FALSE(loadedMinimalItem.group.has_value());
+  EXPECT_TRUE(loadedMinimalItem.locations.empty());
+  EXPECT_FALSE(loadedMinimalItem.detailsEvaluated);
+}
+
+TEST_F(SessionSnapshotTest,
+       loadingASavedSnapshotShouldRoundTripTheRestOfItsContent) {
+  SessionSnapshot snapshot;
+  snapshot.generalInformation.gameType = GameType::fo4;
+  snapshot.generalInformation.masterlistRevision =
+      FileRevisionSummary("abcdef", "2022-01-01");
+  snapshot.generalInformation.preludeRevision =
+      FileRevisionSummary("123456", "2022-02-02");
+  snapshot.generalInformation.generalMessages = {
+      PlainTextSimpleMessage(MessageType::error, "an error")};
+  snapshot.filters.hideCRCs = true;
+  snapshot.filters.hideBashTags = false;
+  snapshot.filters.showOnlyEmptyPlugins = true;
+  snapshot.queryTimings = {
+      QueryTiming{"loot::GetGameDataQuery", std::chrono::microseconds(1500)}};
+
+  saveSessionSnapshot(snapshot, snapshotPath_);
+  const auto loaded = loadSessionSnapshot(snapshotPath_);
+
+  EXPECT_EQ(GameType::fo4, loaded.generalInformation.gameType);
+  EXPECT_EQ("abcdef", loaded.generalInformation.masterlistRevision.id);
+  EXPECT_EQ("2022-01-01", loaded.generalInformation.masterlistRevision.date);
+  EXPECT_EQ("123456", loaded.generalInformation.preludeRevision.id);
+  EXPECT_EQ("2022-02-02", loaded.generalInformation.preludeRevision.date);
+  ASSERT_EQ(1, loaded.generalInformation.generalMessages.size());
+  EXPECT_EQ(MessageType::error,
+            loaded.generalInformation.generalMessages[0].type);
+
+  EXPECT_TRUE(loaded.filters.hideCRCs);
+  EXPECT_FALSE(loaded.filters.hideBashTags);
+  EXPECT_TRUE(loaded.filters.showOnlyEmptyPlugins);
+  EXPECT_FALSE(loaded.filters.hideNotes);
+
+  ASSERT_EQ(1, loaded.queryTimings.size());
+  EXPECT_EQ("loot::GetGameDataQuery", loaded.queryTimings[0].queryName);
+  EXPECT_EQ(std::chrono::microseconds(1500), loaded.queryTimings[0].duration);
+}
+
+TEST_F(SessionSnapshotTest, loadingASavedSnapshotShouldRoundTripPluginFilters) {
+  SessionSnapshot snapshot;
+  snapshot.pluginFilters.conflictsPluginName = "Blank.esm";
+  snapshot.pluginFilters.conflictingPluginNames = {"Blank.esm", "Blank.esp"};
+  snapshot.pluginFilters.groupName = "group1";
+  snapshot.pluginFilters.content = "Bla.k";
+  snapshot.pluginFilters.isContentRegex = true;
+
+  saveSessionSnapshot(snapshot, snapshotPath_);
+  const auto loaded = loadSessionSnapshot(snapshotPath_);
+
+  EXPECT_EQ(std::optional<std::string>("Blank.esm"),
+            loaded.pluginFilters.conflictsPluginName);
+  EXPECT_EQ(std::vector<std::string>({"Blank.esm", "Blank.esp"}),
+            loaded.pluginFilters.conflictingPluginNames);
+  EXPECT_EQ(std::optional<std::string>("group1"),
+            loaded.pluginFilters.groupName);
+  EXPECT_EQ("Bla.k", loaded.pluginFilters.content);
+  EXPECT_TRUE(loaded.pluginFilters.isContentRegex);
+}
+
+TEST_F(SessionSnapshotTest,
+       loadingASavedSnapshotWithNoPluginFiltersShouldLeaveThemUnset) {
+  saveSessionSnapshot(SessionSnapshot(), snapshotPath_);
+  const auto loaded = loadSessionSnapshot(snapshotPath_);
+
+  EXPECT_FALSE(loaded.pluginFilters.conflictsPluginName.has_value());
+  EXPECT_TRUE(loaded.pluginFilters.conflictingPluginNames.empty());
+  EXPECT_FALSE(loaded.pluginFilters.groupName.has_value());
+  EXPECT_TRUE(loaded.pluginFilters.content.empty());
+  EXPECT_FALSE(loaded.pluginFilters.isContentRegex);
+}
+
+TEST_F(SessionSnapshotTest, loadingASnapshotWithAnUnknownGameTypeShouldThrow) {
+  std::ofstream out(snapshotPath_);
+  out << "formatVersion = 1" << std::endl
+      << "[generalInformation]" << std::endl
+      << "gameType = 1000" << std::endl;
+  out.close();
+
+  EXPECT_THROW(loadSessionSnapshot(snapshotPath_), std::runtime_error);
+}
+
+TEST_F(SessionSnapshotTest,
+       loadingASnapshotWithAnUnsupportedFormatVersionShouldThrow) {
+  std::ofstream out(snapshotPath_);
+  out << "formatVersion = 2" << std::endl;
+  out.close();
+
+  EXPECT_THROW(loadSessionSnapshot(snapshotPath_), std::runtime_error);
+}
+
+TEST_F(SessionSnapshotTest, loadingANonExistentSnapshotShouldThrow) {
+  EXPECT_THROW(loadSessionSnapshot(snapshotPath_), std::runtime_error);
+}
+}
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_SHARED_FILE_CACHE_TEST
+#define LOOT_TESTS_GUI_QT_SHARED_FILE_CACHE_TEST
+
+#include <gtest/gtest.h>
+#include <loot/exception/file_access_error.h>
+
+#include "gui/qt/helpers.h"
+#include "gui/qt/shared_file_cache.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class SharedFileCacheTest : public ::testing::Test {
+protected:
+  SharedFileCacheTest() : cachePath_(getTempPath()) {}
+
+  void TearDown() override { std::filesystem::remove_all(cachePath_); }
+
+  const std::filesystem::path cachePath_;
+};
+
+TEST_F(SharedFileCacheTest, constructorShouldCreateTheCacheDirectory) {
+  SharedFileCache cache(cachePath_);
+
+  EXPECT_TRUE(std::filesystem::is_directory(cachePath_));
+}
+
+TEST_F(SharedFileCacheTest, getEntryShouldReturnNulloptForAnUnknownSource) {
+  SharedFileCache cache(cachePath_);
+
+  EXPECT_FALSE(cache.getEntry("https://example.com/masterlist.yaml"));
+}
+
+TEST_F(SharedFileCacheTest, storeShouldReturnTheDataBlobHash) {
+  SharedFileCache cache(cachePath_);
+  const auto data = QByteArray("some text to hash");
+
+  const auto blobHash =
+      cache.store("https://example.com/masterlist.yaml", data, "\"etag\"");
+
+  EXPECT_EQ(calculateGitBlobHash(data), blobHash);
+}
+
+TEST_F(SharedFileCacheTest, storedDataShouldBeReadableByAnotherCacheInstance) {
+  const auto source = std::string("https://example.com/masterlist.yaml");
+  const auto data = QByteArray("some text to hash");
+  SharedFileCache(cachePath_).store(source, data, "\"etag\"");
+
+  SharedFileCache otherCache(cachePath_);
+  const auto entry = otherCache.getEntry(source);
+
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(calculateGitBlobHash(data), entry.value().blobHash);
+  EXPECT_EQ("\"etag\"", entry.value().etag);
+  EXPECT_EQ(static_cast<int64_t>(data.size()), entry.value().size);
+  EXPECT_EQ(data, otherCache.readBlob(entry.value()));
+}
+
+TEST_F(SharedFileCacheTest, storeShouldReplaceASourcesExistingEntry) {
+  const auto source = std::string("https://example.com/masterlist.yaml");
+  SharedFileCache cache(cachePath_);
+
+  cache.store(source, QByteArray("old"), "\"1\"");
+  const auto blobHash = cache.store(source, QByteArray("new"), "\"2\"");
+
+  const auto entry = cache.getEntry(source);
+
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(blobHash, entry.value().blobHash);
+  EXPECT_EQ("\"2\"", entry.value().etag);
+}
+
+TEST_F(SharedFileCacheTest, identicalDataFromDifferentSourcesShouldShareABlob) {
+  SharedFileCache cache(cachePath_);
+  const auto data = QByteArray("some text to hash");
+
+  cache.store("https://example.com/a.yaml", data, "");
+  cache.store("https://example.com/b.yaml", data, "");
+
+  size_t blobCount = 0;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(cachePath_ / "blobs")) {
+    if (entry.is_regular_file()) {
+      blobCount += 1;
+    }
+  }
+
+  EXPECT_EQ(1, blobCount);
+}
+
+TEST_F(SharedFileCacheTest, readBlobShouldThrowIfTheBlobHasBeenCorrupted) {
+  SharedFileCache cache(cachePath_);
+  const auto blobHash = cache.store(
+      "https://example.com/masterlist.yaml", QByteArray("complete"), "");
+
+  std::ofstream out(cachePath_ / "blobs" / blobHash,
+                    std::ios_base::out | std::ios_base::trunc);
+  out << "compl";
+  out.close();
+
+  const auto entry = cache.getEntry("https://example.com/masterlist.yaml");
+  ASSERT_TRUE(entry.has_value());
+
+  EXPECT_THROW(cache.readBlob(entry.value()), FileAccessError);
+}
+}
+}
+
+#endif
@@ -101,6 +101,28 @@ TEST(QueryTask, executeShouldEmitAFinishedIfQueryExecutionSucceeds) {
   EXPECT_EQ("1", std::get<PluginItem>(result).name);
 }
 
+TEST(QueryTask, executeShouldEmitTheQueryTimingIfQueryExecutionSucceeds) {
+  auto task = QueryTask(std::make_unique<TestQuery>(1));
+  auto timedSpy = QSignalSpy(&task, &QueryTask::timed);
+
+  task.execute();
+
+  ASSERT_EQ(1, timedSpy.count());
+
+  const auto timing = timedSpy.takeFirst().at(0).value<QueryTiming>();
+  EXPECT_EQ("loot::test::TestQuery", timing.queryName);
+  EXPECT_LE(0, timing.duration.count());
+}
+
+TEST(QueryTask, executeShouldNotEmitAQueryTimingIfQueryExecutionFails) {
+  auto task = QueryTask(std::make_unique<TestQuery>(-1));
+  auto timedSpy = QSignalSpy(&task, &QueryTask::timed);
+
+  task.execute();
+
+  EXPECT_EQ(0, timedSpy.count());
+}
+
 TEST(TaskExecutor, shouldRunEachTaskOnceInSeries) {
   std::vector<Task*> tasks;
   std::vector<std::unique_ptr<QSignalSpy>> taskFinishedSpies;
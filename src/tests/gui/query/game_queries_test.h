@@ -0,0 +1,196 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QUERY_GAME_QUERIES_TEST
+#define LOOT_TESTS_GUI_QUERY_GAME_QUERIES_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/query/types/apply_sort_query.h"
+#include "gui/query/types/evaluate_plugin_details_query.h"
+#include "gui/query/types/get_conflicting_plugins_query.h"
+#include "gui/query/types/get_game_data_query.h"
+#include "gui/query/types/sort_plugins_query.h"
+#include "tests/gui/state/game/in_memory_game.h"
+
+namespace loot {
+namespace test {
+class GameQueriesTest : public ::testing::Test {
+protected:
+  static void ignoreProgress(std::string) {}
+
+  static std::vector<PluginItem> getGameData(InMemoryGame& game) {
+    GetGameDataQuery<InMemoryGame> query(game, ignoreProgress);
+
+    return std::get<PluginItems>(query.executeLogic());
+  }
+};
+
+TEST_F(GameQueriesTest,
+       getGameDataShouldReturnUnevaluatedItemsForAllPluginsInLoadOrder) {
+  InMemoryGameOptions options;
+  options.pluginCount = 10;
+  options.masterCount = 2;
+  options.groupCount = 3;
+  options.messagesPerPlugin = 2;
+  options.inactivePluginInterval = 5;
+  InMemoryGame game(options);
+
+  const auto items = getGameData(game);
+
+  ASSERT_EQ(10, items.size());
+  EXPECT_EQ("Master0.esm", items[0].name);
+  EXPECT_EQ("Master1.esm", items[1].name);
+  EXPECT_EQ("Plugin2.esp", items[2].name);
+  EXPECT_EQ("Plugin9.esp", items[9].name);
+
+  for (const auto& item : items) {
+    EXPECT_FALSE(item.detailsEvaluated);
+    EXPECT_TRUE(item.messages.empty());
+    EXPECT_TRUE(item.group.has_value());
+  }
+
+  EXPECT_EQ(0, items[0].loadOrderIndex);
+  EXPECT_EQ(3, items[3].loadOrderIndex);
+  EXPECT_FALSE(items[4].isActive);
+  EXPECT_FALSE(items[4].loadOrderIndex.has_value());
+  EXPECT_EQ(4, items[5].loadOrderIndex);
+}
+
+TEST_F(GameQueriesTest,
+       evaluatePluginDetailsShouldIncludeMetadataAndValidityMessages) {
+  InMemoryGameOptions options;
+  options.pluginCount = 4;
+  options.messagesPerPlugin = 3;
+  options.tagsPerPlugin = 2;
+  options.locationsPerPlugin = 1;
+  options.dirtyPluginInterval = 2;
+  options.invalidPluginInterval = 4;
+  InMemoryGame game(options);
+  game.LoadAllInstalledPlugins(true);
+
+  EvaluatePluginDetailsQuery<InMemoryGame> query(
+      game, "en", {"Plugin0.esp", "Plugin1.esp", "Plugin3.esp"});
+  const auto items = std::get<PluginItems>(query.executeLogic());
+
+  ASSERT_EQ(3, items.size());
+
+  EXPECT_TRUE(items[0].detailsEvaluated);
+  EXPECT_FALSE(items[0].isDirty);
+  EXPECT_EQ(3, items[0].messages.size());
+  EXPECT_EQ(std::vector<std::string>({"Tag0", "Tag1"}), items[0].currentTags);
+  EXPECT_EQ(std::vector<std::string>({"Tag0"}), items[0].addTags);
+  EXPECT_EQ(std::vector<std::string>({"Tag1"}), items[0].removeTags);
+  ASSERT_EQ(1, items[0].locations.size());
+  EXPECT_EQ("Location", items[0].locations[0].GetName());
+
+  EXPECT_TRUE(items[1].isDirty);
+  EXPECT_EQ(4, items[1].messages.size());
+
+  // Plugin3.esp is dirty and has a missing master.
+  EXPECT_TRUE(items[2].isDirty);
+  ASSERT_EQ(5, items[2].messages.size());
+  EXPECT_EQ(MessageType::error, items[2].messages[3].type);
+}
+
+TEST_F(GameQueriesTest, sortPluginsShouldReturnItemsInGroupOrder) {
+  InMemoryGameOptions options;
+  options.pluginCount = 6;
+  options.masterCount = 1;
+  options.groupCount = 2;
+  InMemoryGame game(options);
+  game.LoadAllInstalledPlugins(true);
+  UnappliedChangeCounter counter;
+
+  SortPluginsQuery<InMemoryGame> query(game, counter, "en", ignoreProgress);
+  const auto items = std::get<PluginItems>(query.executeLogic());
+
+  ASSERT_EQ(6, items.size());
+  EXPECT_EQ("Master0.esm", items[0].name);
+  EXPECT_EQ("Plugin1.esp", items[1].name);
+  EXPECT_EQ("Plugin3.esp", items[2].name);
+  EXPECT_EQ("Plugin5.esp", items[3].name);
+  EXPECT_EQ("Plugin2.esp", items[4].name);
+  EXPECT_EQ("Plugin4.esp", items[5].name);
+  EXPECT_EQ(3, items[3].loadOrderIndex);
+  EXPECT_TRUE(counter.HasUnappliedChanges());
+
+  std::vector<std::string> sortedNames;
+  for (const auto& item : items) {
+    sortedNames.push_back(item.name);
+  }
+
+  ApplySortQuery<InMemoryGame> applyQuery(game, counter, sortedNames);
+  applyQuery.executeLogic();
+
+  EXPECT_EQ(sortedNames, game.GetLoadOrder());
+  EXPECT_FALSE(counter.HasUnappliedChanges());
+}
+
+TEST_F(GameQueriesTest,
+       getConflictingPluginsShouldFlagPluginsInTheSameOverlapGroup) {
+  InMemoryGameOptions options;
+  options.pluginCount = 9;
+  options.overlapGroupSize = 3;
+  InMemoryGame game(options);
+  game.LoadAllInstalledPlugins(true);
+
+  GetConflictingPluginsQuery<InMemoryGame> query(game, "en", "Plugin4.esp");
+  const auto result =
+      std::get<GetConflictingPluginsResult>(query.executeLogic());
+
+  ASSERT_EQ(9, result.size());
+  for (size_t i = 0; i < result.size(); i += 1) {
+    EXPECT_EQ(i >= 3 && i < 6, result[i].second) << result[i].first.name;
+  }
+
+  EXPECT_TRUE(game.ArePluginsFullyLoaded());
+  const auto cachedNames = game.GetCachedConflictingPluginNames("Plugin4.esp");
+  ASSERT_TRUE(cachedNames.has_value());
+  EXPECT_EQ(std::vector<std::string>(
+                {"Plugin3.esp", "Plugin4.esp", "Plugin5.esp"}),
+            cachedNames.value());
+}
+
+TEST_F(GameQueriesTest, getGameDataShouldHandleTensOfThousandsOfPlugins) {
+  InMemoryGameOptions options;
+  options.pluginCount = 20000;
+  options.masterCount = 100;
+  options.groupCount = 50;
+  options.messagesPerPlugin = 1;
+  options.lightPluginInterval = 3;
+  InMemoryGame game(options);
+
+  const auto items = getGameData(game);
+
+  ASSERT_EQ(20000, items.size());
+  EXPECT_EQ("Plugin19999.esp", items.back().name);
+  EXPECT_TRUE(items[2].isLightPlugin);
+  EXPECT_FALSE(items[3].isLightPlugin);
+}
+}
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QUERY_GET_GAME_DATA_QUERY_TEST
+#define LOOT_TESTS_GUI_QUERY_GET_GAME_DATA_QUERY_TEST
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include "gui/query/types/get_game_data_query.h"
+#include "tests/common_game_test_fixture.h"
+
+namespace loot {
+namespace test {
+class GetGameDataQueryTest : public CommonGameTestFixture {
+protected:
+  static constexpr size_t SYNTHETIC_PLUGIN_COUNT = 50;
+  static constexpr size_t MASTERLIST_ENTRIES_PER_PLUGIN = 4;
+
+  GetGameDataQueryTest() :
+      gameSettings_(GameSettings(GetParam(), "game")
+                        .SetMinimumHeaderVersion(0.0f)
+                        .SetGamePath(dataPath.parent_path())
+                        .SetGameLocalPath(localPath)) {}
+
+  void SetUp() override {
+    for (size_t i = 0; i < SYNTHETIC_PLUGIN_COUNT; i += 1) {
+      std::filesystem::copy_file(dataPath / blankEsp,
+                                 dataPath / getSyntheticPluginName(i));
+    }
+  }
+
+  static void ignoreProgress(std::string) {}
+
+  static std::string getSyntheticPluginName(size_t index) {
+    return "Synthetic " + std::to_string(index) + ".esp";
+  }
+
+  // Most of the masterlist's entries are for plugins that aren't installed,
+  // as is the case for real masterlists.
+  void writeMasterlist(const std::filesystem::path& masterlistPath) const {
+    std::ofstream out(masterlistPath);
+    out << "globals:\n"
+        << "  - type: say\n"
+        << "    content: '" << GENERAL_MESSAGE_TEXT << "'\n"
+        << "plugins:\n";
+
+    const auto entryCount =
+        SYNTHETIC_PLUGIN_COUNT * MASTERLIST_ENTRIES_PER_PLUGIN;
+    for (size_t i = 0; i < entryCount; i += 1) {
+      const auto name = i < SYNTHETIC_PLUGIN_COUNT
+                            ? getSyntheticPluginName(i)
+                            : "Uninstalled " + std::to_string(i) + ".esp";
+
+      out << "  - name: '" << name << "'\n"
+          << "    msg:\n"
+          << "      - type: say\n"
+          << "        content: 'A message for " << name << "'\n"
+          << "        condition: 'file(\"" << blankEsm << "\")'\n"
+          << "    tag: [ Delev, Relev, -Names ]\n"
+          << "    dirty:\n"
+          << "      - crc: 0x" << std::hex << i << std::dec << "\n"
+          << "        util: 'TES5Edit'\n"
+          << "        itm: " << i % 10 << "\n";
+    }
+  }
+
+  gui::Game createGame() const {
+    gui::Game game(gameSettings_, lootDataPath, "");
+    game.Init();
+    return game;
+  }
+
+  // Loads the game data the way GetGameDataQuery did before plugin loading
+  // and metadata parsing were done concurrently.
+  static std::vector<PluginItem> getGameDataSequentially(gui::Game& game) {
+    game.LoadAllInstalledPlugins(true);
+    game.LoadMetadata();
+    game.LoadCreationClubPluginNames();
+
+    std::vector<PluginItem> items;
+    for (const auto& plugin : game.GetPluginsInLoadOrder()) {
+      items.push_back(PluginItem(*plugin, game));
+    }
+
+    return items;
+  }
+
+  static std::vector<PluginItem> getGameData(gui::Game& game) {
+    GetGameDataQuery<gui::Game> query(game, ignoreProgress);
+
+    return std::get<PluginItems>(query.executeLogic());
+  }
+
+  static constexpr const char* GENERAL_MESSAGE_TEXT = "A general message";
+
+  const GameSettings gameSettings_;
+};
+
+// Pass an empty first argument, as it's a prefix for the test instantation,
+// but we only have the one so no prefix is necessary.
+INSTANTIATE_TEST_SUITE_P(,
+                         GetGameDataQueryTest,
+                         ::testing::Values(GameType::tes5se));
+
+TEST_P(GetGameDataQueryTest,
+       executeLogicShouldLoadTheSamePluginsAndMetadataAsInSequence) {
+  {
+    auto game = createGame();
+    writeMasterlist(game.MasterlistPath());
+  }
+
+  auto sequentialGame = createGame();
+  const auto sequentialItems = getGameDataSequentially(sequentialGame);
+
+  auto concurrentGame = createGame();
+  const auto concurrentItems = getGameData(concurrentGame);
+
+  ASSERT_EQ(sequentialItems.size(), concurrentItems.size());
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, concurrentItems.size());
+  for (size_t i = 0; i < concurrentItems.size(); i += 1) {
+    EXPECT_EQ(sequentialItems[i].name, concurrentItems[i].name);
+  }
+
+  for (size_t i = 0; i < SYNTHETIC_PLUGIN_COUNT; i += 1) {
+    EXPECT_TRUE(concurrentGame.GetMasterlistMetadata(getSyntheticPluginName(i))
+                    .has_value());
+  }
+}
+
+TEST_P(GetGameDataQueryTest,
+       executeLogicShouldPublishGeneralMessagesOnceTheMetadataIsParsed) {
+  auto game = createGame();
+  writeMasterlist(game.MasterlistPath());
+
+  getGameData(game);
+
+  const auto messages = game.GetStateSnapshot()->messages;
+  EXPECT_EQ(game.GetMessages(), messages);
+
+  const auto generalMessageCount =
+      std::count_if(messages.begin(), messages.end(), [](const auto& message) {
+        return message.GetContent().front().GetText() == GENERAL_MESSAGE_TEXT;
+      });
+  EXPECT_EQ(1, generalMessageCount);
+}
+
+TEST_P(GetGameDataQueryTest,
+       executeLogicShouldAddAMessageIfTheMasterlistCouldNotBeParsed) {
+  auto game = createGame();
+  std::ofstream out(game.MasterlistPath());
+  out << "plugins: [";
+  out.close();
+
+  const auto items = getGameData(game);
+
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, items.size());
+
+  const auto messages = game.GetMessages();
+  const auto errorCount =
+      std::count_if(messages.begin(), messages.end(), [](const auto& message) {
+        return message.GetType() == MessageType::error;
+      });
+  EXPECT_EQ(1, errorCount);
+}
+
+TEST_P(GetGameDataQueryTest,
+       executeLogicShouldNotParseTheMetadataListsIfPluginsAreAlreadyLoaded) {
+  auto game = createGame();
+  game.LoadAllInstalledPlugins(true);
+  writeMasterlist(game.MasterlistPath());
+
+  const auto items = getGameData(game);
+
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, items.size());
+  EXPECT_FALSE(
+      game.GetMasterlistMetadata(getSyntheticPluginName(0)).has_value());
+}
+}
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_CARD_SIZES_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_CARD_SIZES_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/state/game/card_sizes.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class CardSizesTest : public ::testing::Test {
+protected:
+  CardSizesTest() :
+      rootPath_(getTempPath()), filePath_(rootPath_ / "card_sizes.bin") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  void writeBytes(const std::filesystem::path& path,
+                  const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios_base::trunc);
+
+    for (const auto byte : bytes) {
+      out.put(byte);
+    }
+  }
+
+  const std::filesystem::path rootPath_;
+  const std::filesystem::path filePath_;
+};
+
+TEST_F(CardSizesTest, loadShouldReturnNoSizesIfFileDoesNotExist) {
+  const auto cardSizes = LoadCardSizes(filePath_);
+
+  EXPECT_TRUE(cardSizes.signature.empty());
+  EXPECT_TRUE(cardSizes.sizes.empty());
+}
+
+TEST_F(CardSizesTest, loadShouldThrowIfFileMagicNumberIsUnexpected) {
+  writeBytes(filePath_, {'\xDE', '\xAD', '\xBE', '\xEF'});
+
+  EXPECT_THROW(LoadCardSizes(filePath_), std::runtime_error);
+}
+
+TEST_F(CardSizesTest, loadShouldThrowIfFileFormatVersionIsUnrecognised) {
+  writeBytes(filePath_, {'\x4C', '\x43', '\x53', '\x5A', '\x0'});
+
+  EXPECT_THROW(LoadCardSizes(filePath_), std::runtime_error);
+}
+
+TEST_F(CardSizesTest, loadShouldThrowIfTheSignatureIsTruncated) {
+  writeBytes(filePath_, {'\x4C', '\x43', '\x53', '\x5A', '\x1', '\x5', '\x0'});
+
+  EXPECT_THROW(LoadCardSizes(filePath_), std::runtime_error);
+}
+
+TEST_F(CardSizesTest, loadShouldAcceptDataWrittenBySave) {
+  CardSizes original;
+  original.signature = "font;1;96;en";
+  original.sizes = {CardSize{0x0123456789ABCDEF, 300, {{600, 120}, {800, 96}}},
+                    CardSize{42, 250, {}}};
+
+  SaveCardSizes(filePath_, original);
+
+  const auto cardSizes = LoadCardSizes(filePath_);
+
+  EXPECT_EQ(original.signature, cardSizes.signature);
+  ASSERT_EQ(2, cardSizes.sizes.size());
+
+  EXPECT_EQ(original.sizes[0].contentHash, cardSizes.sizes[0].contentHash);
+  EXPECT_EQ(300, cardSizes.sizes[0].minWidth);
+  EXPECT_EQ(original.sizes[0].heightsForWidths,
+            cardSizes.sizes[0].heightsForWidths);
+
+  EXPECT_EQ(uint64_t{42}, cardSizes.sizes[1].contentHash);
+  EXPECT_EQ(250, cardSizes.sizes[1].minWidth);
+  EXPECT_TRUE(cardSizes.sizes[1].heightsForWidths.empty());
+}
+
+TEST_F(CardSizesTest, saveShouldThrowIfFileCannotBeOpened) {
+  const auto path = rootPath_ / "missing.dir";
+
+  std::filesystem::create_directory(path);
+
+  EXPECT_THROW(SaveCardSizes(path, {}), std::runtime_error);
+}
+}
+}
+
+#endif
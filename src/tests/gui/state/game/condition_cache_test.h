@@ -0,0 +1,223 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_CONDITION_CACHE_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_CONDITION_CACHE_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "gui/state/game/condition_cache.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class ConditionCacheTest : public ::testing::Test {
+protected:
+  ConditionCacheTest() :
+      rootPath_(getTempPath()),
+      dataPath_(rootPath_ / "Data"),
+      filePath_(rootPath_ / "condition_cache.bin") {}
+
+  void SetUp() override { std::filesystem::create_directories(dataPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  void writeFile(const std::filesystem::path& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary | std::ios_base::trunc);
+    out << text;
+  }
+
+  const std::filesystem::path rootPath_;
+  const std::filesystem::path dataPath_;
+  const std::filesystem::path filePath_;
+};
+
+TEST_F(ConditionCacheTest, loadShouldReturnNoResultsIfFileDoesNotExist) {
+  const auto cache = LoadConditionCache(filePath_);
+
+  EXPECT_TRUE(cache.signature.empty());
+  EXPECT_TRUE(cache.results.empty());
+}
+
+TEST_F(ConditionCacheTest, loadShouldThrowIfFileMagicNumberIsUnexpected) {
+  writeFile(filePath_, "\xDE\xAD\xBE\xEF");
+
+  EXPECT_THROW(LoadConditionCache(filePath_), std::runtime_error);
+}
+
+TEST_F(ConditionCacheTest, loadShouldThrowIfAResultIsTruncated) {
+  ConditionCache cache;
+  cache.signature = "signature";
+  cache.results.emplace("file(\"Blank.esp\")", CachedConditionResult{1, true});
+
+  SaveConditionCache(filePath_, cache);
+  std::filesystem::resize_file(filePath_,
+                               std::filesystem::file_size(filePath_) - 1);
+
+  EXPECT_THROW(LoadConditionCache(filePath_), std::runtime_error);
+}
+
+TEST_F(ConditionCacheTest, loadShouldReadWhatWasSaved) {
+  ConditionCache cache;
+  cache.signature = "0.18.1+abcdef\nC:\\Games\\Skyrim\\Data";
+  cache.results.emplace("file(\"Blank.esp\")",
+                        CachedConditionResult{0x0123456789ABCDEF, true});
+  cache.results.emplace("checksum(\"Blank.esm\", 187BE342)",
+                        CachedConditionResult{42, false});
+
+  SaveConditionCache(filePath_, cache);
+  const auto loadedCache = LoadConditionCache(filePath_);
+
+  EXPECT_EQ(cache.signature, loadedCache.signature);
+  ASSERT_EQ(2, loadedCache.results.size());
+
+  const auto& fileResult = loadedCache.results.at("file(\"Blank.esp\")");
+  EXPECT_EQ(uint64_t{0x0123456789ABCDEF}, fileResult.fingerprint);
+  EXPECT_TRUE(fileResult.result);
+
+  const auto& checksumResult =
+      loadedCache.results.at("checksum(\"Blank.esm\", 187BE342)");
+  EXPECT_EQ(uint64_t{42}, checksumResult.fingerprint);
+  EXPECT_FALSE(checksumResult.result);
+}
+
+TEST(GetConditionPaths, shouldReturnQuotedStrings) {
+  const auto paths = GetConditionPaths(
+      "file(\"Blank.esm\") and not version(\"Blank.esp\", \"1.0\", >)");
+
+  EXPECT_EQ(std::vector<std::string>({"1.0", "Blank.esm", "Blank.esp"}),
+            paths);
+}
+
+TEST(GetConditionPaths, shouldAlsoReturnTheParentPathOfARegex) {
+  const auto paths = GetConditionPaths("many(\"meshes/Blank.*\\.nif\")");
+
+  EXPECT_EQ(std::vector<std::string>({"meshes", "meshes/Blank.*\\.nif"}),
+            paths);
+}
+
+TEST(GetConditionPaths, shouldReturnAnEmptyParentPathForARegexWithNoSlashes) {
+  const auto paths = GetConditionPaths("file(\"Blank.*\\.esp\")");
+
+  EXPECT_EQ(std::vector<std::string>({"", "Blank.*\\.esp"}), paths);
+}
+
+TEST_F(ConditionCacheTest,
+       conditionFingerprintShouldChangeWhenAReadFileIsCreatedOrChanged) {
+  const std::string condition = "checksum(\"Blank.esp\", 187BE342)";
+
+  const auto missingFingerprint =
+      GetConditionFingerprint(condition, dataPath_, 0);
+
+  writeFile(dataPath_ / "Blank.esp", "content");
+  const auto createdFingerprint =
+      GetConditionFingerprint(condition, dataPath_, 0);
+
+  writeFile(dataPath_ / "Blank.esp", "changed content");
+  const auto changedFingerprint =
+      GetConditionFingerprint(condition, dataPath_, 0);
+
+  EXPECT_NE(missingFingerprint, createdFingerprint);
+  EXPECT_NE(createdFingerprint, changedFingerprint);
+  EXPECT_EQ(changedFingerprint,
+            GetConditionFingerprint(condition, dataPath_, 0));
+}
+
+TEST_F(ConditionCacheTest,
+       conditionFingerprintShouldChangeWhenAReadPluginIsGhosted) {
+  const std::string condition = "file(\"Blank.esp\")";
+
+  const auto fingerprint = GetConditionFingerprint(condition, dataPath_, 0);
+
+  writeFile(dataPath_ / "Blank.esp.ghost", "content");
+
+  EXPECT_NE(fingerprint, GetConditionFingerprint(condition, dataPath_, 0));
+}
+
+TEST_F(ConditionCacheTest,
+       conditionFingerprintShouldNotChangeWhenAnUnreadFileChanges) {
+  const std::string condition = "file(\"Blank.esp\")";
+
+  const auto fingerprint = GetConditionFingerprint(condition, dataPath_, 0);
+
+  writeFile(dataPath_ / "Blank.esm", "content");
+
+  EXPECT_EQ(fingerprint, GetConditionFingerprint(condition, dataPath_, 0));
+}
+
+TEST_F(ConditionCacheTest,
+       conditionFingerprintShouldChangeWhenAFileMatchingARegexIsCreated) {
+  const std::string condition = "file(\"Blank.*\\.esp\")";
+
+  const auto fingerprint = GetConditionFingerprint(condition, dataPath_, 0);
+
+  // Make sure the directory's modification time can't be unchanged because
+  // of timestamp resolution.
+  const auto writeTime = std::filesystem::last_write_time(dataPath_);
+  writeFile(dataPath_ / "Blank.esp", "content");
+  std::filesystem::last_write_time(dataPath_,
+                                   writeTime + std::chrono::seconds(10));
+
+  EXPECT_NE(fingerprint, GetConditionFingerprint(condition, dataPath_, 0));
+}
+
+TEST_F(ConditionCacheTest,
+       conditionFingerprintShouldOnlyDependOnActivePluginsIfTheyAreChecked) {
+  const auto activeFingerprint1 = GetActivePluginsFingerprint({"Blank.esm"});
+  const auto activeFingerprint2 =
+      GetActivePluginsFingerprint({"Blank.esm", "Blank.esp"});
+
+  EXPECT_NE(activeFingerprint1, activeFingerprint2);
+
+  const std::string fileCondition = "file(\"Blank.esp\")";
+  const std::string activeCondition = "active(\"Blank.esp\")";
+
+  EXPECT_EQ(
+      GetConditionFingerprint(fileCondition, dataPath_, activeFingerprint1),
+      GetConditionFingerprint(fileCondition, dataPath_, activeFingerprint2));
+  EXPECT_NE(
+      GetConditionFingerprint(activeCondition, dataPath_, activeFingerprint1),
+      GetConditionFingerprint(activeCondition, dataPath_, activeFingerprint2));
+}
+
+TEST_F(ConditionCacheTest, pathsFingerprintShouldChangeWhenAFileIsModified) {
+  const auto path = dataPath_ / "Blank.esp";
+  writeFile(path, "content");
+
+  const auto fingerprint = GetPathsFingerprint({dataPath_, path});
+
+  EXPECT_EQ(fingerprint, GetPathsFingerprint({dataPath_, path}));
+
+  const auto writeTime = std::filesystem::last_write_time(path);
+  std::filesystem::last_write_time(path, writeTime + std::chrono::seconds(10));
+
+  EXPECT_NE(fingerprint, GetPathsFingerprint({dataPath_, path}));
+}
+}
+}
+
+#endif
@@ -0,0 +1,218 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_EVALUATION_COSTS_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_EVALUATION_COSTS_TEST
+
+#include <gtest/gtest.h>
+#include <toml++/toml.h>
+
+#include <fstream>
+#include <thread>
+
+#include "gui/plugin_item.h"
+#include "gui/state/game/evaluation_costs.h"
+#include "tests/gui/state/game/in_memory_game.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+using std::chrono::milliseconds;
+
+PluginEvaluationCost makePluginEvaluationCost(const std::string& pluginName,
+                                              milliseconds duration) {
+  PluginEvaluationCost cost;
+  cost.pluginName = pluginName;
+  cost.metadataEvaluation = duration;
+
+  return cost;
+}
+
+TEST(EvaluationCostRecorder, getReportShouldSortPluginsByDescendingTotal) {
+  EvaluationCostRecorder recorder;
+  recorder.RecordPlugin(makePluginEvaluationCost("A.esp", milliseconds(1)));
+  recorder.RecordPlugin(makePluginEvaluationCost("B.esp", milliseconds(3)));
+
+  auto cost = makePluginEvaluationCost("C.esp", milliseconds(1));
+  cost.tagCollection = milliseconds(1);
+  recorder.RecordPlugin(cost);
+
+  const auto report = recorder.GetReport();
+
+  ASSERT_EQ(3, report.slowestPlugins.size());
+  EXPECT_EQ("B.esp", report.slowestPlugins[0].pluginName);
+  EXPECT_EQ("C.esp", report.slowestPlugins[1].pluginName);
+  EXPECT_EQ("A.esp", report.slowestPlugins[2].pluginName);
+  EXPECT_EQ(milliseconds(2), report.slowestPlugins[1].GetTotal());
+}
+
+TEST(EvaluationCostRecorder, getReportShouldOnlyIncludeTheGivenNumberOfCosts) {
+  EvaluationCostRecorder recorder;
+  for (int i = 0; i < 10; i += 1) {
+    const auto name = std::to_string(i);
+    recorder.RecordPlugin(makePluginEvaluationCost(name, milliseconds(i)));
+    recorder.RecordCondition(name, milliseconds(i));
+  }
+
+  const auto report = recorder.GetReport(2);
+
+  ASSERT_EQ(2, report.slowestPlugins.size());
+  EXPECT_EQ("9", report.slowestPlugins[0].pluginName);
+  EXPECT_EQ("8", report.slowestPlugins[1].pluginName);
+  ASSERT_EQ(2, report.mostExpensiveConditions.size());
+  EXPECT_EQ("9", report.mostExpensiveConditions[0].condition);
+  EXPECT_EQ("8", report.mostExpensiveConditions[1].condition);
+}
+
+TEST(EvaluationCostRecorder, recordPluginShouldReplaceAnExistingCost) {
+  EvaluationCostRecorder recorder;
+  recorder.RecordPlugin(makePluginEvaluationCost("A.esp", milliseconds(5)));
+  recorder.RecordPlugin(makePluginEvaluationCost("A.esp", milliseconds(1)));
+
+  const auto report = recorder.GetReport();
+
+  ASSERT_EQ(1, report.slowestPlugins.size());
+  EXPECT_EQ(milliseconds(1), report.slowestPlugins[0].GetTotal());
+}
+
+TEST(EvaluationCostRecorder, recordConditionShouldSumDurations) {
+  EvaluationCostRecorder recorder;
+  recorder.RecordCondition("file(\"A.esp\")", milliseconds(3));
+  recorder.RecordCondition("file(\"B.esp\")", milliseconds(4));
+  recorder.RecordCondition("file(\"A.esp\")", milliseconds(2));
+
+  const auto report = recorder.GetReport();
+
+  ASSERT_EQ(2, report.mostExpensiveConditions.size());
+  EXPECT_EQ("file(\"A.esp\")", report.mostExpensiveConditions[0].condition);
+  EXPECT_EQ(milliseconds(5), report.mostExpensiveConditions[0].duration);
+  EXPECT_EQ(2, report.mostExpensiveConditions[0].evaluationCount);
+  EXPECT_EQ(1, report.mostExpensiveConditions[1].evaluationCount);
+}
+
+TEST(EvaluationCostRecorder, clearShouldRemoveAllCosts) {
+  EvaluationCostRecorder recorder;
+  recorder.RecordPlugin(makePluginEvaluationCost("A.esp", milliseconds(1)));
+  recorder.RecordCondition("file(\"A.esp\")", milliseconds(1));
+
+  recorder.Clear();
+  const auto report = recorder.GetReport();
+
+  EXPECT_TRUE(report.slowestPlugins.empty());
+  EXPECT_TRUE(report.mostExpensiveConditions.empty());
+}
+
+TEST(EvaluationCostRecorder,
+     aSlowConditionAndThePluginThatUsesItShouldRankFirst) {
+  static constexpr size_t PLUGIN_COUNT = 200;
+  static constexpr size_t SLOW_PLUGIN_INDEX = 123;
+  static constexpr milliseconds SLOW_CONDITION_DURATION(50);
+  const std::string slowCondition = "file(\"Slow.esp\")";
+
+  InMemoryGameOptions options;
+  options.pluginCount = PLUGIN_COUNT;
+  options.messagesPerPlugin = 2;
+  options.tagsPerPlugin = 2;
+  InMemoryGame game(options);
+
+  // Give every plugin conditional metadata so that the slow condition is
+  // competing against the cost of evaluating many fast ones.
+  const auto plugins = game.GetPluginsInLoadOrder();
+  std::string slowPluginName;
+  for (size_t i = 0; i < plugins.size(); i += 1) {
+    const auto& name = plugins[i]->GetName();
+    const auto condition =
+        i == SLOW_PLUGIN_INDEX ? slowCondition : "file(\"" + name + "\")";
+    if (i == SLOW_PLUGIN_INDEX) {
+      slowPluginName = name;
+    }
+
+    PluginMetadata metadata(name);
+    metadata.SetMessages(
+        {Message(MessageType::say, "Conditional message", condition)});
+    metadata.SetTags({Tag("Relev", true, condition)});
+    game.AddUserMetadata(metadata);
+  }
+
+  game.SetConditionEvaluator([&](const std::string& condition) {
+    if (condition == slowCondition) {
+      std::this_thread::sleep_for(SLOW_CONDITION_DURATION);
+    }
+    return true;
+  });
+
+  game.LoadAllInstalledPlugins(false);
+  for (const auto plugin : game.GetPluginsInLoadOrder()) {
+    PluginItem(*plugin, game, "en");
+  }
+
+  const auto report = game.GetEvaluationCosts().GetReport(5);
+
+  ASSERT_EQ(5, report.slowestPlugins.size());
+  EXPECT_EQ(slowPluginName, report.slowestPlugins[0].pluginName);
+  EXPECT_LE(2 * SLOW_CONDITION_DURATION,
+            report.slowestPlugins[0].metadataEvaluation);
+  EXPECT_GT(report.slowestPlugins[0].GetTotal(),
+            report.slowestPlugins[1].GetTotal());
+
+  ASSERT_EQ(5, report.mostExpensiveConditions.size());
+  EXPECT_EQ(slowCondition, report.mostExpensiveConditions[0].condition);
+  EXPECT_EQ(2, report.mostExpensiveConditions[0].evaluationCount);
+}
+
+TEST(SaveEvaluationCostReport, shouldWriteTheCostsAsToml) {
+  const auto filePath = getTempPath() / "LOOTEvaluationCosts.toml";
+  std::filesystem::create_directories(filePath.parent_path());
+
+  EvaluationCostRecorder recorder;
+  auto cost = makePluginEvaluationCost("A.esp", milliseconds(2));
+  cost.bashTagsFileCheck = milliseconds(1);
+  recorder.RecordPlugin(cost);
+  recorder.RecordCondition("file(\"A.esp\")", milliseconds(3));
+
+  SaveEvaluationCostReport(filePath, recorder.GetReport());
+
+  std::ifstream in(filePath);
+  const auto root = toml::parse(in);
+  in.close();
+  std::filesystem::remove_all(filePath.parent_path());
+
+  const auto plugin = root["slowestPlugins"][0];
+  EXPECT_EQ("A.esp", plugin["name"].value_or(std::string()));
+  EXPECT_EQ(3000, plugin["totalMicroseconds"].value_or(int64_t{0}));
+  EXPECT_EQ(2000,
+            plugin["metadataEvaluationMicroseconds"].value_or(int64_t{0}));
+  EXPECT_EQ(1000,
+            plugin["bashTagsFileCheckMicroseconds"].value_or(int64_t{0}));
+
+  const auto condition = root["mostExpensiveConditions"][0];
+  EXPECT_EQ("file(\"A.esp\")", condition["condition"].value_or(std::string()));
+  EXPECT_EQ(3000, condition["totalMicroseconds"].value_or(int64_t{0}));
+  EXPECT_EQ(1, condition["evaluationCount"].value_or(int64_t{0}));
+}
+}
+}
+
+#endif
@@ -27,6 +27,7 @@ along with LOOT.  If not, see
 
 #include <fstream>
 
+#include "gui/plugin_item.h"
 #include "gui/state/game/game.h"
 #include "gui/state/game/helpers.h"
 #include "tests/common_game_test_fixture.h"
@@ -604,6 +605,66 @@ TEST_P(GameTest, checkInstallValidityShouldCheckThatAPluginGroupExists) {
       messages);
 }
 
+TEST_P(GameTest,
+       checkBashTagsFileShouldReturnAMessageIfTheFileOverridesSuggestions) {
+  Game game = CreateInitialisedGame("");
+  game.LoadAllInstalledPlugins(true);
+
+  std::filesystem::create_directories(dataPath / "BashTags");
+  std::ofstream out(dataPath / "BashTags" / "Blank.txt");
+  out << "-Relev";
+  out.close();
+
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev"), Tag("Delev")});
+
+  const auto messages =
+      game.CheckBashTagsFile(*game.GetPlugin(blankEsm), metadata);
+
+  ASSERT_EQ(1, messages.size());
+  EXPECT_EQ(MessageType::say, messages[0].GetType());
+}
+
+TEST_P(GameTest, checkBashTagsFileShouldReturnNoMessagesIfThereIsNoFile) {
+  Game game = CreateInitialisedGame("");
+  game.LoadAllInstalledPlugins(true);
+
+  PluginMetadata metadata(blankEsm);
+  metadata.SetTags({Tag("Relev")});
+
+  EXPECT_TRUE(
+      game.CheckBashTagsFile(*game.GetPlugin(blankEsm), metadata).empty());
+}
+
+TEST_P(GameTest,
+       evaluatingPluginDetailsShouldRecordTheCostOfEachConditionOnce) {
+  Game game = CreateInitialisedGame("");
+  game.LoadAllInstalledPlugins(true);
+
+  // The message and tag share a condition, so it should only be evaluated
+  // once.
+  const auto condition = "file(\"" + blankEsp + "\")";
+  PluginMetadata metadata(blankEsm);
+  metadata.SetMessages(
+      {Message(MessageType::say, "Conditional message", condition)});
+  metadata.SetTags({Tag("Relev", true, condition)});
+  game.AddUserMetadata(metadata);
+
+  const PluginItem item(*game.GetPlugin(blankEsm), game, "en");
+  ASSERT_EQ(1, item.messages.size());
+
+  const auto report = game.GetEvaluationCosts().GetReport();
+
+  ASSERT_EQ(1, report.mostExpensiveConditions.size());
+  EXPECT_EQ(condition, report.mostExpensiveConditions[0].condition);
+  EXPECT_EQ(1, report.mostExpensiveConditions[0].evaluationCount);
+
+  ASSERT_EQ(1, report.slowestPlugins.size());
+  EXPECT_EQ(blankEsm, report.slowestPlugins[0].pluginName);
+  EXPECT_LE(report.mostExpensiveConditions[0].duration,
+            report.slowestPlugins[0].metadataEvaluation);
+}
+
 TEST_P(
     GameTest,
     redatePluginsShouldRedatePluginsForSkyrimAndSkyrimSEAndDoNothingForOtherGames) {
@@ -714,6 +775,52 @@ TEST_P(GameTest, pluginsShouldBeFullyLoadedAfterFullyLoadingThem) {
   EXPECT_TRUE(game.ArePluginsFullyLoaded());
 }
 
+TEST_P(GameTest,
+       discardFullPluginDataShouldReloadPluginHeadersAndResetFullyLoadedState) {
+  Game game = CreateInitialisedGame("");
+
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(false));
+  ASSERT_NO_THROW(game.DiscardFullPluginData());
+
+  EXPECT_FALSE(game.ArePluginsFullyLoaded());
+  EXPECT_EQ(12, game.GetPlugins().size());
+
+  auto plugin = game.GetPlugin(blankEsm);
+  ASSERT_NE(nullptr, plugin);
+  EXPECT_EQ("5.0", plugin->GetVersion().value());
+  EXPECT_FALSE(plugin->GetCRC().has_value());
+}
+
+TEST_P(GameTest, getCachedConflictingPluginNamesShouldReturnNulloptByDefault) {
+  Game game = CreateInitialisedGame("");
+
+  EXPECT_FALSE(game.GetCachedConflictingPluginNames(blankEsm).has_value());
+}
+
+TEST_P(GameTest,
+       cachedConflictingPluginNamesShouldBeKeptWhenFullPluginDataIsDiscarded) {
+  Game game = CreateInitialisedGame("");
+
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(false));
+  game.CacheConflictingPluginNames(blankEsm, {blankEsm, blankDifferentEsm});
+  ASSERT_NO_THROW(game.DiscardFullPluginData());
+
+  const auto names = game.GetCachedConflictingPluginNames(blankEsm);
+  ASSERT_TRUE(names.has_value());
+  EXPECT_EQ(std::vector<std::string>({blankEsm, blankDifferentEsm}),
+            names.value());
+}
+
+TEST_P(GameTest,
+       loadAllInstalledPluginsShouldClearCachedConflictingPluginNames) {
+  Game game = CreateInitialisedGame("");
+
+  game.CacheConflictingPluginNames(blankEsm, {blankEsm});
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(true));
+
+  EXPECT_FALSE(game.GetCachedConflictingPluginNames(blankEsm).has_value());
+}
+
 TEST_P(GameTest,
        GetActiveLoadOrderIndexShouldReturnNulloptForAPluginThatIsNotActive) {
   Game game(defaultGameSettings, "", "");
@@ -975,6 +1082,70 @@ TEST_P(GameTest, clearingMessagesShouldRemoveAllAppendedMessages) {
 
   EXPECT_EQ(previousSize - messages.size(), game.GetMessages().size());
 }
+
+TEST_P(GameTest, stateSnapshotShouldBeEmptyBeforeInit) {
+  Game game(defaultGameSettings, "", "");
+
+  const auto snapshot = game.GetStateSnapshot();
+
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_TRUE(snapshot->loadOrder.empty());
+  EXPECT_TRUE(snapshot->plugins.empty());
+  EXPECT_TRUE(snapshot->messages.empty());
+}
+
+TEST_P(GameTest, loadAllInstalledPluginsShouldPublishTheLoadOrderAndPlugins) {
+  Game game = CreateInitialisedGame(lootDataPath);
+  game.LoadAllInstalledPlugins(true);
+
+  const auto snapshot = game.GetStateSnapshot();
+
+  EXPECT_EQ(game.GetLoadOrder(), snapshot->loadOrder);
+  EXPECT_EQ(game.GetPlugins().size(), snapshot->plugins.size());
+  EXPECT_EQ(game.IsPluginActive(blankEsm), snapshot->IsPluginActive(blankEsm));
+  EXPECT_EQ(game.IsPluginActive(blankEsp), snapshot->IsPluginActive(blankEsp));
+  ASSERT_NE(nullptr, snapshot->GetPlugin(blankEsm));
+  EXPECT_TRUE(snapshot->GetPlugin(blankEsm)->isMaster);
+  EXPECT_EQ(game.GetMessages(), snapshot->messages);
+}
+
+TEST_P(GameTest, stateSnapshotPluginLookupShouldBeCaseInsensitive) {
+  Game game = CreateInitialisedGame(lootDataPath);
+  game.LoadAllInstalledPlugins(true);
+
+  const auto snapshot = game.GetStateSnapshot();
+
+  ASSERT_NE(nullptr, snapshot->GetPlugin(boost::to_lower_copy(blankEsm)));
+  EXPECT_EQ(snapshot->GetPlugin(blankEsm),
+            snapshot->GetPlugin(boost::to_upper_copy(blankEsm)));
+  EXPECT_EQ(game.IsPluginActive(blankEsm),
+            snapshot->IsPluginActive(boost::to_lower_copy(blankEsm)));
+}
+
+TEST_P(GameTest, sortPluginsShouldPublishItsMessagesAndSortCountTogether) {
+  Game game = CreateInitialisedGame(lootDataPath);
+  game.LoadAllInstalledPlugins(true);
+
+  game.SortPlugins();
+
+  const auto snapshot = game.GetStateSnapshot();
+  EXPECT_EQ(game.GetMessages(), snapshot->messages);
+}
+
+TEST_P(GameTest,
+       appendingAMessageShouldPublishANewSnapshotWithoutChangingTheOldOne) {
+  Game game = CreateInitialisedGame(lootDataPath);
+  const auto oldSnapshot = game.GetStateSnapshot();
+  const auto oldMessages = oldSnapshot->messages;
+
+  game.AppendMessage(Message(MessageType::say, "1"));
+
+  const auto newSnapshot = game.GetStateSnapshot();
+
+  EXPECT_NE(oldSnapshot, newSnapshot);
+  EXPECT_EQ(oldMessages, oldSnapshot->messages);
+  EXPECT_EQ(game.GetMessages(), newSnapshot->messages);
+}
 }
 }
 }
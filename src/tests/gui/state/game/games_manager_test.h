@@ -104,6 +104,27 @@ TEST(GamesManager, loadInstalledGamesShouldSetTheGamePathsOfInstalledGames) {
   EXPECT_EQ("FalloutNV", settings[2].GamePath());
 }
 
+TEST(GamesManager,
+     getInstalledGameSettingsShouldReturnTheSettingsOfInstalledGames) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      {
+          GameSettings(GameType::tes4),
+          GameSettings(GameType::tes5),
+          GameSettings(GameType::fonv),
+      },
+      std::filesystem::path(),
+      std::filesystem::path());
+
+  const auto settings = manager.GetInstalledGameSettings();
+
+  ASSERT_EQ(2, settings.size());
+  EXPECT_EQ("Skyrim", settings[0].FolderName());
+  EXPECT_EQ("Skyrim", settings[0].GamePath());
+  EXPECT_EQ("FalloutNV", settings[1].FolderName());
+  EXPECT_EQ("FalloutNV", settings[1].GamePath());
+}
+
 TEST(
     GamesManager,
     loadInstalledGamesShouldThrowAnExceptionIfTheCurrentGameIsNoLongerInstalled) {
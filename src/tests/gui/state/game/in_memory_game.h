@@ -0,0 +1,545 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_IN_MEMORY_GAME
+#define LOOT_TESTS_GUI_STATE_GAME_IN_MEMORY_GAME
+
+#include <loot/metadata/group.h>
+#include <loot/metadata/plugin_metadata.h>
+#include <loot/plugin_interface.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gui/state/game/evaluation_costs.h"
+#include "gui/state/game/game_settings.h"
+#include "gui/state/game/helpers.h"
+
+namespace loot {
+namespace test {
+// Controls the plugins and metadata that an InMemoryGame synthesises. Interval
+// options apply to every Nth plugin, and 0 disables them.
+struct InMemoryGameOptions {
+  size_t pluginCount{0};
+  size_t masterCount{0};
+  size_t groupCount{1};
+  size_t messagesPerPlugin{0};
+  size_t tagsPerPlugin{0};
+  size_t locationsPerPlugin{0};
+  size_t inactivePluginInterval{0};
+  size_t lightPluginInterval{0};
+  size_t dirtyPluginInterval{0};
+  size_t invalidPluginInterval{0};
+  size_t userMetadataInterval{0};
+  // Consecutive runs of this many plugins have overlapping FormIDs.
+  size_t overlapGroupSize{0};
+};
+
+class InMemoryPlugin : public PluginInterface {
+public:
+  InMemoryPlugin(std::string name,
+                 uint32_t crc,
+                 bool isMaster,
+                 bool isLightPlugin,
+                 std::vector<std::string> masters,
+                 std::vector<Tag> bashTags,
+                 std::optional<size_t> overlapGroup) :
+      name_(std::move(name)),
+      crc_(crc),
+      isMaster_(isMaster),
+      isLightPlugin_(isLightPlugin),
+      masters_(std::move(masters)),
+      bashTags_(std::move(bashTags)),
+      overlapGroup_(overlapGroup) {}
+
+  std::string GetName() const override { return name_; }
+
+  std::optional<float> GetHeaderVersion() const override { return 1.7f; }
+
+  std::optional<std::string> GetVersion() const override {
+    return "1.0." + std::to_string(crc_ % 100);
+  }
+
+  std::vector<std::string> GetMasters() const override { return masters_; }
+
+  std::vector<Tag> GetBashTags() const override { return bashTags_; }
+
+  std::optional<uint32_t> GetCRC() const override { return crc_; }
+
+  bool IsMaster() const override { return isMaster_; }
+
+  bool IsLightPlugin() const override { return isLightPlugin_; }
+
+  bool IsValidAsLightPlugin() const override { return true; }
+
+  bool IsEmpty() const override { return false; }
+
+  bool LoadsArchive() const override { return false; }
+
+  bool DoFormIDsOverlap(const PluginInterface& plugin) const override {
+    const auto other = dynamic_cast<const InMemoryPlugin*>(&plugin);
+
+    return other != nullptr && overlapGroup_.has_value() &&
+           overlapGroup_ == other->overlapGroup_;
+  }
+
+private:
+  std::string name_;
+  uint32_t crc_;
+  bool isMaster_;
+  bool isLightPlugin_;
+  std::vector<std::string> masters_;
+  std::vector<Tag> bashTags_;
+  std::optional<size_t> overlapGroup_;
+};
+
+// An in-memory stand-in for gui::Game that implements the functions that
+// PluginItem and the game data, sorting, conflict and metadata evaluation
+// queries use, so that they can be exercised at scale without libloot game
+// handles or any disk I/O.
+class InMemoryGame {
+public:
+  explicit InMemoryGame(const InMemoryGameOptions& options) :
+      settings_(GameType::tes5se) {
+    plugins_.reserve(options.pluginCount);
+
+    for (size_t i = 0; i < options.groupCount; i += 1) {
+      auto groupName = "group" + std::to_string(i);
+      if (i == 0) {
+        groups_.push_back(Group(groupName));
+      } else {
+        groups_.push_back(
+            Group(groupName, {"group" + std::to_string(i - 1)}, ""));
+      }
+    }
+
+    for (size_t i = 0; i < options.pluginCount; i += 1) {
+      addPlugin(options, i);
+    }
+
+    cacheActiveLoadOrderIndices();
+  }
+
+  InMemoryGame(const InMemoryGame&) = delete;
+  InMemoryGame(InMemoryGame&&) = delete;
+
+  InMemoryGame& operator=(const InMemoryGame&) = delete;
+  InMemoryGame& operator=(InMemoryGame&&) = delete;
+
+  const GameSettings& GetSettings() const { return settings_; }
+
+  const PluginInterface* GetPlugin(const std::string& name) const {
+    const auto it = pluginIndices_.find(name);
+    if (it == pluginIndices_.end()) {
+      return nullptr;
+    }
+
+    return &plugins_.at(it->second);
+  }
+
+  std::vector<const PluginInterface*> GetPlugins() const {
+    if (!arePluginsLoaded_) {
+      return {};
+    }
+
+    std::vector<const PluginInterface*> plugins;
+    plugins.reserve(plugins_.size());
+    for (const auto& plugin : plugins_) {
+      plugins.push_back(&plugin);
+    }
+
+    return plugins;
+  }
+
+  std::vector<const PluginInterface*> GetPluginsInLoadOrder() const {
+    std::vector<const PluginInterface*> plugins;
+    plugins.reserve(loadOrder_.size());
+    for (const auto& pluginName : loadOrder_) {
+      plugins.push_back(GetPlugin(pluginName));
+    }
+
+    return plugins;
+  }
+
+  std::vector<Message> CheckInstallValidity(const PluginInterface& plugin,
+                                            const PluginMetadata& metadata,
+                                            const std::string&) const {
+    std::vector<Message> messages;
+
+    if (IsPluginActive(plugin.GetName())) {
+      for (const auto& master : plugin.GetMasters()) {
+        if (GetPlugin(master) == nullptr) {
+          messages.push_back(PlainTextMessage(
+              MessageType::error,
+              "This plugin requires \"" + master +
+                  "\" to be installed, but it is missing."));
+        }
+      }
+    }
+
+    for (const auto& element : metadata.GetDirtyInfo()) {
+      if (element.GetCRC() == plugin.GetCRC()) {
+        messages.push_back(ToMessage(element));
+      }
+    }
+
+    return messages;
+  }
+
+  std::vector<Message> CheckBashTagsFile(const PluginInterface&,
+                                         const PluginMetadata&) const {
+    return {};
+  }
+
+  void LoadCreationClubPluginNames() {}
+
+  bool IsCreationClubPlugin(const PluginInterface&) const { return false; }
+
+  void LoadAllInstalledPlugins(bool headersOnly) {
+    arePluginsLoaded_ = true;
+    arePluginsFullyLoaded_ = !headersOnly;
+    conflictingPluginNames_.clear();
+    evaluationCosts_.Clear();
+  }
+
+  bool ArePluginsFullyLoaded() const { return arePluginsFullyLoaded_; }
+
+  std::optional<std::vector<std::string>> GetCachedConflictingPluginNames(
+      const std::string& pluginName) const {
+    const auto it = conflictingPluginNames_.find(pluginName);
+    if (it == conflictingPluginNames_.end()) {
+      return std::nullopt;
+    }
+
+    return it->second;
+  }
+
+  void CacheConflictingPluginNames(
+      const std::string& pluginName,
+      const std::vector<std::string>& conflictingPluginNames) {
+    conflictingPluginNames_[pluginName] = conflictingPluginNames;
+  }
+
+  // Returning a reference avoids copying the whole load order for every
+  // PluginItem that is constructed.
+  const std::vector<std::string>& GetLoadOrder() const { return loadOrder_; }
+
+  void SetLoadOrder(const std::vector<std::string>& loadOrder) {
+    loadOrder_ = loadOrder;
+    cacheActiveLoadOrderIndices();
+  }
+
+  bool IsPluginActive(const std::string& pluginName) const {
+    const auto it = pluginIndices_.find(pluginName);
+    return it != pluginIndices_.end() && activePlugins_.at(it->second);
+  }
+
+  std::optional<short> GetActiveLoadOrderIndex(
+      const PluginInterface& plugin,
+      const std::vector<std::string>& loadOrder) const {
+    if (!IsPluginActive(plugin.GetName())) {
+      return std::nullopt;
+    }
+
+    if (&loadOrder == &loadOrder_) {
+      const auto it = activeLoadOrderIndices_.find(plugin.GetName());
+      if (it == activeLoadOrderIndices_.end()) {
+        return std::nullopt;
+      }
+
+      return it->second;
+    }
+
+    short numberOfActivePlugins = 0;
+    for (const auto& otherPluginName : loadOrder) {
+      if (otherPluginName == plugin.GetName()) {
+        return numberOfActivePlugins;
+      }
+
+      const auto otherPlugin = GetPlugin(otherPluginName);
+      if (otherPlugin &&
+          plugin.IsLightPlugin() == otherPlugin->IsLightPlugin() &&
+          IsPluginActive(otherPluginName)) {
+        ++numberOfActivePlugins;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  // Sorting moves each group's plugins to be contiguous, in group order, while
+  // keeping masters first.
+  std::vector<std::string> SortPlugins() {
+    std::vector<std::string> sortedPlugins = loadOrder_;
+
+    const auto compare = [&](const std::string& lhs, const std::string& rhs) {
+      const auto lhsIsMaster = GetPlugin(lhs)->IsMaster();
+      const auto rhsIsMaster = GetPlugin(rhs)->IsMaster();
+      if (lhsIsMaster != rhsIsMaster) {
+        return lhsIsMaster;
+      }
+
+      return groupIndices_.at(lhs) < groupIndices_.at(rhs);
+    };
+
+    std::stable_sort(sortedPlugins.begin(), sortedPlugins.end(), compare);
+
+    return sortedPlugins;
+  }
+
+  std::optional<Message> ParseMetadataLists() { return std::nullopt; }
+
+  void AppendMessage(const Message&) {}
+
+  void PublishStateSnapshot() {}
+
+  std::vector<std::string> GetKnownBashTags() const { return knownBashTags_; }
+
+  std::vector<Group> GetMasterlistGroups() const { return groups_; }
+
+  std::vector<Group> GetUserGroups() const { return {}; }
+
+  std::optional<PluginMetadata> GetMasterlistMetadata(
+      const std::string& pluginName,
+      bool evaluateConditions = false) const {
+    const auto it = masterlistMetadata_.find(pluginName);
+    if (it == masterlistMetadata_.end()) {
+      return std::nullopt;
+    }
+
+    return evaluateConditions ? filterByConditions(it->second) : it->second;
+  }
+
+  std::optional<PluginMetadata> GetUserMetadata(
+      const std::string& pluginName,
+      bool evaluateConditions = false) const {
+    const auto it = userMetadata_.find(pluginName);
+    if (it == userMetadata_.end()) {
+      return std::nullopt;
+    }
+
+    return evaluateConditions ? filterByConditions(it->second) : it->second;
+  }
+
+  void AddUserMetadata(const PluginMetadata& metadata) {
+    userMetadata_.insert_or_assign(metadata.GetName(), metadata);
+  }
+
+  void ClearUserMetadata(const std::string& pluginName) {
+    userMetadata_.erase(pluginName);
+  }
+
+  // Metadata conditions are ignored unless an evaluator is set, in which case
+  // messages and tags are filtered using it.
+  void SetConditionEvaluator(
+      std::function<bool(const std::string&)> conditionEvaluator) {
+    conditionEvaluator_ = conditionEvaluator;
+  }
+
+  EvaluationCostRecorder& GetEvaluationCosts() const {
+    return evaluationCosts_;
+  }
+
+private:
+  PluginMetadata filterByConditions(const PluginMetadata& metadata) const {
+    if (!conditionEvaluator_) {
+      return metadata;
+    }
+
+    const auto evaluate = [this](const std::string& condition) {
+      if (condition.empty()) {
+        return true;
+      }
+
+      const auto startTime = std::chrono::steady_clock::now();
+      const auto result = conditionEvaluator_(condition);
+      evaluationCosts_.RecordCondition(
+          condition, std::chrono::steady_clock::now() - startTime);
+
+      return result;
+    };
+
+    std::vector<Message> messages;
+    for (const auto& message : metadata.GetMessages()) {
+      if (evaluate(message.GetCondition())) {
+        messages.push_back(message);
+      }
+    }
+
+    std::vector<Tag> tags;
+    for (const auto& tag : metadata.GetTags()) {
+      if (evaluate(tag.GetCondition())) {
+        tags.push_back(tag);
+      }
+    }
+
+    auto evaluated = metadata;
+    evaluated.SetMessages(messages);
+    evaluated.SetTags(tags);
+
+    return evaluated;
+  }
+
+  // Looking up active load order indices is linear in the load order size, so
+  // cache them for the current load order to avoid PluginItem construction
+  // taking quadratic time.
+  void cacheActiveLoadOrderIndices() {
+    activeLoadOrderIndices_.clear();
+
+    short activeCount = 0;
+    short activeLightCount = 0;
+    for (const auto& pluginName : loadOrder_) {
+      const auto plugin = GetPlugin(pluginName);
+      if (plugin == nullptr || !IsPluginActive(pluginName)) {
+        continue;
+      }
+
+      auto& count = plugin->IsLightPlugin() ? activeLightCount : activeCount;
+      activeLoadOrderIndices_[pluginName] = count;
+      count += 1;
+    }
+  }
+
+  void addPlugin(const InMemoryGameOptions& options, size_t index) {
+    const auto isMaster = index < options.masterCount;
+    const auto pluginName = isMaster
+                                ? "Master" + std::to_string(index) + ".esm"
+                                : "Plugin" + std::to_string(index) + ".esp";
+
+    const auto isEvery = [&](size_t interval) {
+      return interval != 0 && index % interval == interval - 1;
+    };
+
+    std::vector<std::string> masters;
+    if (options.masterCount > 0 && !isMaster) {
+      masters.push_back("Master0.esm");
+    }
+    if (isEvery(options.invalidPluginInterval)) {
+      masters.push_back("Missing" + std::to_string(index) + ".esm");
+    }
+
+    std::vector<Tag> bashTags;
+    for (size_t i = 0; i < options.tagsPerPlugin; i += 1) {
+      const auto tagName = "Tag" + std::to_string(i);
+      bashTags.push_back(Tag(tagName));
+
+      if (index == 0) {
+        knownBashTags_.push_back(tagName);
+      }
+    }
+
+    std::optional<size_t> overlapGroup;
+    if (options.overlapGroupSize > 0) {
+      overlapGroup = index / options.overlapGroupSize;
+    }
+
+    const auto crc = static_cast<uint32_t>(index) * 2654435761u;
+
+    pluginIndices_.emplace(pluginName, plugins_.size());
+    plugins_.push_back(InMemoryPlugin(pluginName,
+                                      crc,
+                                      isMaster,
+                                      isEvery(options.lightPluginInterval),
+                                      masters,
+                                      bashTags,
+                                      overlapGroup));
+    activePlugins_.push_back(!isEvery(options.inactivePluginInterval));
+    loadOrder_.push_back(pluginName);
+
+    PluginMetadata metadata(pluginName);
+
+    if (!groups_.empty()) {
+      // Assign groups in reverse so that sorting changes the load order.
+      const auto groupIndex = groups_.size() - 1 - index % groups_.size();
+      metadata.SetGroup(groups_.at(groupIndex).GetName());
+      groupIndices_.emplace(pluginName, groupIndex);
+    } else {
+      groupIndices_.emplace(pluginName, 0);
+    }
+
+    std::vector<Message> messages;
+    for (size_t i = 0; i < options.messagesPerPlugin; i += 1) {
+      const auto type = static_cast<MessageType>(i % 3);
+      messages.push_back(Message(
+          type, "Message " + std::to_string(i) + " for " + pluginName));
+    }
+    metadata.SetMessages(messages);
+
+    std::vector<Tag> tags;
+    for (size_t i = 0; i < options.tagsPerPlugin; i += 1) {
+      tags.push_back(Tag("Tag" + std::to_string(i), i % 2 == 0));
+    }
+    metadata.SetTags(tags);
+
+    std::vector<Location> locations;
+    for (size_t i = 0; i < options.locationsPerPlugin; i += 1) {
+      locations.push_back(
+          Location("https://www.example.com/" + pluginName + "/" +
+                       std::to_string(i),
+                   ""));
+    }
+    metadata.SetLocations(locations);
+
+    if (isEvery(options.dirtyPluginInterval)) {
+      metadata.SetDirtyInfo(
+          {PluginCleaningData(crc, "TES5Edit", {}, 1, 2, 3)});
+    }
+
+    masterlistMetadata_.emplace(pluginName, metadata);
+
+    if (isEvery(options.userMetadataInterval)) {
+      PluginMetadata userMetadata(pluginName);
+      userMetadata.SetTags({Tag("UserTag")});
+      userMetadata_.emplace(pluginName, userMetadata);
+    }
+  }
+
+  GameSettings settings_;
+  std::vector<InMemoryPlugin> plugins_;
+  std::unordered_map<std::string, size_t> pluginIndices_;
+  std::unordered_map<std::string, size_t> groupIndices_;
+  std::vector<bool> activePlugins_;
+  std::vector<std::string> loadOrder_;
+  std::unordered_map<std::string, short> activeLoadOrderIndices_;
+  std::vector<Group> groups_;
+  std::vector<std::string> knownBashTags_;
+  std::unordered_map<std::string, PluginMetadata> masterlistMetadata_;
+  std::unordered_map<std::string, PluginMetadata> userMetadata_;
+  std::map<std::string, std::vector<std::string>> conflictingPluginNames_;
+  std::function<bool(const std::string&)> conditionEvaluator_;
+  mutable EvaluationCostRecorder evaluationCosts_;
+  bool arePluginsLoaded_{false};
+  bool arePluginsFullyLoaded_{false};
+};
+}
+}
+
+#endif
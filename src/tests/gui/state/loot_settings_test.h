@@ -130,6 +130,9 @@ TEST_P(LootSettingsTest, defaultConstructorShouldSetDefaultValues) {
   EXPECT_FALSE(settings_.getFilters().hideMessagelessPlugins);
   EXPECT_EQ("https://raw.githubusercontent.com/loot/prelude/v0.18/prelude.yaml",
             settings_.getPreludeSource());
+  EXPECT_EQ(300, settings_.getFullPluginDataIdleTimeout());
+  EXPECT_EQ(0, settings_.getFullPluginDataMemoryBudget());
+  EXPECT_EQ("", settings_.getSharedCachePath());
 
   // GameSettings equality only checks name and folder, so check
   // other settings individually.
@@ -228,6 +231,9 @@ TEST_P(LootSettingsTest, loadingShouldReadFromATomlFile) {
       << "theme = \"dark\"" << endl
       << "lastVersion = \"0.7.1\"" << endl
       << "preludeSource = \"../prelude.yaml\"" << endl
+      << "fullPluginDataIdleTimeout = 60" << endl
+      << "fullPluginDataMemoryBudget = 2048" << endl
+      << "sharedCachePath = \"../shared\"" << endl
       << endl
       << "[window]" << endl
       << "top = 1" << endl
@@ -267,6 +273,9 @@ TEST_P(LootSettingsTest, loadingShouldReadFromATomlFile) {
   EXPECT_EQ("fr", settings_.getLanguage());
   EXPECT_EQ("dark", settings_.getTheme());
   EXPECT_EQ("../prelude.yaml", settings_.getPreludeSource());
+  EXPECT_EQ(60, settings_.getFullPluginDataIdleTimeout());
+  EXPECT_EQ(2048, settings_.getFullPluginDataMemoryBudget());
+  EXPECT_EQ("../shared", settings_.getSharedCachePath());
 
   ASSERT_TRUE(settings_.getMainWindowPosition().has_value());
   EXPECT_EQ(1, settings_.getMainWindowPosition().value().top);
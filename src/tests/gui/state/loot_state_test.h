@@ -0,0 +1,185 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_LOOT_STATE_TEST
+#define LOOT_TESTS_GUI_STATE_LOOT_STATE_TEST
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <fstream>
+#include <future>
+
+#include "gui/query/types/change_game_query.h"
+#include "gui/state/loot_state.h"
+#include "tests/common_game_test_fixture.h"
+
+namespace loot {
+namespace test {
+class LootStateTest : public CommonGameTestFixture {
+protected:
+  static constexpr size_t SYNTHETIC_PLUGIN_COUNT = 2000;
+
+  LootStateTest() :
+      gameSettings_(GameSettings(GetParam())
+                        .SetMinimumHeaderVersion(0.0f)
+                        .SetGamePath(dataPath.parent_path())
+                        .SetGameLocalPath(localPath)) {}
+
+  void SetUp() override {
+    for (size_t i = 0; i < SYNTHETIC_PLUGIN_COUNT; i += 1) {
+      std::filesystem::copy_file(
+          dataPath / blankEsp,
+          dataPath / ("Synthetic " + std::to_string(i) + ".esp"));
+    }
+
+    std::filesystem::create_directories(lootDataPath);
+
+    LootSettings settings;
+    settings.storeGameSettings({gameSettings_});
+    settings.save(lootDataPath / "settings.toml");
+
+    const auto gamePath = lootDataPath / "games" / gameSettings_.FolderName();
+    std::filesystem::create_directories(gamePath);
+
+    std::ofstream out(gamePath / "masterlist.yaml");
+    out << "plugins:\n";
+    for (size_t i = 0; i < 4 * SYNTHETIC_PLUGIN_COUNT; i += 1) {
+      out << "  - name: 'Synthetic " << i << ".esp'\n"
+          << "    msg:\n"
+          << "      - type: say\n"
+          << "        content: 'A message'\n"
+          << "    tag: [ Delev, Relev ]\n";
+    }
+  }
+
+  void TearDown() override {
+    resetLogger();
+
+    CommonGameTestFixture::TearDown();
+  }
+
+  // LootState logs to a file in its data folder, so put back the logger that
+  // the tests use to close the file.
+  static void resetLogger() {
+    spdlog::drop("loot_logger");
+    spdlog::create<spdlog::sinks::null_sink_st>("loot_logger");
+  }
+
+  const GameSettings gameSettings_;
+};
+
+// Pass an empty first argument, as it's a prefix for the test instantation,
+// but we only have the one so no prefix is necessary.
+INSTANTIATE_TEST_SUITE_P(,
+                         LootStateTest,
+                         ::testing::Values(GameType::tes5se));
+
+TEST_P(LootStateTest,
+       startLoadingCurrentGameShouldDoNothingIfInitRecordedAnError) {
+  // Auto-sort can't be enabled without also giving a game.
+  LootState state("", lootDataPath);
+  state.init("", "", true);
+
+  state.startLoadingCurrentGame();
+
+  EXPECT_FALSE(state.takeStartupGameData().has_value());
+}
+
+TEST_P(LootStateTest, takeStartupGameDataShouldReturnTheGameDataOnlyOnce) {
+  LootState state("", lootDataPath);
+  state.init(gameSettings_.FolderName(), "", false);
+
+  state.startLoadingCurrentGame();
+  state.initCurrentGame();
+
+  auto gameData = state.takeStartupGameData();
+
+  ASSERT_TRUE(gameData.has_value());
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, gameData.value().get().size());
+  EXPECT_FALSE(state.takeStartupGameData().has_value());
+}
+
+TEST_P(LootStateTest, changeGameQueryShouldLoadTheNewCurrentGamesData) {
+  LootState state("", lootDataPath);
+  state.init(gameSettings_.FolderName(), "", false);
+
+  ChangeGameQuery query(state, gameSettings_.FolderName(), [](std::string) {});
+  const auto items = std::get<PluginItems>(query.executeLogic());
+
+  EXPECT_EQ(gameSettings_.FolderName(),
+            state.GetCurrentGame().GetSettings().FolderName());
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, items.size());
+}
+
+TEST_P(LootStateTest,
+       startLoadingCurrentGameShouldStartLoadingWithoutWaitingForTheUi) {
+  LootState state("", lootDataPath);
+  state.init(gameSettings_.FolderName(), "", false);
+
+  // main() does this before constructing MainWindow.
+  state.startLoadingCurrentGame();
+
+  // Take the data without calling anything else first, as nothing else has
+  // run yet when MainWindow is constructed.
+  auto gameData = state.takeStartupGameData();
+  ASSERT_TRUE(gameData.has_value());
+
+  // A deferred future would only start loading once MainWindow waited on it.
+  EXPECT_NE(std::future_status::deferred,
+            gameData.value().wait_for(std::chrono::seconds(0)));
+
+  const auto items = gameData.value().get();
+  EXPECT_LT(SYNTHETIC_PLUGIN_COUNT, items.size());
+}
+
+TEST_P(LootStateTest,
+       initCurrentGameShouldNotReloadTheGameLoadedByStartLoadingCurrentGame) {
+  LootState state("", lootDataPath);
+  state.init(gameSettings_.FolderName(), "", false);
+
+  state.startLoadingCurrentGame();
+  auto gameData = state.takeStartupGameData();
+  ASSERT_TRUE(gameData.has_value());
+  const auto items = gameData.value().get();
+
+  const auto& game = state.GetCurrentGame();
+  const auto snapshot = game.GetStateSnapshot();
+  const auto plugin = game.GetPlugin(items.back().name);
+  ASSERT_NE(nullptr, plugin);
+
+  // This is what MainWindow does once it's ready.
+  state.initCurrentGame();
+
+  EXPECT_EQ(snapshot, state.GetCurrentGame().GetStateSnapshot());
+  EXPECT_EQ(plugin, state.GetCurrentGame().GetPlugin(items.back().name));
+  EXPECT_FALSE(state.takeStartupGameData().has_value());
+}
+}
+}
+
+#endif